@@ -104,6 +104,7 @@ CallInsList = {
 	"GameFrame",
 	"CobCallback",
 	"AllowCommand",
+	"AllowUnitsCommand",
 	"CommandFallback",
 	"AllowUnitCreation",
 	"AllowUnitTransfer",
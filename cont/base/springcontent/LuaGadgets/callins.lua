@@ -101,6 +101,7 @@ CALLIN_LIST = {
 
 	-- misc synced LuaRules callins
 	"AllowCommand",
+	"AllowUnitsCommand",
 	"AllowStartPosition",
 	"AllowUnitCreation",
 	"AllowUnitTransfer",
@@ -1117,6 +1117,28 @@ function gadgetHandler:AllowCommand(
   return true
 end
 
+function gadgetHandler:AllowUnitsCommand(
+	unitIDs, cmdID, cmdParams, cmdOptions,
+	playerID, fromSynced, fromLua
+)
+  local allowed = nil
+  for _,g in r_ipairs(self.AllowUnitsCommandList) do
+    local result = g:AllowUnitsCommand(
+		unitIDs, cmdID, cmdParams, cmdOptions,
+		playerID, fromSynced, fromLua)
+    if (result == false) then
+      return false
+    end
+    if (type(result) == "table") then
+      allowed = allowed or {}
+      for i = 1, #unitIDs do
+        allowed[i] = (allowed[i] ~= false) and (result[i] ~= false)
+      end
+    end
+  end
+  return (allowed or true)
+end
+
 function gadgetHandler:AllowStartPosition(playerID, teamID, readyState, cx, cy, cz, rx, ry, rz)
   for _,g in r_ipairs(self.AllowStartPositionList) do
     if (not g:AllowStartPosition(playerID, teamID, readyState, cx, cy, cz, rx, ry, rz)) then
@@ -19,17 +19,35 @@
 #include "Sim/Units/CommandAI/Command.h"
 #include "Sim/Weapons/WeaponDef.h"
 #include "Net/Protocol/NetProtocol.h"
+#include "System/Config/ConfigHandler.h"
 #include "System/Log/ILog.h"
+#include "System/Platform/Threading.h"
 #include "System/TimeProfiler.h"
 #include "System/SafeUtil.h"
 
 
+CONFIG(bool, AIThreaded).defaultValue(false).description(
+	"Run each native Skirmish AI on a thread of its own, fed by a queue of events. "
+	"Engine callbacks made by such AIs are only served while the game waits for them (see AIThreadedMaxFrameLag); Lua and drawing commands are unavailable to them."
+);
+CONFIG(int, AIThreadedMaxFrameLag).defaultValue(GAME_SPEED).minimumValue(0).description(
+	"Number of simulation frames a threaded Skirmish AI may fall behind before the simulation waits for it."
+);
+
+
 CR_BIND(CEngineOutHandler, )
 CR_REG_METADATA(CEngineOutHandler, (
 	CR_IGNORED(hostSkirmishAIs),
 	CR_IGNORED(teamSkirmishAIs),
 	CR_IGNORED(activeSkirmishAIs),
 
+	CR_IGNORED(simulationGateMutex),
+	CR_IGNORED(simulationGateCond),
+	CR_IGNORED(simulationParked),
+	CR_IGNORED(skirmishAICallbackRunning),
+	CR_IGNORED(maxSkirmishAIFrameLag),
+	CR_IGNORED(threadedSkirmishAIs),
+
 	CR_POSTLOAD(PostLoad)
 ))
 
@@ -76,6 +94,64 @@ void CEngineOutHandler::Destroy() {
 }
 
 
+void CEngineOutHandler::Init()
+{
+	activeSkirmishAIs.reserve(16);
+
+	threadedSkirmishAIs = configHandler->GetBool("AIThreaded");
+	maxSkirmishAIFrameLag = configHandler->GetInt("AIThreadedMaxFrameLag");
+
+	simulationParked = false;
+	skirmishAICallbackRunning = false;
+}
+
+
+void CEngineOutHandler::ParkSimulation()
+{
+	if (!threadedSkirmishAIs)
+		return;
+
+	{
+		std::lock_guard<spring::mutex> lck(simulationGateMutex);
+		assert(!simulationParked);
+		simulationParked = true;
+	}
+
+	simulationGateCond.notify_all();
+}
+
+void CEngineOutHandler::UnparkSimulation()
+{
+	if (!threadedSkirmishAIs)
+		return;
+
+	std::unique_lock<spring::mutex> lck(simulationGateMutex);
+	simulationGateCond.wait(lck, [&]() { return !skirmishAICallbackRunning; });
+
+	assert(simulationParked);
+	simulationParked = false;
+}
+
+void CEngineOutHandler::BeginSkirmishAICallback()
+{
+	std::unique_lock<spring::mutex> lck(simulationGateMutex);
+	simulationGateCond.wait(lck, [&]() { return (simulationParked && !skirmishAICallbackRunning); });
+
+	skirmishAICallbackRunning = true;
+}
+
+void CEngineOutHandler::EndSkirmishAICallback()
+{
+	{
+		std::lock_guard<spring::mutex> lck(simulationGateMutex);
+		assert(skirmishAICallbackRunning);
+		skirmishAICallbackRunning = false;
+	}
+
+	simulationGateCond.notify_all();
+}
+
+
 // This macro should be inserted at the start of each method sending AI events
 #define AI_SCOPED_TIMER()           \
 	if (activeSkirmishAIs.empty())  \
@@ -128,6 +204,18 @@ void CEngineOutHandler::Save(std::ostream* s, const uint8_t skirmishAIId) {
 void CEngineOutHandler::Update() {
 	AI_SCOPED_TIMER();
 	DO_FOR_SKIRMISH_AIS(Update(gs->frameNum))
+
+	if (!threadedSkirmishAIs)
+		return;
+
+	// bound the latency of threaded AIs; anything they have not caught up
+	// with by now would otherwise pile up in their queues without limit.
+	// this is also the only time their engine callbacks are served
+	ParkSimulation();
+
+	DO_FOR_SKIRMISH_AIS(WaitForFrame(gs->frameNum - maxSkirmishAIFrameLag))
+
+	UnparkSimulation();
 }
 
 
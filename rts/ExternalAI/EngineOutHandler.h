@@ -5,6 +5,7 @@
 
 #include "SkirmishAIWrapper.h"
 #include "System/Object.h"
+#include "System/Threading/SpringThreading.h"
 #include "Sim/Misc/GlobalConstants.h"
 
 #include <array>
@@ -31,7 +32,7 @@ public:
 	static void Create();
 	static void Destroy();
 
-	void Init() { activeSkirmishAIs.reserve(16); }
+	void Init();
 	void Kill() {
 		PreDestroy();
 
@@ -49,6 +50,23 @@ public:
 
 	void Update();
 
+	/// true if native AIs handle their events on threads of their own
+	bool ThreadedSkirmishAIs() const { return threadedSkirmishAIs; }
+
+	/**
+	 * Threaded AIs only; no-ops otherwise.
+	 * Engine state belongs to the thread running the game (simulation, Lua,
+	 * rendering and their shared scratch buffers) except while it is parked
+	 * waiting for AI threads between ParkSimulation and UnparkSimulation.
+	 * AI threads may only call back into the engine during that time, one
+	 * callback at a time (Begin/EndSkirmishAICallback); Unpark waits for a
+	 * running callback to return.
+	 */
+	void ParkSimulation();
+	void UnparkSimulation();
+	void BeginSkirmishAICallback();
+	void EndSkirmishAICallback();
+
 	/** Group should return false if it doenst want the unit for some reason. */
 	bool UnitAddedToGroup(const CUnit& unit, const CGroup& group);
 	/** No way to refuse giving up a unit. */
@@ -117,6 +135,17 @@ private:
 	std::array<std::vector<uint8_t>, MAX_TEAMS> teamSkirmishAIs;
 
 	std::vector<uint8_t> activeSkirmishAIs;
+
+	// guards the two flags below
+	spring::mutex simulationGateMutex;
+	spring::condition_variable simulationGateCond;
+
+	bool simulationParked = false;
+	bool skirmishAICallbackRunning = false;
+
+	int maxSkirmishAIFrameLag = 0;
+
+	bool threadedSkirmishAIs = false;
 };
 
 #define eoh CEngineOutHandler::GetInstance()
@@ -2256,6 +2256,21 @@ struct SSkirmishAICallback {
 
 	bool              (CALLING_CONV *Debug_GraphDrawer_isEnabled)(int skirmishAIId);
 
+	/**
+	 * Bulk version of Unit_getPos, Unit_getVel, Unit_getHealth, Unit_getDef,
+	 * Unit_getTeam and Unit_getBuildProgress, filling one array per field
+	 * for all of the given units in a single call. Each value follows the
+	 * same LOS- and radar-rules (and cheat-state) as its per-unit callback,
+	 * so units that are not visible get the same fail values.
+	 * Any of the output arrays may be NULL, in which case that field is
+	 * skipped; the others need room for unitIds_size elements, or three
+	 * times that for positions and velocities.
+	 *
+	 * @param   unitIds  ids of the units to query, eg. from getEnemyUnits
+	 * @return  number of units written, i.e. unitIds_size
+	 */
+	int               (CALLING_CONV *getUnitsData)(int skirmishAIId, int* unitIds, int unitIds_size, float* positions, float* velocities, float* healths, int* unitDefIds, int* teamIds, float* buildProgresses);
+
 };
 
 #if	defined(__cplusplus)
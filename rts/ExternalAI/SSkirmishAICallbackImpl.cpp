@@ -3,6 +3,7 @@
 #include "ExternalAI/AICallback.h"
 #include "ExternalAI/AICheats.h"
 #include "ExternalAI/AILibraryManager.h"
+#include "ExternalAI/EngineOutHandler.h"
 #include "ExternalAI/SSkirmishAICallbackImpl.h"
 #include "ExternalAI/SkirmishAILibraryInfo.h"
 #include "ExternalAI/SkirmishAIWrapper.h"
@@ -47,6 +48,7 @@
 #include "System/SpringMath.h"
 #include "System/FileSystem/ArchiveScanner.h"
 #include "System/Log/ILog.h"
+#include "System/Platform/Threading.h"
 
 
 static std::array<std::pair<CAICallback, CAICheats>, MAX_AIS> AI_LEGACY_CALLBACKS;
@@ -638,6 +640,35 @@ EXPORT(int) skirmishAiCallback_Engine_executeCommand(
 	return ret;
 }
 
+// commands touching Lua, rendering or console state, and cheats which create
+// units or change resources directly (firing Lua and render events) instead
+// of going through the network; these expect to run on the main thread and
+// are unavailable to threaded AIs
+static bool isMainThreadOnlyCommand(int commandTopic) {
+	switch (commandTopic) {
+		case COMMAND_CHEATS_SET_MY_INCOME_MULTIPLIER:
+		case COMMAND_CHEATS_GIVE_ME_RESOURCE:
+		case COMMAND_CHEATS_GIVE_ME_NEW_UNIT:
+		case COMMAND_SET_LAST_POS_MESSAGE:
+		case COMMAND_DRAWER_POINT_ADD:
+		case COMMAND_DRAWER_LINE_ADD:
+		case COMMAND_DRAWER_POINT_REMOVE:
+		case COMMAND_CALL_LUA_RULES:
+		case COMMAND_CALL_LUA_UI:
+		case COMMAND_DRAWER_ADD_NOTIFICATION:
+		case COMMAND_DRAWER_DRAW_UNIT: {
+			return true;
+		} break;
+		default: {
+		} break;
+	}
+
+	if (commandTopic >= COMMAND_DRAWER_PATH_START && commandTopic <= COMMAND_DRAWER_FIGURE_DELETE)
+		return true;
+
+	return (commandTopic >= COMMAND_DEBUG_DRAWER_GRAPH_SET_POS && commandTopic <= COMMAND_DEBUG_DRAWER_OVERLAYTEXTURE_SET_LABEL);
+}
+
 EXPORT(int) skirmishAiCallback_Engine_handleCommand(
 	int skirmishAIId,
 	int /*toId*/,
@@ -647,6 +678,11 @@ EXPORT(int) skirmishAiCallback_Engine_handleCommand(
 ) {
 	int ret = 0;
 
+	if (!Threading::IsMainThread() && isMainThreadOnlyCommand(commandTopic)) {
+		LOG_L(L_WARNING, "[%s][AI=%d] command topic %d is not available to threaded AIs", __func__, skirmishAIId, commandTopic);
+		return -1;
+	}
+
 	CAICallback* clb = GetCallBack(skirmishAIId);
 	// if this is not NULL, cheating is enabled
 	CAICheats* clbCheat = nullptr;
@@ -4802,6 +4838,40 @@ EXPORT(bool) skirmishAiCallback_Debug_GraphDrawer_isEnabled(int skirmishAIId) {
 	return GetCallBack(skirmishAIId)->IsDebugDrawerEnabled();
 }
 
+EXPORT(int) skirmishAiCallback_getUnitsData(
+	int skirmishAIId,
+	int* unitIds,
+	int unitIds_size,
+	float* positions,
+	float* velocities,
+	float* healths,
+	int* unitDefIds,
+	int* teamIds,
+	float* buildProgresses
+) {
+	// one round-trip instead of one per unit and field; wrapper languages
+	// pay a heavy toll for every crossing of the C interface
+	for (int i = 0; i < unitIds_size; i++) {
+		const int unitId = unitIds[i];
+
+		if (positions != nullptr)
+			skirmishAiCallback_Unit_getPos(skirmishAIId, unitId, &positions[i * 3]);
+		if (velocities != nullptr)
+			skirmishAiCallback_Unit_getVel(skirmishAIId, unitId, &velocities[i * 3]);
+
+		if (healths != nullptr)
+			healths[i] = skirmishAiCallback_Unit_getHealth(skirmishAIId, unitId);
+		if (unitDefIds != nullptr)
+			unitDefIds[i] = skirmishAiCallback_Unit_getDef(skirmishAIId, unitId);
+		if (teamIds != nullptr)
+			teamIds[i] = skirmishAiCallback_Unit_getTeam(skirmishAIId, unitId);
+		if (buildProgresses != nullptr)
+			buildProgresses[i] = skirmishAiCallback_Unit_getBuildProgress(skirmishAIId, unitId);
+	}
+
+	return (std::max(unitIds_size, 0));
+}
+
 EXPORT(int) skirmishAiCallback_getGroups(int skirmishAIId, int* groupIds, int maxGroups) {
 	const CGroupHandler& gh = uiGroupHandlers[ AI_TEAM_IDS[skirmishAIId] ];
 	const std::vector<CGroup>& gs = gh.GetGroups();
@@ -4930,601 +5000,629 @@ EXPORT(bool) skirmishAiCallback_Group_isSelected(int skirmishAIId, int groupId)
 
 
 
-static void skirmishAiCallback_init(SSkirmishAICallback* callback) {
+// threaded AIs enter every accessor through this, so none of them can run
+// unless the thread running the game is parked waiting for the AI threads
+template<auto Func> struct SimulationLockedCallback;
+
+template<typename R, typename... Args, R (CALLING_CONV *Func)(Args...)>
+struct SimulationLockedCallback<Func> {
+	static R CALLING_CONV Call(Args... args) {
+		// synchronous events are handled by the thread owning the engine
+		if (!CSkirmishAIWrapper::InEventThread())
+			return (Func(args...));
+
+		struct ScopedCallback {
+			ScopedCallback() { eoh->BeginSkirmishAICallback(); }
+			~ScopedCallback() { eoh->EndSkirmishAICallback(); }
+		} scopedCallback;
+
+		return (Func(args...));
+	}
+};
+
+static void skirmishAiCallback_init(SSkirmishAICallback* callback, bool threaded) {
 	memset(callback, 0, sizeof(SSkirmishAICallback));
 
+	#define REGISTER_CALLBACK(name)                                                                    \
+		callback->name = threaded?                                                                     \
+			&SimulationLockedCallback<&skirmishAiCallback_ ## name>::Call:                             \
+			&skirmishAiCallback_ ## name
+
 	// register function pointers to accessors (which wrap around the legacy callbacks)
-	callback->Engine_handleCommand = &skirmishAiCallback_Engine_handleCommand;
-	callback->Engine_executeCommand = &skirmishAiCallback_Engine_executeCommand;
-
-	callback->Engine_Version_getMajor = &skirmishAiCallback_Engine_Version_getMajor;
-	callback->Engine_Version_getMinor = &skirmishAiCallback_Engine_Version_getMinor;
-	callback->Engine_Version_getPatchset = &skirmishAiCallback_Engine_Version_getPatchset;
-	callback->Engine_Version_getCommits = &skirmishAiCallback_Engine_Version_getCommits;
-	callback->Engine_Version_getHash = &skirmishAiCallback_Engine_Version_getHash;
-	callback->Engine_Version_getBranch = &skirmishAiCallback_Engine_Version_getBranch;
-	callback->Engine_Version_getAdditional = &skirmishAiCallback_Engine_Version_getAdditional;
-	callback->Engine_Version_getBuildTime = &skirmishAiCallback_Engine_Version_getBuildTime;
-	callback->Engine_Version_isRelease = &skirmishAiCallback_Engine_Version_isRelease;
-	callback->Engine_Version_getNormal = &skirmishAiCallback_Engine_Version_getNormal;
-	callback->Engine_Version_getSync = &skirmishAiCallback_Engine_Version_getSync;
-	callback->Engine_Version_getFull = &skirmishAiCallback_Engine_Version_getFull;
-	callback->getNumTeams = &skirmishAiCallback_getNumTeams;
-	callback->getNumSkirmishAIs = &skirmishAiCallback_getNumSkirmishAIs;
-	callback->getMaxSkirmishAIs = &skirmishAiCallback_getMaxSkirmishAIs;
-	callback->SkirmishAI_getTeamId = &skirmishAiCallback_SkirmishAI_getTeamId;
-	callback->SkirmishAI_Info_getSize = &skirmishAiCallback_SkirmishAI_Info_getSize;
-	callback->SkirmishAI_Info_getKey = &skirmishAiCallback_SkirmishAI_Info_getKey;
-	callback->SkirmishAI_Info_getValue = &skirmishAiCallback_SkirmishAI_Info_getValue;
-	callback->SkirmishAI_Info_getDescription = &skirmishAiCallback_SkirmishAI_Info_getDescription;
-	callback->SkirmishAI_Info_getValueByKey = &skirmishAiCallback_SkirmishAI_Info_getValueByKey;
-	callback->SkirmishAI_OptionValues_getSize = &skirmishAiCallback_SkirmishAI_OptionValues_getSize;
-	callback->SkirmishAI_OptionValues_getKey = &skirmishAiCallback_SkirmishAI_OptionValues_getKey;
-	callback->SkirmishAI_OptionValues_getValue = &skirmishAiCallback_SkirmishAI_OptionValues_getValue;
-	callback->SkirmishAI_OptionValues_getValueByKey = &skirmishAiCallback_SkirmishAI_OptionValues_getValueByKey;
-	callback->Log_log = &skirmishAiCallback_Log_log;
-	callback->Log_exception = &skirmishAiCallback_Log_exception;
-	callback->DataDirs_getPathSeparator = &skirmishAiCallback_DataDirs_getPathSeparator;
-	callback->DataDirs_getConfigDir = &skirmishAiCallback_DataDirs_getConfigDir;
-	callback->DataDirs_getWriteableDir = &skirmishAiCallback_DataDirs_getWriteableDir;
-	callback->DataDirs_locatePath = &skirmishAiCallback_DataDirs_locatePath;
-	callback->DataDirs_Roots_getSize = &skirmishAiCallback_DataDirs_Roots_getSize;
-	callback->DataDirs_Roots_getDir = &skirmishAiCallback_DataDirs_Roots_getDir;
-	callback->DataDirs_Roots_locatePath = &skirmishAiCallback_DataDirs_Roots_locatePath;
-	callback->Game_getCurrentFrame = &skirmishAiCallback_Game_getCurrentFrame;
-	callback->Game_getAiInterfaceVersion = &skirmishAiCallback_Game_getAiInterfaceVersion;
-	callback->Game_getMyTeam = &skirmishAiCallback_Game_getMyTeam;
-	callback->Game_getMyAllyTeam = &skirmishAiCallback_Game_getMyAllyTeam;
-	callback->Game_getPlayerTeam = &skirmishAiCallback_Game_getPlayerTeam;
-	callback->Game_getTeams = &skirmishAiCallback_Game_getTeams;
-	callback->Game_getTeamSide = &skirmishAiCallback_Game_getTeamSide;
-	callback->Game_getTeamColor = &skirmishAiCallback_Game_getTeamColor;
-	callback->Game_getTeamIncomeMultiplier = &skirmishAiCallback_Game_getTeamIncomeMultiplier;
-	callback->Game_getTeamAllyTeam = &skirmishAiCallback_Game_getTeamAllyTeam;
-	callback->Game_getTeamResourceCurrent = &skirmishAiCallback_Game_getTeamResourceCurrent;
-	callback->Game_getTeamResourceIncome = &skirmishAiCallback_Game_getTeamResourceIncome;
-	callback->Game_getTeamResourceUsage = &skirmishAiCallback_Game_getTeamResourceUsage;
-	callback->Game_getTeamResourceStorage = &skirmishAiCallback_Game_getTeamResourceStorage;
-	callback->Game_getTeamResourcePull = &skirmishAiCallback_Game_getTeamResourcePull;
-	callback->Game_getTeamResourceShare = &skirmishAiCallback_Game_getTeamResourceShare;
-	callback->Game_getTeamResourceSent = &skirmishAiCallback_Game_getTeamResourceSent;
-	callback->Game_getTeamResourceReceived = &skirmishAiCallback_Game_getTeamResourceReceived;
-	callback->Game_getTeamResourceExcess = &skirmishAiCallback_Game_getTeamResourceExcess;
-	callback->Game_isAllied = &skirmishAiCallback_Game_isAllied;
-	callback->Game_isDebugModeEnabled = &skirmishAiCallback_Game_isDebugModeEnabled;
-	callback->Game_isPaused = &skirmishAiCallback_Game_isPaused;
-	callback->Game_getSpeedFactor = &skirmishAiCallback_Game_getSpeedFactor;
-	callback->Game_getSetupScript = &skirmishAiCallback_Game_getSetupScript;
-	callback->Game_getCategoryFlag = &skirmishAiCallback_Game_getCategoryFlag;
-	callback->Game_getCategoriesFlag = &skirmishAiCallback_Game_getCategoriesFlag;
-	callback->Game_getCategoryName = &skirmishAiCallback_Game_getCategoryName;
-	callback->Game_getRulesParamFloat = &skirmishAiCallback_Game_getRulesParamFloat;
-	callback->Game_getRulesParamString = &skirmishAiCallback_Game_getRulesParamString;
-	callback->Cheats_isEnabled = &skirmishAiCallback_Cheats_isEnabled;
-	callback->Cheats_setEnabled = &skirmishAiCallback_Cheats_setEnabled;
-	callback->Cheats_setEventsEnabled = &skirmishAiCallback_Cheats_setEventsEnabled;
-	callback->Cheats_isOnlyPassive = &skirmishAiCallback_Cheats_isOnlyPassive;
-	callback->getResources = &skirmishAiCallback_getResources;
-	callback->getResourceByName = &skirmishAiCallback_getResourceByName;
-	callback->Resource_getName = &skirmishAiCallback_Resource_getName;
-	callback->Resource_getOptimum = &skirmishAiCallback_Resource_getOptimum;
-	callback->Economy_getCurrent = &skirmishAiCallback_Economy_getCurrent;
-	callback->Economy_getIncome = &skirmishAiCallback_Economy_getIncome;
-	callback->Economy_getUsage = &skirmishAiCallback_Economy_getUsage;
-	callback->Economy_getStorage = &skirmishAiCallback_Economy_getStorage;
-	callback->Economy_getPull = &skirmishAiCallback_Economy_getPull;
-	callback->Economy_getShare = &skirmishAiCallback_Economy_getShare;
-	callback->Economy_getSent = &skirmishAiCallback_Economy_getSent;
-	callback->Economy_getReceived = &skirmishAiCallback_Economy_getReceived;
-	callback->Economy_getExcess = &skirmishAiCallback_Economy_getExcess;
-	callback->File_getSize = &skirmishAiCallback_File_getSize;
-	callback->File_getContent = &skirmishAiCallback_File_getContent;
-	callback->getUnitDefs = &skirmishAiCallback_getUnitDefs;
-	callback->getUnitDefByName = &skirmishAiCallback_getUnitDefByName;
-	callback->UnitDef_getHeight = &skirmishAiCallback_UnitDef_getHeight;
-	callback->UnitDef_getRadius = &skirmishAiCallback_UnitDef_getRadius;
-	callback->UnitDef_getName = &skirmishAiCallback_UnitDef_getName;
-	callback->UnitDef_getHumanName = &skirmishAiCallback_UnitDef_getHumanName;
-	callback->UnitDef_getUpkeep = &skirmishAiCallback_UnitDef_getUpkeep;
-	callback->UnitDef_getResourceMake = &skirmishAiCallback_UnitDef_getResourceMake;
-	callback->UnitDef_getMakesResource = &skirmishAiCallback_UnitDef_getMakesResource;
-	callback->UnitDef_getCost = &skirmishAiCallback_UnitDef_getCost;
-	callback->UnitDef_getExtractsResource = &skirmishAiCallback_UnitDef_getExtractsResource;
-	callback->UnitDef_getResourceExtractorRange = &skirmishAiCallback_UnitDef_getResourceExtractorRange;
-	callback->UnitDef_getWindResourceGenerator = &skirmishAiCallback_UnitDef_getWindResourceGenerator;
-	callback->UnitDef_getTidalResourceGenerator = &skirmishAiCallback_UnitDef_getTidalResourceGenerator;
-	callback->UnitDef_getStorage = &skirmishAiCallback_UnitDef_getStorage;
-	callback->UnitDef_getBuildTime = &skirmishAiCallback_UnitDef_getBuildTime;
-	callback->UnitDef_getAutoHeal = &skirmishAiCallback_UnitDef_getAutoHeal;
-	callback->UnitDef_getIdleAutoHeal = &skirmishAiCallback_UnitDef_getIdleAutoHeal;
-	callback->UnitDef_getIdleTime = &skirmishAiCallback_UnitDef_getIdleTime;
-	callback->UnitDef_getPower = &skirmishAiCallback_UnitDef_getPower;
-	callback->UnitDef_getHealth = &skirmishAiCallback_UnitDef_getHealth;
-	callback->UnitDef_getCategory = &skirmishAiCallback_UnitDef_getCategory;
-	callback->UnitDef_getSpeed = &skirmishAiCallback_UnitDef_getSpeed;
-	callback->UnitDef_getTurnRate = &skirmishAiCallback_UnitDef_getTurnRate;
-	callback->UnitDef_isTurnInPlace = &skirmishAiCallback_UnitDef_isTurnInPlace;
-	callback->UnitDef_getTurnInPlaceDistance = &skirmishAiCallback_UnitDef_getTurnInPlaceDistance;
-	callback->UnitDef_getTurnInPlaceSpeedLimit = &skirmishAiCallback_UnitDef_getTurnInPlaceSpeedLimit;
-	callback->UnitDef_isUpright = &skirmishAiCallback_UnitDef_isUpright;
-	callback->UnitDef_isCollide = &skirmishAiCallback_UnitDef_isCollide;
-	callback->UnitDef_getLosRadius = &skirmishAiCallback_UnitDef_getLosRadius;
-	callback->UnitDef_getAirLosRadius = &skirmishAiCallback_UnitDef_getAirLosRadius;
-	callback->UnitDef_getLosHeight = &skirmishAiCallback_UnitDef_getLosHeight;
-	callback->UnitDef_getRadarRadius = &skirmishAiCallback_UnitDef_getRadarRadius;
-	callback->UnitDef_getSonarRadius = &skirmishAiCallback_UnitDef_getSonarRadius;
-	callback->UnitDef_getJammerRadius = &skirmishAiCallback_UnitDef_getJammerRadius;
-	callback->UnitDef_getSonarJamRadius = &skirmishAiCallback_UnitDef_getSonarJamRadius;
-	callback->UnitDef_getSeismicRadius = &skirmishAiCallback_UnitDef_getSeismicRadius;
-	callback->UnitDef_getSeismicSignature = &skirmishAiCallback_UnitDef_getSeismicSignature;
-	callback->UnitDef_isStealth = &skirmishAiCallback_UnitDef_isStealth;
-	callback->UnitDef_isSonarStealth = &skirmishAiCallback_UnitDef_isSonarStealth;
-	callback->UnitDef_isBuildRange3D = &skirmishAiCallback_UnitDef_isBuildRange3D;
-	callback->UnitDef_getBuildDistance = &skirmishAiCallback_UnitDef_getBuildDistance;
-	callback->UnitDef_getBuildSpeed = &skirmishAiCallback_UnitDef_getBuildSpeed;
-	callback->UnitDef_getReclaimSpeed = &skirmishAiCallback_UnitDef_getReclaimSpeed;
-	callback->UnitDef_getRepairSpeed = &skirmishAiCallback_UnitDef_getRepairSpeed;
-	callback->UnitDef_getMaxRepairSpeed = &skirmishAiCallback_UnitDef_getMaxRepairSpeed;
-	callback->UnitDef_getResurrectSpeed = &skirmishAiCallback_UnitDef_getResurrectSpeed;
-	callback->UnitDef_getCaptureSpeed = &skirmishAiCallback_UnitDef_getCaptureSpeed;
-	callback->UnitDef_getTerraformSpeed = &skirmishAiCallback_UnitDef_getTerraformSpeed;
-	callback->UnitDef_getUpDirSmoothing = &skirmishAiCallback_UnitDef_getUpDirSmoothing;
-	callback->UnitDef_getMass = &skirmishAiCallback_UnitDef_getMass;
-	callback->UnitDef_isPushResistant = &skirmishAiCallback_UnitDef_isPushResistant;
-	callback->UnitDef_isStrafeToAttack = &skirmishAiCallback_UnitDef_isStrafeToAttack;
-	callback->UnitDef_getMinCollisionSpeed = &skirmishAiCallback_UnitDef_getMinCollisionSpeed;
-	callback->UnitDef_getSlideTolerance = &skirmishAiCallback_UnitDef_getSlideTolerance;
-	callback->UnitDef_getMaxHeightDif = &skirmishAiCallback_UnitDef_getMaxHeightDif;
-	callback->UnitDef_getMinWaterDepth = &skirmishAiCallback_UnitDef_getMinWaterDepth;
-	callback->UnitDef_getWaterline = &skirmishAiCallback_UnitDef_getWaterline;
-	callback->UnitDef_getMaxWaterDepth = &skirmishAiCallback_UnitDef_getMaxWaterDepth;
-	callback->UnitDef_getArmoredMultiple = &skirmishAiCallback_UnitDef_getArmoredMultiple;
-	callback->UnitDef_getArmorType = &skirmishAiCallback_UnitDef_getArmorType;
-	callback->UnitDef_FlankingBonus_getMode = &skirmishAiCallback_UnitDef_FlankingBonus_getMode;
-	callback->UnitDef_FlankingBonus_getDir = &skirmishAiCallback_UnitDef_FlankingBonus_getDir;
-	callback->UnitDef_FlankingBonus_getMax = &skirmishAiCallback_UnitDef_FlankingBonus_getMax;
-	callback->UnitDef_FlankingBonus_getMin = &skirmishAiCallback_UnitDef_FlankingBonus_getMin;
-	callback->UnitDef_FlankingBonus_getMobilityAdd = &skirmishAiCallback_UnitDef_FlankingBonus_getMobilityAdd;
-	callback->UnitDef_getMaxWeaponRange = &skirmishAiCallback_UnitDef_getMaxWeaponRange;
-	callback->UnitDef_getTooltip = &skirmishAiCallback_UnitDef_getTooltip;
-	callback->UnitDef_getWreckName = &skirmishAiCallback_UnitDef_getWreckName;
-	callback->UnitDef_getDeathExplosion = &skirmishAiCallback_UnitDef_getDeathExplosion;
-	callback->UnitDef_getSelfDExplosion = &skirmishAiCallback_UnitDef_getSelfDExplosion;
-	callback->UnitDef_getCategoryString = &skirmishAiCallback_UnitDef_getCategoryString;
-	callback->UnitDef_isAbleToSelfD = &skirmishAiCallback_UnitDef_isAbleToSelfD;
-	callback->UnitDef_getSelfDCountdown = &skirmishAiCallback_UnitDef_getSelfDCountdown;
-	callback->UnitDef_isAbleToSubmerge = &skirmishAiCallback_UnitDef_isAbleToSubmerge;
-	callback->UnitDef_isAbleToFly = &skirmishAiCallback_UnitDef_isAbleToFly;
-	callback->UnitDef_isAbleToMove = &skirmishAiCallback_UnitDef_isAbleToMove;
-	callback->UnitDef_isAbleToHover = &skirmishAiCallback_UnitDef_isAbleToHover;
-	callback->UnitDef_isFloater = &skirmishAiCallback_UnitDef_isFloater;
-	callback->UnitDef_isBuilder = &skirmishAiCallback_UnitDef_isBuilder;
-	callback->UnitDef_isActivateWhenBuilt = &skirmishAiCallback_UnitDef_isActivateWhenBuilt;
-	callback->UnitDef_isOnOffable = &skirmishAiCallback_UnitDef_isOnOffable;
-	callback->UnitDef_isFullHealthFactory = &skirmishAiCallback_UnitDef_isFullHealthFactory;
-	callback->UnitDef_isFactoryHeadingTakeoff = &skirmishAiCallback_UnitDef_isFactoryHeadingTakeoff;
-	callback->UnitDef_isReclaimable = &skirmishAiCallback_UnitDef_isReclaimable;
-	callback->UnitDef_isCapturable = &skirmishAiCallback_UnitDef_isCapturable;
-	callback->UnitDef_isAbleToRestore = &skirmishAiCallback_UnitDef_isAbleToRestore;
-	callback->UnitDef_isAbleToRepair = &skirmishAiCallback_UnitDef_isAbleToRepair;
-	callback->UnitDef_isAbleToSelfRepair = &skirmishAiCallback_UnitDef_isAbleToSelfRepair;
-	callback->UnitDef_isAbleToReclaim = &skirmishAiCallback_UnitDef_isAbleToReclaim;
-	callback->UnitDef_isAbleToAttack = &skirmishAiCallback_UnitDef_isAbleToAttack;
-	callback->UnitDef_isAbleToPatrol = &skirmishAiCallback_UnitDef_isAbleToPatrol;
-	callback->UnitDef_isAbleToFight = &skirmishAiCallback_UnitDef_isAbleToFight;
-	callback->UnitDef_isAbleToGuard = &skirmishAiCallback_UnitDef_isAbleToGuard;
-	callback->UnitDef_isAbleToAssist = &skirmishAiCallback_UnitDef_isAbleToAssist;
-	callback->UnitDef_isAssistable = &skirmishAiCallback_UnitDef_isAssistable;
-	callback->UnitDef_isAbleToRepeat = &skirmishAiCallback_UnitDef_isAbleToRepeat;
-	callback->UnitDef_isAbleToFireControl = &skirmishAiCallback_UnitDef_isAbleToFireControl;
-	callback->UnitDef_getFireState = &skirmishAiCallback_UnitDef_getFireState;
-	callback->UnitDef_getMoveState = &skirmishAiCallback_UnitDef_getMoveState;
-	callback->UnitDef_getWingDrag = &skirmishAiCallback_UnitDef_getWingDrag;
-	callback->UnitDef_getWingAngle = &skirmishAiCallback_UnitDef_getWingAngle;
-	callback->UnitDef_getFrontToSpeed = &skirmishAiCallback_UnitDef_getFrontToSpeed;
-	callback->UnitDef_getSpeedToFront = &skirmishAiCallback_UnitDef_getSpeedToFront;
-	callback->UnitDef_getMyGravity = &skirmishAiCallback_UnitDef_getMyGravity;
-	callback->UnitDef_getMaxBank = &skirmishAiCallback_UnitDef_getMaxBank;
-	callback->UnitDef_getMaxPitch = &skirmishAiCallback_UnitDef_getMaxPitch;
-	callback->UnitDef_getTurnRadius = &skirmishAiCallback_UnitDef_getTurnRadius;
-	callback->UnitDef_getWantedHeight = &skirmishAiCallback_UnitDef_getWantedHeight;
-	callback->UnitDef_getVerticalSpeed = &skirmishAiCallback_UnitDef_getVerticalSpeed;
-
-	callback->UnitDef_isHoverAttack = &skirmishAiCallback_UnitDef_isHoverAttack;
-	callback->UnitDef_isAirStrafe = &skirmishAiCallback_UnitDef_isAirStrafe;
-
-	callback->UnitDef_getDlHoverFactor = &skirmishAiCallback_UnitDef_getDlHoverFactor;
-	callback->UnitDef_getMaxAcceleration = &skirmishAiCallback_UnitDef_getMaxAcceleration;
-	callback->UnitDef_getMaxDeceleration = &skirmishAiCallback_UnitDef_getMaxDeceleration;
-	callback->UnitDef_getMaxAileron = &skirmishAiCallback_UnitDef_getMaxAileron;
-	callback->UnitDef_getMaxElevator = &skirmishAiCallback_UnitDef_getMaxElevator;
-	callback->UnitDef_getMaxRudder = &skirmishAiCallback_UnitDef_getMaxRudder;
-	callback->UnitDef_getYardMap = &skirmishAiCallback_UnitDef_getYardMap;
-	callback->UnitDef_getXSize = &skirmishAiCallback_UnitDef_getXSize;
-	callback->UnitDef_getZSize = &skirmishAiCallback_UnitDef_getZSize;
-	callback->UnitDef_getLoadingRadius = &skirmishAiCallback_UnitDef_getLoadingRadius;
-	callback->UnitDef_getUnloadSpread = &skirmishAiCallback_UnitDef_getUnloadSpread;
-	callback->UnitDef_getTransportCapacity = &skirmishAiCallback_UnitDef_getTransportCapacity;
-	callback->UnitDef_getTransportSize = &skirmishAiCallback_UnitDef_getTransportSize;
-	callback->UnitDef_getMinTransportSize = &skirmishAiCallback_UnitDef_getMinTransportSize;
-	callback->UnitDef_isAirBase = &skirmishAiCallback_UnitDef_isAirBase;
-	callback->UnitDef_isFirePlatform = &skirmishAiCallback_UnitDef_isFirePlatform;
-	callback->UnitDef_getTransportMass = &skirmishAiCallback_UnitDef_getTransportMass;
-	callback->UnitDef_getMinTransportMass = &skirmishAiCallback_UnitDef_getMinTransportMass;
-	callback->UnitDef_isHoldSteady = &skirmishAiCallback_UnitDef_isHoldSteady;
-	callback->UnitDef_isReleaseHeld = &skirmishAiCallback_UnitDef_isReleaseHeld;
-	callback->UnitDef_isNotTransportable = &skirmishAiCallback_UnitDef_isNotTransportable;
-	callback->UnitDef_isTransportByEnemy = &skirmishAiCallback_UnitDef_isTransportByEnemy;
-	callback->UnitDef_getTransportUnloadMethod = &skirmishAiCallback_UnitDef_getTransportUnloadMethod;
-	callback->UnitDef_getFallSpeed = &skirmishAiCallback_UnitDef_getFallSpeed;
-	callback->UnitDef_getUnitFallSpeed = &skirmishAiCallback_UnitDef_getUnitFallSpeed;
-	callback->UnitDef_isAbleToCloak = &skirmishAiCallback_UnitDef_isAbleToCloak;
-	callback->UnitDef_isStartCloaked = &skirmishAiCallback_UnitDef_isStartCloaked;
-	callback->UnitDef_getCloakCost = &skirmishAiCallback_UnitDef_getCloakCost;
-	callback->UnitDef_getCloakCostMoving = &skirmishAiCallback_UnitDef_getCloakCostMoving;
-	callback->UnitDef_getDecloakDistance = &skirmishAiCallback_UnitDef_getDecloakDistance;
-	callback->UnitDef_isDecloakSpherical = &skirmishAiCallback_UnitDef_isDecloakSpherical;
-	callback->UnitDef_isDecloakOnFire = &skirmishAiCallback_UnitDef_isDecloakOnFire;
-	callback->UnitDef_isAbleToKamikaze = &skirmishAiCallback_UnitDef_isAbleToKamikaze;
-	callback->UnitDef_getKamikazeDist = &skirmishAiCallback_UnitDef_getKamikazeDist;
-	callback->UnitDef_isTargetingFacility = &skirmishAiCallback_UnitDef_isTargetingFacility;
-	callback->UnitDef_canManualFire = &skirmishAiCallback_UnitDef_canManualFire;
-	callback->UnitDef_isNeedGeo = &skirmishAiCallback_UnitDef_isNeedGeo;
-	callback->UnitDef_isFeature = &skirmishAiCallback_UnitDef_isFeature;
-	callback->UnitDef_isHideDamage = &skirmishAiCallback_UnitDef_isHideDamage;
-	callback->UnitDef_isShowPlayerName = &skirmishAiCallback_UnitDef_isShowPlayerName;
-	callback->UnitDef_isAbleToResurrect = &skirmishAiCallback_UnitDef_isAbleToResurrect;
-	callback->UnitDef_isAbleToCapture = &skirmishAiCallback_UnitDef_isAbleToCapture;
-	callback->UnitDef_getHighTrajectoryType = &skirmishAiCallback_UnitDef_getHighTrajectoryType;
-	callback->UnitDef_getNoChaseCategory = &skirmishAiCallback_UnitDef_getNoChaseCategory;
-	callback->UnitDef_isAbleToDropFlare = &skirmishAiCallback_UnitDef_isAbleToDropFlare;
-	callback->UnitDef_getFlareReloadTime = &skirmishAiCallback_UnitDef_getFlareReloadTime;
-	callback->UnitDef_getFlareEfficiency = &skirmishAiCallback_UnitDef_getFlareEfficiency;
-	callback->UnitDef_getFlareDelay = &skirmishAiCallback_UnitDef_getFlareDelay;
-	callback->UnitDef_getFlareDropVector = &skirmishAiCallback_UnitDef_getFlareDropVector;
-	callback->UnitDef_getFlareTime = &skirmishAiCallback_UnitDef_getFlareTime;
-	callback->UnitDef_getFlareSalvoSize = &skirmishAiCallback_UnitDef_getFlareSalvoSize;
-	callback->UnitDef_getFlareSalvoDelay = &skirmishAiCallback_UnitDef_getFlareSalvoDelay;
-	callback->UnitDef_isAbleToLoopbackAttack = &skirmishAiCallback_UnitDef_isAbleToLoopbackAttack;
-	callback->UnitDef_isLevelGround = &skirmishAiCallback_UnitDef_isLevelGround;
-	callback->UnitDef_getMaxThisUnit = &skirmishAiCallback_UnitDef_getMaxThisUnit;
-	callback->UnitDef_getDecoyDef = &skirmishAiCallback_UnitDef_getDecoyDef;
-	callback->UnitDef_isDontLand = &skirmishAiCallback_UnitDef_isDontLand;
-	callback->UnitDef_getShieldDef = &skirmishAiCallback_UnitDef_getShieldDef;
-	callback->UnitDef_getStockpileDef = &skirmishAiCallback_UnitDef_getStockpileDef;
-	callback->UnitDef_getBuildOptions = &skirmishAiCallback_UnitDef_getBuildOptions;
-	callback->UnitDef_getCustomParams = &skirmishAiCallback_UnitDef_getCustomParams;
-	callback->UnitDef_isMoveDataAvailable = &skirmishAiCallback_UnitDef_isMoveDataAvailable;
-	callback->UnitDef_MoveData_getXSize = &skirmishAiCallback_UnitDef_MoveData_getXSize;
-	callback->UnitDef_MoveData_getZSize = &skirmishAiCallback_UnitDef_MoveData_getZSize;
-	callback->UnitDef_MoveData_getDepth = &skirmishAiCallback_UnitDef_MoveData_getDepth;
-	callback->UnitDef_MoveData_getMaxSlope = &skirmishAiCallback_UnitDef_MoveData_getMaxSlope;
-	callback->UnitDef_MoveData_getSlopeMod = &skirmishAiCallback_UnitDef_MoveData_getSlopeMod;
-	callback->UnitDef_MoveData_getDepthMod = &skirmishAiCallback_UnitDef_MoveData_getDepthMod;
-	callback->UnitDef_MoveData_getPathType = &skirmishAiCallback_UnitDef_MoveData_getPathType;
-	callback->UnitDef_MoveData_getCrushStrength = &skirmishAiCallback_UnitDef_MoveData_getCrushStrength;
-	callback->UnitDef_MoveData_getSpeedModClass = &skirmishAiCallback_UnitDef_MoveData_getSpeedModClass;
-	callback->UnitDef_MoveData_getTerrainClass = &skirmishAiCallback_UnitDef_MoveData_getTerrainClass;
-	callback->UnitDef_MoveData_getFollowGround = &skirmishAiCallback_UnitDef_MoveData_getFollowGround;
-	callback->UnitDef_MoveData_isSubMarine = &skirmishAiCallback_UnitDef_MoveData_isSubMarine;
-	callback->UnitDef_MoveData_getName = &skirmishAiCallback_UnitDef_MoveData_getName;
-	callback->UnitDef_getWeaponMounts = &skirmishAiCallback_UnitDef_getWeaponMounts;
-	callback->UnitDef_WeaponMount_getName = &skirmishAiCallback_UnitDef_WeaponMount_getName;
-	callback->UnitDef_WeaponMount_getWeaponDef = &skirmishAiCallback_UnitDef_WeaponMount_getWeaponDef;
-	callback->UnitDef_WeaponMount_getSlavedTo = &skirmishAiCallback_UnitDef_WeaponMount_getSlavedTo;
-	callback->UnitDef_WeaponMount_getMainDir = &skirmishAiCallback_UnitDef_WeaponMount_getMainDir;
-	callback->UnitDef_WeaponMount_getMaxAngleDif = &skirmishAiCallback_UnitDef_WeaponMount_getMaxAngleDif;
-	callback->UnitDef_WeaponMount_getBadTargetCategory = &skirmishAiCallback_UnitDef_WeaponMount_getBadTargetCategory;
-	callback->UnitDef_WeaponMount_getOnlyTargetCategory = &skirmishAiCallback_UnitDef_WeaponMount_getOnlyTargetCategory;
-	callback->Unit_getLimit = &skirmishAiCallback_Unit_getLimit;
-	callback->Unit_getMax = &skirmishAiCallback_Unit_getMax;
-	callback->getEnemyUnits = &skirmishAiCallback_getEnemyUnits;
-	callback->getEnemyUnitsIn = &skirmishAiCallback_getEnemyUnitsIn;
-	callback->getEnemyUnitsInRadarAndLos = &skirmishAiCallback_getEnemyUnitsInRadarAndLos;
-	callback->getFriendlyUnits = &skirmishAiCallback_getFriendlyUnits;
-	callback->getFriendlyUnitsIn = &skirmishAiCallback_getFriendlyUnitsIn;
-	callback->getNeutralUnits = &skirmishAiCallback_getNeutralUnits;
-	callback->getNeutralUnitsIn = &skirmishAiCallback_getNeutralUnitsIn;
-	callback->getTeamUnits = &skirmishAiCallback_getTeamUnits;
-	callback->getSelectedUnits = &skirmishAiCallback_getSelectedUnits;
-	callback->Unit_getDef = &skirmishAiCallback_Unit_getDef;
-	callback->Unit_getRulesParamFloat = &skirmishAiCallback_Unit_getRulesParamFloat;
-	callback->Unit_getRulesParamString = &skirmishAiCallback_Unit_getRulesParamString;
-	callback->Unit_getTeam = &skirmishAiCallback_Unit_getTeam;
-	callback->Unit_getAllyTeam = &skirmishAiCallback_Unit_getAllyTeam;
-	callback->Unit_getStockpile = &skirmishAiCallback_Unit_getStockpile;
-	callback->Unit_getStockpileQueued = &skirmishAiCallback_Unit_getStockpileQueued;
-	callback->Unit_getMaxSpeed = &skirmishAiCallback_Unit_getMaxSpeed;
-	callback->Unit_getMaxRange = &skirmishAiCallback_Unit_getMaxRange;
-	callback->Unit_getMaxHealth = &skirmishAiCallback_Unit_getMaxHealth;
-	callback->Unit_getExperience = &skirmishAiCallback_Unit_getExperience;
-	callback->Unit_getGroup = &skirmishAiCallback_Unit_getGroup;
-	callback->Unit_getCurrentCommands = &skirmishAiCallback_Unit_getCurrentCommands;
-	callback->Unit_CurrentCommand_getType = &skirmishAiCallback_Unit_CurrentCommand_getType;
-	callback->Unit_CurrentCommand_getId = &skirmishAiCallback_Unit_CurrentCommand_getId;
-	callback->Unit_CurrentCommand_getOptions = &skirmishAiCallback_Unit_CurrentCommand_getOptions;
-	callback->Unit_CurrentCommand_getTag = &skirmishAiCallback_Unit_CurrentCommand_getTag;
-	callback->Unit_CurrentCommand_getTimeOut = &skirmishAiCallback_Unit_CurrentCommand_getTimeOut;
-	callback->Unit_CurrentCommand_getParams = &skirmishAiCallback_Unit_CurrentCommand_getParams;
-	callback->Unit_getSupportedCommands = &skirmishAiCallback_Unit_getSupportedCommands;
-	callback->Unit_SupportedCommand_getId = &skirmishAiCallback_Unit_SupportedCommand_getId;
-	callback->Unit_SupportedCommand_getName = &skirmishAiCallback_Unit_SupportedCommand_getName;
-	callback->Unit_SupportedCommand_getToolTip = &skirmishAiCallback_Unit_SupportedCommand_getToolTip;
-	callback->Unit_SupportedCommand_isShowUnique = &skirmishAiCallback_Unit_SupportedCommand_isShowUnique;
-	callback->Unit_SupportedCommand_isDisabled = &skirmishAiCallback_Unit_SupportedCommand_isDisabled;
-	callback->Unit_SupportedCommand_getParams = &skirmishAiCallback_Unit_SupportedCommand_getParams;
-	callback->Unit_getHealth = &skirmishAiCallback_Unit_getHealth;
-	callback->Unit_getParalyzeDamage = &skirmishAiCallback_Unit_getParalyzeDamage;
-	callback->Unit_getCaptureProgress = &skirmishAiCallback_Unit_getCaptureProgress;
-	callback->Unit_getBuildProgress = &skirmishAiCallback_Unit_getBuildProgress;
-	callback->Unit_getSpeed = &skirmishAiCallback_Unit_getSpeed;
-	callback->Unit_getPower = &skirmishAiCallback_Unit_getPower;
-	callback->Unit_getResourceUse = &skirmishAiCallback_Unit_getResourceUse;
-	callback->Unit_getResourceMake = &skirmishAiCallback_Unit_getResourceMake;
-	callback->Unit_getPos = &skirmishAiCallback_Unit_getPos;
-	callback->Unit_getVel = &skirmishAiCallback_Unit_getVel;
-	callback->Unit_isActivated = &skirmishAiCallback_Unit_isActivated;
-	callback->Unit_isBeingBuilt = &skirmishAiCallback_Unit_isBeingBuilt;
-	callback->Unit_isCloaked = &skirmishAiCallback_Unit_isCloaked;
-	callback->Unit_isParalyzed = &skirmishAiCallback_Unit_isParalyzed;
-	callback->Unit_isNeutral = &skirmishAiCallback_Unit_isNeutral;
-	callback->Unit_getBuildingFacing = &skirmishAiCallback_Unit_getBuildingFacing;
-	callback->Unit_getLastUserOrderFrame = &skirmishAiCallback_Unit_getLastUserOrderFrame;
-	callback->Unit_getWeapons = &skirmishAiCallback_Unit_getWeapons;
-	callback->Unit_getWeapon = &skirmishAiCallback_Unit_getWeapon;
-	callback->Team_hasAIController = &skirmishAiCallback_Team_hasAIController;
-	callback->getEnemyTeams = &skirmishAiCallback_getEnemyTeams;
-	callback->getAlliedTeams = &skirmishAiCallback_getAlliedTeams;
-	callback->Team_getRulesParamFloat = &skirmishAiCallback_Team_getRulesParamFloat;
-	callback->Team_getRulesParamString = &skirmishAiCallback_Team_getRulesParamString;
-	callback->getGroups = &skirmishAiCallback_getGroups;
-	callback->Group_getSupportedCommands = &skirmishAiCallback_Group_getSupportedCommands;
-	callback->Group_SupportedCommand_getId = &skirmishAiCallback_Group_SupportedCommand_getId;
-	callback->Group_SupportedCommand_getName = &skirmishAiCallback_Group_SupportedCommand_getName;
-	callback->Group_SupportedCommand_getToolTip = &skirmishAiCallback_Group_SupportedCommand_getToolTip;
-	callback->Group_SupportedCommand_isShowUnique = &skirmishAiCallback_Group_SupportedCommand_isShowUnique;
-	callback->Group_SupportedCommand_isDisabled = &skirmishAiCallback_Group_SupportedCommand_isDisabled;
-	callback->Group_SupportedCommand_getParams = &skirmishAiCallback_Group_SupportedCommand_getParams;
-	callback->Group_OrderPreview_getId = &skirmishAiCallback_Group_OrderPreview_getId;
-	callback->Group_OrderPreview_getOptions = &skirmishAiCallback_Group_OrderPreview_getOptions;
-	callback->Group_OrderPreview_getTag = &skirmishAiCallback_Group_OrderPreview_getTag;
-	callback->Group_OrderPreview_getTimeOut = &skirmishAiCallback_Group_OrderPreview_getTimeOut;
-	callback->Group_OrderPreview_getParams = &skirmishAiCallback_Group_OrderPreview_getParams;
-	callback->Group_isSelected = &skirmishAiCallback_Group_isSelected;
-	callback->Mod_getFileName = &skirmishAiCallback_Mod_getFileName;
-	callback->Mod_getHash = &skirmishAiCallback_Mod_getHash;
-	callback->Mod_getHumanName = &skirmishAiCallback_Mod_getHumanName;
-	callback->Mod_getShortName = &skirmishAiCallback_Mod_getShortName;
-	callback->Mod_getVersion = &skirmishAiCallback_Mod_getVersion;
-	callback->Mod_getMutator = &skirmishAiCallback_Mod_getMutator;
-	callback->Mod_getDescription = &skirmishAiCallback_Mod_getDescription;
-	callback->Mod_getConstructionDecay = &skirmishAiCallback_Mod_getConstructionDecay;
-	callback->Mod_getConstructionDecayTime = &skirmishAiCallback_Mod_getConstructionDecayTime;
-	callback->Mod_getConstructionDecaySpeed = &skirmishAiCallback_Mod_getConstructionDecaySpeed;
-	callback->Mod_getMultiReclaim = &skirmishAiCallback_Mod_getMultiReclaim;
-	callback->Mod_getReclaimMethod = &skirmishAiCallback_Mod_getReclaimMethod;
-	callback->Mod_getReclaimUnitMethod = &skirmishAiCallback_Mod_getReclaimUnitMethod;
-	callback->Mod_getReclaimUnitEnergyCostFactor = &skirmishAiCallback_Mod_getReclaimUnitEnergyCostFactor;
-	callback->Mod_getReclaimUnitEfficiency = &skirmishAiCallback_Mod_getReclaimUnitEfficiency;
-	callback->Mod_getReclaimFeatureEnergyCostFactor = &skirmishAiCallback_Mod_getReclaimFeatureEnergyCostFactor;
-	callback->Mod_getReclaimAllowEnemies = &skirmishAiCallback_Mod_getReclaimAllowEnemies;
-	callback->Mod_getReclaimAllowAllies = &skirmishAiCallback_Mod_getReclaimAllowAllies;
-	callback->Mod_getRepairEnergyCostFactor = &skirmishAiCallback_Mod_getRepairEnergyCostFactor;
-	callback->Mod_getResurrectEnergyCostFactor = &skirmishAiCallback_Mod_getResurrectEnergyCostFactor;
-	callback->Mod_getCaptureEnergyCostFactor = &skirmishAiCallback_Mod_getCaptureEnergyCostFactor;
-	callback->Mod_getTransportGround = &skirmishAiCallback_Mod_getTransportGround;
-	callback->Mod_getTransportHover = &skirmishAiCallback_Mod_getTransportHover;
-	callback->Mod_getTransportShip = &skirmishAiCallback_Mod_getTransportShip;
-	callback->Mod_getTransportAir = &skirmishAiCallback_Mod_getTransportAir;
-	callback->Mod_getFireAtKilled = &skirmishAiCallback_Mod_getFireAtKilled;
-	callback->Mod_getFireAtCrashing = &skirmishAiCallback_Mod_getFireAtCrashing;
-	callback->Mod_getFlankingBonusModeDefault = &skirmishAiCallback_Mod_getFlankingBonusModeDefault;
-	callback->Mod_getLosMipLevel = &skirmishAiCallback_Mod_getLosMipLevel;
-	callback->Mod_getAirMipLevel = &skirmishAiCallback_Mod_getAirMipLevel;
-	callback->Mod_getRadarMipLevel = &skirmishAiCallback_Mod_getRadarMipLevel;
-	callback->Mod_getRequireSonarUnderWater = &skirmishAiCallback_Mod_getRequireSonarUnderWater;
-	callback->Map_getChecksum = &skirmishAiCallback_Map_getChecksum;
-	callback->Map_getStartPos = &skirmishAiCallback_Map_getStartPos;
-	callback->Map_getMousePos = &skirmishAiCallback_Map_getMousePos;
-	callback->Map_isPosInCamera = &skirmishAiCallback_Map_isPosInCamera;
-	callback->Map_getWidth = &skirmishAiCallback_Map_getWidth;
-	callback->Map_getHeight = &skirmishAiCallback_Map_getHeight;
-	callback->Map_getHeightMap = &skirmishAiCallback_Map_getHeightMap;
-	callback->Map_getCornersHeightMap = &skirmishAiCallback_Map_getCornersHeightMap;
-	callback->Map_getMinHeight = &skirmishAiCallback_Map_getMinHeight;
-	callback->Map_getMaxHeight = &skirmishAiCallback_Map_getMaxHeight;
-	callback->Map_getSlopeMap = &skirmishAiCallback_Map_getSlopeMap;
-	callback->Map_getLosMap = &skirmishAiCallback_Map_getLosMap;
-	callback->Map_getAirLosMap = &skirmishAiCallback_Map_getAirLosMap;
-	callback->Map_getRadarMap = &skirmishAiCallback_Map_getRadarMap;
-	callback->Map_getSonarMap = &skirmishAiCallback_Map_getSonarMap;
-	callback->Map_getSeismicMap = &skirmishAiCallback_Map_getSeismicMap;
-	callback->Map_getJammerMap = &skirmishAiCallback_Map_getJammerMap;
-	callback->Map_getSonarJammerMap = &skirmishAiCallback_Map_getSonarJammerMap;
-	callback->Map_getResourceMapRaw = &skirmishAiCallback_Map_getResourceMapRaw;
-	callback->Map_getResourceMapSpotsPositions = &skirmishAiCallback_Map_getResourceMapSpotsPositions;
-	callback->Map_getResourceMapSpotsAverageIncome = &skirmishAiCallback_Map_getResourceMapSpotsAverageIncome;
-	callback->Map_getResourceMapSpotsNearest = &skirmishAiCallback_Map_getResourceMapSpotsNearest;
-	callback->Map_getHash = &skirmishAiCallback_Map_getHash;
-	callback->Map_getName = &skirmishAiCallback_Map_getName;
-	callback->Map_getHumanName = &skirmishAiCallback_Map_getHumanName;
-	callback->Map_getElevationAt = &skirmishAiCallback_Map_getElevationAt;
-	callback->Map_getMaxResource = &skirmishAiCallback_Map_getMaxResource;
-	callback->Map_getExtractorRadius = &skirmishAiCallback_Map_getExtractorRadius;
-	callback->Map_getMinWind = &skirmishAiCallback_Map_getMinWind;
-	callback->Map_getMaxWind = &skirmishAiCallback_Map_getMaxWind;
-	callback->Map_getCurWind = &skirmishAiCallback_Map_getCurWind;
-	callback->Map_getTidalStrength = &skirmishAiCallback_Map_getTidalStrength;
-	callback->Map_getGravity = &skirmishAiCallback_Map_getGravity;
-	callback->Map_getWaterDamage = &skirmishAiCallback_Map_getWaterDamage;
-	callback->Map_isDeformable = &skirmishAiCallback_Map_isDeformable;
-	callback->Map_getHardness = &skirmishAiCallback_Map_getHardness;
-	callback->Map_getHardnessModMap = &skirmishAiCallback_Map_getHardnessModMap;
-	callback->Map_getSpeedModMap = &skirmishAiCallback_Map_getSpeedModMap;
-	callback->Map_getPoints = &skirmishAiCallback_Map_getPoints;
-	callback->Map_Point_getPosition = &skirmishAiCallback_Map_Point_getPosition;
-	callback->Map_Point_getColor = &skirmishAiCallback_Map_Point_getColor;
-	callback->Map_Point_getLabel = &skirmishAiCallback_Map_Point_getLabel;
-	callback->Map_getLines = &skirmishAiCallback_Map_getLines;
-	callback->Map_Line_getFirstPosition = &skirmishAiCallback_Map_Line_getFirstPosition;
-	callback->Map_Line_getSecondPosition = &skirmishAiCallback_Map_Line_getSecondPosition;
-	callback->Map_Line_getColor = &skirmishAiCallback_Map_Line_getColor;
-	callback->Map_isPossibleToBuildAt = &skirmishAiCallback_Map_isPossibleToBuildAt;
-	callback->Map_findClosestBuildSite = &skirmishAiCallback_Map_findClosestBuildSite;
-	callback->getFeatureDefs = &skirmishAiCallback_getFeatureDefs;
-	callback->FeatureDef_getName = &skirmishAiCallback_FeatureDef_getName;
-	callback->FeatureDef_getDescription = &skirmishAiCallback_FeatureDef_getDescription;
-	callback->FeatureDef_getContainedResource = &skirmishAiCallback_FeatureDef_getContainedResource;
-	callback->FeatureDef_getMaxHealth = &skirmishAiCallback_FeatureDef_getMaxHealth;
-	callback->FeatureDef_getReclaimTime = &skirmishAiCallback_FeatureDef_getReclaimTime;
-	callback->FeatureDef_getMass = &skirmishAiCallback_FeatureDef_getMass;
-	callback->FeatureDef_isUpright = &skirmishAiCallback_FeatureDef_isUpright;
-	callback->FeatureDef_getDrawType = &skirmishAiCallback_FeatureDef_getDrawType;
-	callback->FeatureDef_getModelName = &skirmishAiCallback_FeatureDef_getModelName;
-	callback->FeatureDef_getResurrectable = &skirmishAiCallback_FeatureDef_getResurrectable;
-	callback->FeatureDef_getSmokeTime = &skirmishAiCallback_FeatureDef_getSmokeTime;
-	callback->FeatureDef_isDestructable = &skirmishAiCallback_FeatureDef_isDestructable;
-	callback->FeatureDef_isReclaimable = &skirmishAiCallback_FeatureDef_isReclaimable;
-	callback->FeatureDef_isAutoreclaimable = &skirmishAiCallback_FeatureDef_isAutoreclaimable;
-	callback->FeatureDef_isBlocking = &skirmishAiCallback_FeatureDef_isBlocking;
-	callback->FeatureDef_isBurnable = &skirmishAiCallback_FeatureDef_isBurnable;
-	callback->FeatureDef_isFloating = &skirmishAiCallback_FeatureDef_isFloating;
-	callback->FeatureDef_isNoSelect = &skirmishAiCallback_FeatureDef_isNoSelect;
-	callback->FeatureDef_isGeoThermal = &skirmishAiCallback_FeatureDef_isGeoThermal;
-	callback->FeatureDef_getXSize = &skirmishAiCallback_FeatureDef_getXSize;
-	callback->FeatureDef_getZSize = &skirmishAiCallback_FeatureDef_getZSize;
-	callback->FeatureDef_getCustomParams = &skirmishAiCallback_FeatureDef_getCustomParams;
-	callback->getFeatures = &skirmishAiCallback_getFeatures;
-	callback->getFeaturesIn = &skirmishAiCallback_getFeaturesIn;
-	callback->Feature_getDef = &skirmishAiCallback_Feature_getDef;
-	callback->Feature_getHealth = &skirmishAiCallback_Feature_getHealth;
-	callback->Feature_getReclaimLeft = &skirmishAiCallback_Feature_getReclaimLeft;
-	callback->Feature_getPosition = &skirmishAiCallback_Feature_getPosition;
-	callback->Feature_getRulesParamFloat = &skirmishAiCallback_Feature_getRulesParamFloat;
-	callback->Feature_getRulesParamString = &skirmishAiCallback_Feature_getRulesParamString;
-	callback->Feature_getResurrectDef = &skirmishAiCallback_Feature_getResurrectDef;
-	callback->Feature_getBuildingFacing = &skirmishAiCallback_Feature_getBuildingFacing;
-	callback->getWeaponDefs = &skirmishAiCallback_getWeaponDefs;
-	callback->getWeaponDefByName = &skirmishAiCallback_getWeaponDefByName;
-	callback->WeaponDef_getName = &skirmishAiCallback_WeaponDef_getName;
-	callback->WeaponDef_getType = &skirmishAiCallback_WeaponDef_getType;
-	callback->WeaponDef_getDescription = &skirmishAiCallback_WeaponDef_getDescription;
-	callback->WeaponDef_getRange = &skirmishAiCallback_WeaponDef_getRange;
-	callback->WeaponDef_getHeightMod = &skirmishAiCallback_WeaponDef_getHeightMod;
-	callback->WeaponDef_getAccuracy = &skirmishAiCallback_WeaponDef_getAccuracy;
-	callback->WeaponDef_getSprayAngle = &skirmishAiCallback_WeaponDef_getSprayAngle;
-	callback->WeaponDef_getMovingAccuracy = &skirmishAiCallback_WeaponDef_getMovingAccuracy;
-	callback->WeaponDef_getTargetMoveError = &skirmishAiCallback_WeaponDef_getTargetMoveError;
-	callback->WeaponDef_getLeadLimit = &skirmishAiCallback_WeaponDef_getLeadLimit;
-	callback->WeaponDef_getLeadBonus = &skirmishAiCallback_WeaponDef_getLeadBonus;
-	callback->WeaponDef_getPredictBoost = &skirmishAiCallback_WeaponDef_getPredictBoost;
-	callback->WeaponDef_getNumDamageTypes = &skirmishAiCallback_WeaponDef_getNumDamageTypes;
-	callback->WeaponDef_Damage_getParalyzeDamageTime = &skirmishAiCallback_WeaponDef_Damage_getParalyzeDamageTime;
-	callback->WeaponDef_Damage_getImpulseFactor = &skirmishAiCallback_WeaponDef_Damage_getImpulseFactor;
-	callback->WeaponDef_Damage_getImpulseBoost = &skirmishAiCallback_WeaponDef_Damage_getImpulseBoost;
-	callback->WeaponDef_Damage_getCraterMult = &skirmishAiCallback_WeaponDef_Damage_getCraterMult;
-	callback->WeaponDef_Damage_getCraterBoost = &skirmishAiCallback_WeaponDef_Damage_getCraterBoost;
-	callback->WeaponDef_Damage_getTypes = &skirmishAiCallback_WeaponDef_Damage_getTypes;
-	callback->WeaponDef_getAreaOfEffect = &skirmishAiCallback_WeaponDef_getAreaOfEffect;
-	callback->WeaponDef_isNoSelfDamage = &skirmishAiCallback_WeaponDef_isNoSelfDamage;
-	callback->WeaponDef_getFireStarter = &skirmishAiCallback_WeaponDef_getFireStarter;
-	callback->WeaponDef_getEdgeEffectiveness = &skirmishAiCallback_WeaponDef_getEdgeEffectiveness;
-	callback->WeaponDef_getSize = &skirmishAiCallback_WeaponDef_getSize;
-	callback->WeaponDef_getSizeGrowth = &skirmishAiCallback_WeaponDef_getSizeGrowth;
-	callback->WeaponDef_getCollisionSize = &skirmishAiCallback_WeaponDef_getCollisionSize;
-	callback->WeaponDef_getSalvoSize = &skirmishAiCallback_WeaponDef_getSalvoSize;
-	callback->WeaponDef_getSalvoDelay = &skirmishAiCallback_WeaponDef_getSalvoDelay;
-	callback->WeaponDef_getReload = &skirmishAiCallback_WeaponDef_getReload;
-	callback->WeaponDef_getBeamTime = &skirmishAiCallback_WeaponDef_getBeamTime;
-	callback->WeaponDef_isBeamBurst = &skirmishAiCallback_WeaponDef_isBeamBurst;
-	callback->WeaponDef_isWaterBounce = &skirmishAiCallback_WeaponDef_isWaterBounce;
-	callback->WeaponDef_isGroundBounce = &skirmishAiCallback_WeaponDef_isGroundBounce;
-	callback->WeaponDef_getBounceRebound = &skirmishAiCallback_WeaponDef_getBounceRebound;
-	callback->WeaponDef_getBounceSlip = &skirmishAiCallback_WeaponDef_getBounceSlip;
-	callback->WeaponDef_getNumBounce = &skirmishAiCallback_WeaponDef_getNumBounce;
-	callback->WeaponDef_getMaxAngle = &skirmishAiCallback_WeaponDef_getMaxAngle;
-	callback->WeaponDef_getUpTime = &skirmishAiCallback_WeaponDef_getUpTime;
-	callback->WeaponDef_getFlightTime = &skirmishAiCallback_WeaponDef_getFlightTime;
-	callback->WeaponDef_getCost = &skirmishAiCallback_WeaponDef_getCost;
-	callback->WeaponDef_getProjectilesPerShot = &skirmishAiCallback_WeaponDef_getProjectilesPerShot;
-	callback->WeaponDef_isTurret = &skirmishAiCallback_WeaponDef_isTurret;
-	callback->WeaponDef_isOnlyForward = &skirmishAiCallback_WeaponDef_isOnlyForward;
-	callback->WeaponDef_isFixedLauncher = &skirmishAiCallback_WeaponDef_isFixedLauncher;
-	callback->WeaponDef_isWaterWeapon = &skirmishAiCallback_WeaponDef_isWaterWeapon;
-	callback->WeaponDef_isFireSubmersed = &skirmishAiCallback_WeaponDef_isFireSubmersed;
-	callback->WeaponDef_isSubMissile = &skirmishAiCallback_WeaponDef_isSubMissile;
-	callback->WeaponDef_isTracks = &skirmishAiCallback_WeaponDef_isTracks;
-	callback->WeaponDef_isDropped = &skirmishAiCallback_WeaponDef_isDropped;
-	callback->WeaponDef_isParalyzer = &skirmishAiCallback_WeaponDef_isParalyzer;
-	callback->WeaponDef_isImpactOnly = &skirmishAiCallback_WeaponDef_isImpactOnly;
-	callback->WeaponDef_isNoAutoTarget = &skirmishAiCallback_WeaponDef_isNoAutoTarget;
-	callback->WeaponDef_isManualFire = &skirmishAiCallback_WeaponDef_isManualFire;
-	callback->WeaponDef_getInterceptor = &skirmishAiCallback_WeaponDef_getInterceptor;
-	callback->WeaponDef_getTargetable = &skirmishAiCallback_WeaponDef_getTargetable;
-	callback->WeaponDef_isStockpileable = &skirmishAiCallback_WeaponDef_isStockpileable;
-	callback->WeaponDef_getCoverageRange = &skirmishAiCallback_WeaponDef_getCoverageRange;
-	callback->WeaponDef_getStockpileTime = &skirmishAiCallback_WeaponDef_getStockpileTime;
-	callback->WeaponDef_getIntensity = &skirmishAiCallback_WeaponDef_getIntensity;
-	callback->WeaponDef_getDuration = &skirmishAiCallback_WeaponDef_getDuration;
-	callback->WeaponDef_getFalloffRate = &skirmishAiCallback_WeaponDef_getFalloffRate;
-	callback->WeaponDef_isSelfExplode = &skirmishAiCallback_WeaponDef_isSelfExplode;
-	callback->WeaponDef_isGravityAffected = &skirmishAiCallback_WeaponDef_isGravityAffected;
-	callback->WeaponDef_getHighTrajectory = &skirmishAiCallback_WeaponDef_getHighTrajectory;
-	callback->WeaponDef_getMyGravity = &skirmishAiCallback_WeaponDef_getMyGravity;
-	callback->WeaponDef_isNoExplode = &skirmishAiCallback_WeaponDef_isNoExplode;
-	callback->WeaponDef_getStartVelocity = &skirmishAiCallback_WeaponDef_getStartVelocity;
-	callback->WeaponDef_getWeaponAcceleration = &skirmishAiCallback_WeaponDef_getWeaponAcceleration;
-	callback->WeaponDef_getTurnRate = &skirmishAiCallback_WeaponDef_getTurnRate;
-	callback->WeaponDef_getMaxVelocity = &skirmishAiCallback_WeaponDef_getMaxVelocity;
-	callback->WeaponDef_getProjectileSpeed = &skirmishAiCallback_WeaponDef_getProjectileSpeed;
-	callback->WeaponDef_getExplosionSpeed = &skirmishAiCallback_WeaponDef_getExplosionSpeed;
-	callback->WeaponDef_getOnlyTargetCategory = &skirmishAiCallback_WeaponDef_getOnlyTargetCategory;
-	callback->WeaponDef_getWobble = &skirmishAiCallback_WeaponDef_getWobble;
-	callback->WeaponDef_getDance = &skirmishAiCallback_WeaponDef_getDance;
-	callback->WeaponDef_getTrajectoryHeight = &skirmishAiCallback_WeaponDef_getTrajectoryHeight;
-	callback->WeaponDef_isLargeBeamLaser = &skirmishAiCallback_WeaponDef_isLargeBeamLaser;
-	callback->WeaponDef_isShield = &skirmishAiCallback_WeaponDef_isShield;
-	callback->WeaponDef_isShieldRepulser = &skirmishAiCallback_WeaponDef_isShieldRepulser;
-	callback->WeaponDef_isSmartShield = &skirmishAiCallback_WeaponDef_isSmartShield;
-	callback->WeaponDef_isExteriorShield = &skirmishAiCallback_WeaponDef_isExteriorShield;
-	callback->WeaponDef_isVisibleShield = &skirmishAiCallback_WeaponDef_isVisibleShield;
-	callback->WeaponDef_isVisibleShieldRepulse = &skirmishAiCallback_WeaponDef_isVisibleShieldRepulse;
-	callback->WeaponDef_getVisibleShieldHitFrames = &skirmishAiCallback_WeaponDef_getVisibleShieldHitFrames;
-	callback->WeaponDef_Shield_getResourceUse = &skirmishAiCallback_WeaponDef_Shield_getResourceUse;
-	callback->WeaponDef_Shield_getRadius = &skirmishAiCallback_WeaponDef_Shield_getRadius;
-	callback->WeaponDef_Shield_getForce = &skirmishAiCallback_WeaponDef_Shield_getForce;
-	callback->WeaponDef_Shield_getMaxSpeed = &skirmishAiCallback_WeaponDef_Shield_getMaxSpeed;
-	callback->WeaponDef_Shield_getPower = &skirmishAiCallback_WeaponDef_Shield_getPower;
-	callback->WeaponDef_Shield_getPowerRegen = &skirmishAiCallback_WeaponDef_Shield_getPowerRegen;
-	callback->WeaponDef_Shield_getPowerRegenResource = &skirmishAiCallback_WeaponDef_Shield_getPowerRegenResource;
-	callback->WeaponDef_Shield_getStartingPower = &skirmishAiCallback_WeaponDef_Shield_getStartingPower;
-	callback->WeaponDef_Shield_getRechargeDelay = &skirmishAiCallback_WeaponDef_Shield_getRechargeDelay;
-	callback->WeaponDef_Shield_getInterceptType = &skirmishAiCallback_WeaponDef_Shield_getInterceptType;
-	callback->WeaponDef_getInterceptedByShieldType = &skirmishAiCallback_WeaponDef_getInterceptedByShieldType;
-	callback->WeaponDef_isAvoidFriendly = &skirmishAiCallback_WeaponDef_isAvoidFriendly;
-	callback->WeaponDef_isAvoidFeature = &skirmishAiCallback_WeaponDef_isAvoidFeature;
-	callback->WeaponDef_isAvoidNeutral = &skirmishAiCallback_WeaponDef_isAvoidNeutral;
-	callback->WeaponDef_getTargetBorder = &skirmishAiCallback_WeaponDef_getTargetBorder;
-	callback->WeaponDef_getCylinderTargetting = &skirmishAiCallback_WeaponDef_getCylinderTargetting;
-	callback->WeaponDef_getMinIntensity = &skirmishAiCallback_WeaponDef_getMinIntensity;
-	callback->WeaponDef_getHeightBoostFactor = &skirmishAiCallback_WeaponDef_getHeightBoostFactor;
-	callback->WeaponDef_getProximityPriority = &skirmishAiCallback_WeaponDef_getProximityPriority;
-	callback->WeaponDef_getCollisionFlags = &skirmishAiCallback_WeaponDef_getCollisionFlags;
-	callback->WeaponDef_isSweepFire = &skirmishAiCallback_WeaponDef_isSweepFire;
-	callback->WeaponDef_isAbleToAttackGround = &skirmishAiCallback_WeaponDef_isAbleToAttackGround;
-	callback->WeaponDef_getCameraShake = &skirmishAiCallback_WeaponDef_getCameraShake;
-	callback->WeaponDef_getDynDamageExp = &skirmishAiCallback_WeaponDef_getDynDamageExp;
-	callback->WeaponDef_getDynDamageMin = &skirmishAiCallback_WeaponDef_getDynDamageMin;
-	callback->WeaponDef_getDynDamageRange = &skirmishAiCallback_WeaponDef_getDynDamageRange;
-	callback->WeaponDef_isDynDamageInverted = &skirmishAiCallback_WeaponDef_isDynDamageInverted;
-	callback->WeaponDef_getCustomParams = &skirmishAiCallback_WeaponDef_getCustomParams;
-	callback->Unit_Weapon_getDef = &skirmishAiCallback_Unit_Weapon_getDef;
-	callback->Unit_Weapon_getReloadFrame = &skirmishAiCallback_Unit_Weapon_getReloadFrame;
-	callback->Unit_Weapon_getReloadTime = &skirmishAiCallback_Unit_Weapon_getReloadTime;
-	callback->Unit_Weapon_getRange = &skirmishAiCallback_Unit_Weapon_getRange;
-	callback->Unit_Weapon_isShieldEnabled = &skirmishAiCallback_Unit_Weapon_isShieldEnabled;
-	callback->Unit_Weapon_getShieldPower = &skirmishAiCallback_Unit_Weapon_getShieldPower;
-	callback->Debug_GraphDrawer_isEnabled = &skirmishAiCallback_Debug_GraphDrawer_isEnabled;
+	REGISTER_CALLBACK(Engine_handleCommand);
+	REGISTER_CALLBACK(Engine_executeCommand);
+
+	REGISTER_CALLBACK(Engine_Version_getMajor);
+	REGISTER_CALLBACK(Engine_Version_getMinor);
+	REGISTER_CALLBACK(Engine_Version_getPatchset);
+	REGISTER_CALLBACK(Engine_Version_getCommits);
+	REGISTER_CALLBACK(Engine_Version_getHash);
+	REGISTER_CALLBACK(Engine_Version_getBranch);
+	REGISTER_CALLBACK(Engine_Version_getAdditional);
+	REGISTER_CALLBACK(Engine_Version_getBuildTime);
+	REGISTER_CALLBACK(Engine_Version_isRelease);
+	REGISTER_CALLBACK(Engine_Version_getNormal);
+	REGISTER_CALLBACK(Engine_Version_getSync);
+	REGISTER_CALLBACK(Engine_Version_getFull);
+	REGISTER_CALLBACK(getNumTeams);
+	REGISTER_CALLBACK(getNumSkirmishAIs);
+	REGISTER_CALLBACK(getMaxSkirmishAIs);
+	REGISTER_CALLBACK(SkirmishAI_getTeamId);
+	REGISTER_CALLBACK(SkirmishAI_Info_getSize);
+	REGISTER_CALLBACK(SkirmishAI_Info_getKey);
+	REGISTER_CALLBACK(SkirmishAI_Info_getValue);
+	REGISTER_CALLBACK(SkirmishAI_Info_getDescription);
+	REGISTER_CALLBACK(SkirmishAI_Info_getValueByKey);
+	REGISTER_CALLBACK(SkirmishAI_OptionValues_getSize);
+	REGISTER_CALLBACK(SkirmishAI_OptionValues_getKey);
+	REGISTER_CALLBACK(SkirmishAI_OptionValues_getValue);
+	REGISTER_CALLBACK(SkirmishAI_OptionValues_getValueByKey);
+	REGISTER_CALLBACK(Log_log);
+	REGISTER_CALLBACK(Log_exception);
+	REGISTER_CALLBACK(DataDirs_getPathSeparator);
+	REGISTER_CALLBACK(DataDirs_getConfigDir);
+	REGISTER_CALLBACK(DataDirs_getWriteableDir);
+	REGISTER_CALLBACK(DataDirs_locatePath);
+	REGISTER_CALLBACK(DataDirs_Roots_getSize);
+	REGISTER_CALLBACK(DataDirs_Roots_getDir);
+	REGISTER_CALLBACK(DataDirs_Roots_locatePath);
+	REGISTER_CALLBACK(Game_getCurrentFrame);
+	REGISTER_CALLBACK(Game_getAiInterfaceVersion);
+	REGISTER_CALLBACK(Game_getMyTeam);
+	REGISTER_CALLBACK(Game_getMyAllyTeam);
+	REGISTER_CALLBACK(Game_getPlayerTeam);
+	REGISTER_CALLBACK(Game_getTeams);
+	REGISTER_CALLBACK(Game_getTeamSide);
+	REGISTER_CALLBACK(Game_getTeamColor);
+	REGISTER_CALLBACK(Game_getTeamIncomeMultiplier);
+	REGISTER_CALLBACK(Game_getTeamAllyTeam);
+	REGISTER_CALLBACK(Game_getTeamResourceCurrent);
+	REGISTER_CALLBACK(Game_getTeamResourceIncome);
+	REGISTER_CALLBACK(Game_getTeamResourceUsage);
+	REGISTER_CALLBACK(Game_getTeamResourceStorage);
+	REGISTER_CALLBACK(Game_getTeamResourcePull);
+	REGISTER_CALLBACK(Game_getTeamResourceShare);
+	REGISTER_CALLBACK(Game_getTeamResourceSent);
+	REGISTER_CALLBACK(Game_getTeamResourceReceived);
+	REGISTER_CALLBACK(Game_getTeamResourceExcess);
+	REGISTER_CALLBACK(Game_isAllied);
+	REGISTER_CALLBACK(Game_isDebugModeEnabled);
+	REGISTER_CALLBACK(Game_isPaused);
+	REGISTER_CALLBACK(Game_getSpeedFactor);
+	REGISTER_CALLBACK(Game_getSetupScript);
+	REGISTER_CALLBACK(Game_getCategoryFlag);
+	REGISTER_CALLBACK(Game_getCategoriesFlag);
+	REGISTER_CALLBACK(Game_getCategoryName);
+	REGISTER_CALLBACK(Game_getRulesParamFloat);
+	REGISTER_CALLBACK(Game_getRulesParamString);
+	REGISTER_CALLBACK(Cheats_isEnabled);
+	REGISTER_CALLBACK(Cheats_setEnabled);
+	REGISTER_CALLBACK(Cheats_setEventsEnabled);
+	REGISTER_CALLBACK(Cheats_isOnlyPassive);
+	REGISTER_CALLBACK(getResources);
+	REGISTER_CALLBACK(getResourceByName);
+	REGISTER_CALLBACK(Resource_getName);
+	REGISTER_CALLBACK(Resource_getOptimum);
+	REGISTER_CALLBACK(Economy_getCurrent);
+	REGISTER_CALLBACK(Economy_getIncome);
+	REGISTER_CALLBACK(Economy_getUsage);
+	REGISTER_CALLBACK(Economy_getStorage);
+	REGISTER_CALLBACK(Economy_getPull);
+	REGISTER_CALLBACK(Economy_getShare);
+	REGISTER_CALLBACK(Economy_getSent);
+	REGISTER_CALLBACK(Economy_getReceived);
+	REGISTER_CALLBACK(Economy_getExcess);
+	REGISTER_CALLBACK(File_getSize);
+	REGISTER_CALLBACK(File_getContent);
+	REGISTER_CALLBACK(getUnitDefs);
+	REGISTER_CALLBACK(getUnitDefByName);
+	REGISTER_CALLBACK(UnitDef_getHeight);
+	REGISTER_CALLBACK(UnitDef_getRadius);
+	REGISTER_CALLBACK(UnitDef_getName);
+	REGISTER_CALLBACK(UnitDef_getHumanName);
+	REGISTER_CALLBACK(UnitDef_getUpkeep);
+	REGISTER_CALLBACK(UnitDef_getResourceMake);
+	REGISTER_CALLBACK(UnitDef_getMakesResource);
+	REGISTER_CALLBACK(UnitDef_getCost);
+	REGISTER_CALLBACK(UnitDef_getExtractsResource);
+	REGISTER_CALLBACK(UnitDef_getResourceExtractorRange);
+	REGISTER_CALLBACK(UnitDef_getWindResourceGenerator);
+	REGISTER_CALLBACK(UnitDef_getTidalResourceGenerator);
+	REGISTER_CALLBACK(UnitDef_getStorage);
+	REGISTER_CALLBACK(UnitDef_getBuildTime);
+	REGISTER_CALLBACK(UnitDef_getAutoHeal);
+	REGISTER_CALLBACK(UnitDef_getIdleAutoHeal);
+	REGISTER_CALLBACK(UnitDef_getIdleTime);
+	REGISTER_CALLBACK(UnitDef_getPower);
+	REGISTER_CALLBACK(UnitDef_getHealth);
+	REGISTER_CALLBACK(UnitDef_getCategory);
+	REGISTER_CALLBACK(UnitDef_getSpeed);
+	REGISTER_CALLBACK(UnitDef_getTurnRate);
+	REGISTER_CALLBACK(UnitDef_isTurnInPlace);
+	REGISTER_CALLBACK(UnitDef_getTurnInPlaceDistance);
+	REGISTER_CALLBACK(UnitDef_getTurnInPlaceSpeedLimit);
+	REGISTER_CALLBACK(UnitDef_isUpright);
+	REGISTER_CALLBACK(UnitDef_isCollide);
+	REGISTER_CALLBACK(UnitDef_getLosRadius);
+	REGISTER_CALLBACK(UnitDef_getAirLosRadius);
+	REGISTER_CALLBACK(UnitDef_getLosHeight);
+	REGISTER_CALLBACK(UnitDef_getRadarRadius);
+	REGISTER_CALLBACK(UnitDef_getSonarRadius);
+	REGISTER_CALLBACK(UnitDef_getJammerRadius);
+	REGISTER_CALLBACK(UnitDef_getSonarJamRadius);
+	REGISTER_CALLBACK(UnitDef_getSeismicRadius);
+	REGISTER_CALLBACK(UnitDef_getSeismicSignature);
+	REGISTER_CALLBACK(UnitDef_isStealth);
+	REGISTER_CALLBACK(UnitDef_isSonarStealth);
+	REGISTER_CALLBACK(UnitDef_isBuildRange3D);
+	REGISTER_CALLBACK(UnitDef_getBuildDistance);
+	REGISTER_CALLBACK(UnitDef_getBuildSpeed);
+	REGISTER_CALLBACK(UnitDef_getReclaimSpeed);
+	REGISTER_CALLBACK(UnitDef_getRepairSpeed);
+	REGISTER_CALLBACK(UnitDef_getMaxRepairSpeed);
+	REGISTER_CALLBACK(UnitDef_getResurrectSpeed);
+	REGISTER_CALLBACK(UnitDef_getCaptureSpeed);
+	REGISTER_CALLBACK(UnitDef_getTerraformSpeed);
+	REGISTER_CALLBACK(UnitDef_getUpDirSmoothing);
+	REGISTER_CALLBACK(UnitDef_getMass);
+	REGISTER_CALLBACK(UnitDef_isPushResistant);
+	REGISTER_CALLBACK(UnitDef_isStrafeToAttack);
+	REGISTER_CALLBACK(UnitDef_getMinCollisionSpeed);
+	REGISTER_CALLBACK(UnitDef_getSlideTolerance);
+	REGISTER_CALLBACK(UnitDef_getMaxHeightDif);
+	REGISTER_CALLBACK(UnitDef_getMinWaterDepth);
+	REGISTER_CALLBACK(UnitDef_getWaterline);
+	REGISTER_CALLBACK(UnitDef_getMaxWaterDepth);
+	REGISTER_CALLBACK(UnitDef_getArmoredMultiple);
+	REGISTER_CALLBACK(UnitDef_getArmorType);
+	REGISTER_CALLBACK(UnitDef_FlankingBonus_getMode);
+	REGISTER_CALLBACK(UnitDef_FlankingBonus_getDir);
+	REGISTER_CALLBACK(UnitDef_FlankingBonus_getMax);
+	REGISTER_CALLBACK(UnitDef_FlankingBonus_getMin);
+	REGISTER_CALLBACK(UnitDef_FlankingBonus_getMobilityAdd);
+	REGISTER_CALLBACK(UnitDef_getMaxWeaponRange);
+	REGISTER_CALLBACK(UnitDef_getTooltip);
+	REGISTER_CALLBACK(UnitDef_getWreckName);
+	REGISTER_CALLBACK(UnitDef_getDeathExplosion);
+	REGISTER_CALLBACK(UnitDef_getSelfDExplosion);
+	REGISTER_CALLBACK(UnitDef_getCategoryString);
+	REGISTER_CALLBACK(UnitDef_isAbleToSelfD);
+	REGISTER_CALLBACK(UnitDef_getSelfDCountdown);
+	REGISTER_CALLBACK(UnitDef_isAbleToSubmerge);
+	REGISTER_CALLBACK(UnitDef_isAbleToFly);
+	REGISTER_CALLBACK(UnitDef_isAbleToMove);
+	REGISTER_CALLBACK(UnitDef_isAbleToHover);
+	REGISTER_CALLBACK(UnitDef_isFloater);
+	REGISTER_CALLBACK(UnitDef_isBuilder);
+	REGISTER_CALLBACK(UnitDef_isActivateWhenBuilt);
+	REGISTER_CALLBACK(UnitDef_isOnOffable);
+	REGISTER_CALLBACK(UnitDef_isFullHealthFactory);
+	REGISTER_CALLBACK(UnitDef_isFactoryHeadingTakeoff);
+	REGISTER_CALLBACK(UnitDef_isReclaimable);
+	REGISTER_CALLBACK(UnitDef_isCapturable);
+	REGISTER_CALLBACK(UnitDef_isAbleToRestore);
+	REGISTER_CALLBACK(UnitDef_isAbleToRepair);
+	REGISTER_CALLBACK(UnitDef_isAbleToSelfRepair);
+	REGISTER_CALLBACK(UnitDef_isAbleToReclaim);
+	REGISTER_CALLBACK(UnitDef_isAbleToAttack);
+	REGISTER_CALLBACK(UnitDef_isAbleToPatrol);
+	REGISTER_CALLBACK(UnitDef_isAbleToFight);
+	REGISTER_CALLBACK(UnitDef_isAbleToGuard);
+	REGISTER_CALLBACK(UnitDef_isAbleToAssist);
+	REGISTER_CALLBACK(UnitDef_isAssistable);
+	REGISTER_CALLBACK(UnitDef_isAbleToRepeat);
+	REGISTER_CALLBACK(UnitDef_isAbleToFireControl);
+	REGISTER_CALLBACK(UnitDef_getFireState);
+	REGISTER_CALLBACK(UnitDef_getMoveState);
+	REGISTER_CALLBACK(UnitDef_getWingDrag);
+	REGISTER_CALLBACK(UnitDef_getWingAngle);
+	REGISTER_CALLBACK(UnitDef_getFrontToSpeed);
+	REGISTER_CALLBACK(UnitDef_getSpeedToFront);
+	REGISTER_CALLBACK(UnitDef_getMyGravity);
+	REGISTER_CALLBACK(UnitDef_getMaxBank);
+	REGISTER_CALLBACK(UnitDef_getMaxPitch);
+	REGISTER_CALLBACK(UnitDef_getTurnRadius);
+	REGISTER_CALLBACK(UnitDef_getWantedHeight);
+	REGISTER_CALLBACK(UnitDef_getVerticalSpeed);
+
+	REGISTER_CALLBACK(UnitDef_isHoverAttack);
+	REGISTER_CALLBACK(UnitDef_isAirStrafe);
+
+	REGISTER_CALLBACK(UnitDef_getDlHoverFactor);
+	REGISTER_CALLBACK(UnitDef_getMaxAcceleration);
+	REGISTER_CALLBACK(UnitDef_getMaxDeceleration);
+	REGISTER_CALLBACK(UnitDef_getMaxAileron);
+	REGISTER_CALLBACK(UnitDef_getMaxElevator);
+	REGISTER_CALLBACK(UnitDef_getMaxRudder);
+	REGISTER_CALLBACK(UnitDef_getYardMap);
+	REGISTER_CALLBACK(UnitDef_getXSize);
+	REGISTER_CALLBACK(UnitDef_getZSize);
+	REGISTER_CALLBACK(UnitDef_getLoadingRadius);
+	REGISTER_CALLBACK(UnitDef_getUnloadSpread);
+	REGISTER_CALLBACK(UnitDef_getTransportCapacity);
+	REGISTER_CALLBACK(UnitDef_getTransportSize);
+	REGISTER_CALLBACK(UnitDef_getMinTransportSize);
+	REGISTER_CALLBACK(UnitDef_isAirBase);
+	REGISTER_CALLBACK(UnitDef_isFirePlatform);
+	REGISTER_CALLBACK(UnitDef_getTransportMass);
+	REGISTER_CALLBACK(UnitDef_getMinTransportMass);
+	REGISTER_CALLBACK(UnitDef_isHoldSteady);
+	REGISTER_CALLBACK(UnitDef_isReleaseHeld);
+	REGISTER_CALLBACK(UnitDef_isNotTransportable);
+	REGISTER_CALLBACK(UnitDef_isTransportByEnemy);
+	REGISTER_CALLBACK(UnitDef_getTransportUnloadMethod);
+	REGISTER_CALLBACK(UnitDef_getFallSpeed);
+	REGISTER_CALLBACK(UnitDef_getUnitFallSpeed);
+	REGISTER_CALLBACK(UnitDef_isAbleToCloak);
+	REGISTER_CALLBACK(UnitDef_isStartCloaked);
+	REGISTER_CALLBACK(UnitDef_getCloakCost);
+	REGISTER_CALLBACK(UnitDef_getCloakCostMoving);
+	REGISTER_CALLBACK(UnitDef_getDecloakDistance);
+	REGISTER_CALLBACK(UnitDef_isDecloakSpherical);
+	REGISTER_CALLBACK(UnitDef_isDecloakOnFire);
+	REGISTER_CALLBACK(UnitDef_isAbleToKamikaze);
+	REGISTER_CALLBACK(UnitDef_getKamikazeDist);
+	REGISTER_CALLBACK(UnitDef_isTargetingFacility);
+	REGISTER_CALLBACK(UnitDef_canManualFire);
+	REGISTER_CALLBACK(UnitDef_isNeedGeo);
+	REGISTER_CALLBACK(UnitDef_isFeature);
+	REGISTER_CALLBACK(UnitDef_isHideDamage);
+	REGISTER_CALLBACK(UnitDef_isShowPlayerName);
+	REGISTER_CALLBACK(UnitDef_isAbleToResurrect);
+	REGISTER_CALLBACK(UnitDef_isAbleToCapture);
+	REGISTER_CALLBACK(UnitDef_getHighTrajectoryType);
+	REGISTER_CALLBACK(UnitDef_getNoChaseCategory);
+	REGISTER_CALLBACK(UnitDef_isAbleToDropFlare);
+	REGISTER_CALLBACK(UnitDef_getFlareReloadTime);
+	REGISTER_CALLBACK(UnitDef_getFlareEfficiency);
+	REGISTER_CALLBACK(UnitDef_getFlareDelay);
+	REGISTER_CALLBACK(UnitDef_getFlareDropVector);
+	REGISTER_CALLBACK(UnitDef_getFlareTime);
+	REGISTER_CALLBACK(UnitDef_getFlareSalvoSize);
+	REGISTER_CALLBACK(UnitDef_getFlareSalvoDelay);
+	REGISTER_CALLBACK(UnitDef_isAbleToLoopbackAttack);
+	REGISTER_CALLBACK(UnitDef_isLevelGround);
+	REGISTER_CALLBACK(UnitDef_getMaxThisUnit);
+	REGISTER_CALLBACK(UnitDef_getDecoyDef);
+	REGISTER_CALLBACK(UnitDef_isDontLand);
+	REGISTER_CALLBACK(UnitDef_getShieldDef);
+	REGISTER_CALLBACK(UnitDef_getStockpileDef);
+	REGISTER_CALLBACK(UnitDef_getBuildOptions);
+	REGISTER_CALLBACK(UnitDef_getCustomParams);
+	REGISTER_CALLBACK(UnitDef_isMoveDataAvailable);
+	REGISTER_CALLBACK(UnitDef_MoveData_getXSize);
+	REGISTER_CALLBACK(UnitDef_MoveData_getZSize);
+	REGISTER_CALLBACK(UnitDef_MoveData_getDepth);
+	REGISTER_CALLBACK(UnitDef_MoveData_getMaxSlope);
+	REGISTER_CALLBACK(UnitDef_MoveData_getSlopeMod);
+	REGISTER_CALLBACK(UnitDef_MoveData_getDepthMod);
+	REGISTER_CALLBACK(UnitDef_MoveData_getPathType);
+	REGISTER_CALLBACK(UnitDef_MoveData_getCrushStrength);
+	REGISTER_CALLBACK(UnitDef_MoveData_getSpeedModClass);
+	REGISTER_CALLBACK(UnitDef_MoveData_getTerrainClass);
+	REGISTER_CALLBACK(UnitDef_MoveData_getFollowGround);
+	REGISTER_CALLBACK(UnitDef_MoveData_isSubMarine);
+	REGISTER_CALLBACK(UnitDef_MoveData_getName);
+	REGISTER_CALLBACK(UnitDef_getWeaponMounts);
+	REGISTER_CALLBACK(UnitDef_WeaponMount_getName);
+	REGISTER_CALLBACK(UnitDef_WeaponMount_getWeaponDef);
+	REGISTER_CALLBACK(UnitDef_WeaponMount_getSlavedTo);
+	REGISTER_CALLBACK(UnitDef_WeaponMount_getMainDir);
+	REGISTER_CALLBACK(UnitDef_WeaponMount_getMaxAngleDif);
+	REGISTER_CALLBACK(UnitDef_WeaponMount_getBadTargetCategory);
+	REGISTER_CALLBACK(UnitDef_WeaponMount_getOnlyTargetCategory);
+	REGISTER_CALLBACK(Unit_getLimit);
+	REGISTER_CALLBACK(Unit_getMax);
+	REGISTER_CALLBACK(getEnemyUnits);
+	REGISTER_CALLBACK(getEnemyUnitsIn);
+	REGISTER_CALLBACK(getEnemyUnitsInRadarAndLos);
+	REGISTER_CALLBACK(getFriendlyUnits);
+	REGISTER_CALLBACK(getFriendlyUnitsIn);
+	REGISTER_CALLBACK(getNeutralUnits);
+	REGISTER_CALLBACK(getNeutralUnitsIn);
+	REGISTER_CALLBACK(getTeamUnits);
+	REGISTER_CALLBACK(getSelectedUnits);
+	REGISTER_CALLBACK(Unit_getDef);
+	REGISTER_CALLBACK(Unit_getRulesParamFloat);
+	REGISTER_CALLBACK(Unit_getRulesParamString);
+	REGISTER_CALLBACK(Unit_getTeam);
+	REGISTER_CALLBACK(Unit_getAllyTeam);
+	REGISTER_CALLBACK(Unit_getStockpile);
+	REGISTER_CALLBACK(Unit_getStockpileQueued);
+	REGISTER_CALLBACK(Unit_getMaxSpeed);
+	REGISTER_CALLBACK(Unit_getMaxRange);
+	REGISTER_CALLBACK(Unit_getMaxHealth);
+	REGISTER_CALLBACK(Unit_getExperience);
+	REGISTER_CALLBACK(Unit_getGroup);
+	REGISTER_CALLBACK(Unit_getCurrentCommands);
+	REGISTER_CALLBACK(Unit_CurrentCommand_getType);
+	REGISTER_CALLBACK(Unit_CurrentCommand_getId);
+	REGISTER_CALLBACK(Unit_CurrentCommand_getOptions);
+	REGISTER_CALLBACK(Unit_CurrentCommand_getTag);
+	REGISTER_CALLBACK(Unit_CurrentCommand_getTimeOut);
+	REGISTER_CALLBACK(Unit_CurrentCommand_getParams);
+	REGISTER_CALLBACK(Unit_getSupportedCommands);
+	REGISTER_CALLBACK(Unit_SupportedCommand_getId);
+	REGISTER_CALLBACK(Unit_SupportedCommand_getName);
+	REGISTER_CALLBACK(Unit_SupportedCommand_getToolTip);
+	REGISTER_CALLBACK(Unit_SupportedCommand_isShowUnique);
+	REGISTER_CALLBACK(Unit_SupportedCommand_isDisabled);
+	REGISTER_CALLBACK(Unit_SupportedCommand_getParams);
+	REGISTER_CALLBACK(Unit_getHealth);
+	REGISTER_CALLBACK(Unit_getParalyzeDamage);
+	REGISTER_CALLBACK(Unit_getCaptureProgress);
+	REGISTER_CALLBACK(Unit_getBuildProgress);
+	REGISTER_CALLBACK(Unit_getSpeed);
+	REGISTER_CALLBACK(Unit_getPower);
+	REGISTER_CALLBACK(Unit_getResourceUse);
+	REGISTER_CALLBACK(Unit_getResourceMake);
+	REGISTER_CALLBACK(Unit_getPos);
+	REGISTER_CALLBACK(Unit_getVel);
+	REGISTER_CALLBACK(Unit_isActivated);
+	REGISTER_CALLBACK(Unit_isBeingBuilt);
+	REGISTER_CALLBACK(Unit_isCloaked);
+	REGISTER_CALLBACK(Unit_isParalyzed);
+	REGISTER_CALLBACK(Unit_isNeutral);
+	REGISTER_CALLBACK(Unit_getBuildingFacing);
+	REGISTER_CALLBACK(Unit_getLastUserOrderFrame);
+	REGISTER_CALLBACK(Unit_getWeapons);
+	REGISTER_CALLBACK(Unit_getWeapon);
+	REGISTER_CALLBACK(Team_hasAIController);
+	REGISTER_CALLBACK(getEnemyTeams);
+	REGISTER_CALLBACK(getAlliedTeams);
+	REGISTER_CALLBACK(Team_getRulesParamFloat);
+	REGISTER_CALLBACK(Team_getRulesParamString);
+	REGISTER_CALLBACK(getGroups);
+	REGISTER_CALLBACK(Group_getSupportedCommands);
+	REGISTER_CALLBACK(Group_SupportedCommand_getId);
+	REGISTER_CALLBACK(Group_SupportedCommand_getName);
+	REGISTER_CALLBACK(Group_SupportedCommand_getToolTip);
+	REGISTER_CALLBACK(Group_SupportedCommand_isShowUnique);
+	REGISTER_CALLBACK(Group_SupportedCommand_isDisabled);
+	REGISTER_CALLBACK(Group_SupportedCommand_getParams);
+	REGISTER_CALLBACK(Group_OrderPreview_getId);
+	REGISTER_CALLBACK(Group_OrderPreview_getOptions);
+	REGISTER_CALLBACK(Group_OrderPreview_getTag);
+	REGISTER_CALLBACK(Group_OrderPreview_getTimeOut);
+	REGISTER_CALLBACK(Group_OrderPreview_getParams);
+	REGISTER_CALLBACK(Group_isSelected);
+	REGISTER_CALLBACK(Mod_getFileName);
+	REGISTER_CALLBACK(Mod_getHash);
+	REGISTER_CALLBACK(Mod_getHumanName);
+	REGISTER_CALLBACK(Mod_getShortName);
+	REGISTER_CALLBACK(Mod_getVersion);
+	REGISTER_CALLBACK(Mod_getMutator);
+	REGISTER_CALLBACK(Mod_getDescription);
+	REGISTER_CALLBACK(Mod_getConstructionDecay);
+	REGISTER_CALLBACK(Mod_getConstructionDecayTime);
+	REGISTER_CALLBACK(Mod_getConstructionDecaySpeed);
+	REGISTER_CALLBACK(Mod_getMultiReclaim);
+	REGISTER_CALLBACK(Mod_getReclaimMethod);
+	REGISTER_CALLBACK(Mod_getReclaimUnitMethod);
+	REGISTER_CALLBACK(Mod_getReclaimUnitEnergyCostFactor);
+	REGISTER_CALLBACK(Mod_getReclaimUnitEfficiency);
+	REGISTER_CALLBACK(Mod_getReclaimFeatureEnergyCostFactor);
+	REGISTER_CALLBACK(Mod_getReclaimAllowEnemies);
+	REGISTER_CALLBACK(Mod_getReclaimAllowAllies);
+	REGISTER_CALLBACK(Mod_getRepairEnergyCostFactor);
+	REGISTER_CALLBACK(Mod_getResurrectEnergyCostFactor);
+	REGISTER_CALLBACK(Mod_getCaptureEnergyCostFactor);
+	REGISTER_CALLBACK(Mod_getTransportGround);
+	REGISTER_CALLBACK(Mod_getTransportHover);
+	REGISTER_CALLBACK(Mod_getTransportShip);
+	REGISTER_CALLBACK(Mod_getTransportAir);
+	REGISTER_CALLBACK(Mod_getFireAtKilled);
+	REGISTER_CALLBACK(Mod_getFireAtCrashing);
+	REGISTER_CALLBACK(Mod_getFlankingBonusModeDefault);
+	REGISTER_CALLBACK(Mod_getLosMipLevel);
+	REGISTER_CALLBACK(Mod_getAirMipLevel);
+	REGISTER_CALLBACK(Mod_getRadarMipLevel);
+	REGISTER_CALLBACK(Mod_getRequireSonarUnderWater);
+	REGISTER_CALLBACK(Map_getChecksum);
+	REGISTER_CALLBACK(Map_getStartPos);
+	REGISTER_CALLBACK(Map_getMousePos);
+	REGISTER_CALLBACK(Map_isPosInCamera);
+	REGISTER_CALLBACK(Map_getWidth);
+	REGISTER_CALLBACK(Map_getHeight);
+	REGISTER_CALLBACK(Map_getHeightMap);
+	REGISTER_CALLBACK(Map_getCornersHeightMap);
+	REGISTER_CALLBACK(Map_getMinHeight);
+	REGISTER_CALLBACK(Map_getMaxHeight);
+	REGISTER_CALLBACK(Map_getSlopeMap);
+	REGISTER_CALLBACK(Map_getLosMap);
+	REGISTER_CALLBACK(Map_getAirLosMap);
+	REGISTER_CALLBACK(Map_getRadarMap);
+	REGISTER_CALLBACK(Map_getSonarMap);
+	REGISTER_CALLBACK(Map_getSeismicMap);
+	REGISTER_CALLBACK(Map_getJammerMap);
+	REGISTER_CALLBACK(Map_getSonarJammerMap);
+	REGISTER_CALLBACK(Map_getResourceMapRaw);
+	REGISTER_CALLBACK(Map_getResourceMapSpotsPositions);
+	REGISTER_CALLBACK(Map_getResourceMapSpotsAverageIncome);
+	REGISTER_CALLBACK(Map_getResourceMapSpotsNearest);
+	REGISTER_CALLBACK(Map_getHash);
+	REGISTER_CALLBACK(Map_getName);
+	REGISTER_CALLBACK(Map_getHumanName);
+	REGISTER_CALLBACK(Map_getElevationAt);
+	REGISTER_CALLBACK(Map_getMaxResource);
+	REGISTER_CALLBACK(Map_getExtractorRadius);
+	REGISTER_CALLBACK(Map_getMinWind);
+	REGISTER_CALLBACK(Map_getMaxWind);
+	REGISTER_CALLBACK(Map_getCurWind);
+	REGISTER_CALLBACK(Map_getTidalStrength);
+	REGISTER_CALLBACK(Map_getGravity);
+	REGISTER_CALLBACK(Map_getWaterDamage);
+	REGISTER_CALLBACK(Map_isDeformable);
+	REGISTER_CALLBACK(Map_getHardness);
+	REGISTER_CALLBACK(Map_getHardnessModMap);
+	REGISTER_CALLBACK(Map_getSpeedModMap);
+	REGISTER_CALLBACK(Map_getPoints);
+	REGISTER_CALLBACK(Map_Point_getPosition);
+	REGISTER_CALLBACK(Map_Point_getColor);
+	REGISTER_CALLBACK(Map_Point_getLabel);
+	REGISTER_CALLBACK(Map_getLines);
+	REGISTER_CALLBACK(Map_Line_getFirstPosition);
+	REGISTER_CALLBACK(Map_Line_getSecondPosition);
+	REGISTER_CALLBACK(Map_Line_getColor);
+	REGISTER_CALLBACK(Map_isPossibleToBuildAt);
+	REGISTER_CALLBACK(Map_findClosestBuildSite);
+	REGISTER_CALLBACK(getFeatureDefs);
+	REGISTER_CALLBACK(FeatureDef_getName);
+	REGISTER_CALLBACK(FeatureDef_getDescription);
+	REGISTER_CALLBACK(FeatureDef_getContainedResource);
+	REGISTER_CALLBACK(FeatureDef_getMaxHealth);
+	REGISTER_CALLBACK(FeatureDef_getReclaimTime);
+	REGISTER_CALLBACK(FeatureDef_getMass);
+	REGISTER_CALLBACK(FeatureDef_isUpright);
+	REGISTER_CALLBACK(FeatureDef_getDrawType);
+	REGISTER_CALLBACK(FeatureDef_getModelName);
+	REGISTER_CALLBACK(FeatureDef_getResurrectable);
+	REGISTER_CALLBACK(FeatureDef_getSmokeTime);
+	REGISTER_CALLBACK(FeatureDef_isDestructable);
+	REGISTER_CALLBACK(FeatureDef_isReclaimable);
+	REGISTER_CALLBACK(FeatureDef_isAutoreclaimable);
+	REGISTER_CALLBACK(FeatureDef_isBlocking);
+	REGISTER_CALLBACK(FeatureDef_isBurnable);
+	REGISTER_CALLBACK(FeatureDef_isFloating);
+	REGISTER_CALLBACK(FeatureDef_isNoSelect);
+	REGISTER_CALLBACK(FeatureDef_isGeoThermal);
+	REGISTER_CALLBACK(FeatureDef_getXSize);
+	REGISTER_CALLBACK(FeatureDef_getZSize);
+	REGISTER_CALLBACK(FeatureDef_getCustomParams);
+	REGISTER_CALLBACK(getFeatures);
+	REGISTER_CALLBACK(getFeaturesIn);
+	REGISTER_CALLBACK(Feature_getDef);
+	REGISTER_CALLBACK(Feature_getHealth);
+	REGISTER_CALLBACK(Feature_getReclaimLeft);
+	REGISTER_CALLBACK(Feature_getPosition);
+	REGISTER_CALLBACK(Feature_getRulesParamFloat);
+	REGISTER_CALLBACK(Feature_getRulesParamString);
+	REGISTER_CALLBACK(Feature_getResurrectDef);
+	REGISTER_CALLBACK(Feature_getBuildingFacing);
+	REGISTER_CALLBACK(getWeaponDefs);
+	REGISTER_CALLBACK(getWeaponDefByName);
+	REGISTER_CALLBACK(WeaponDef_getName);
+	REGISTER_CALLBACK(WeaponDef_getType);
+	REGISTER_CALLBACK(WeaponDef_getDescription);
+	REGISTER_CALLBACK(WeaponDef_getRange);
+	REGISTER_CALLBACK(WeaponDef_getHeightMod);
+	REGISTER_CALLBACK(WeaponDef_getAccuracy);
+	REGISTER_CALLBACK(WeaponDef_getSprayAngle);
+	REGISTER_CALLBACK(WeaponDef_getMovingAccuracy);
+	REGISTER_CALLBACK(WeaponDef_getTargetMoveError);
+	REGISTER_CALLBACK(WeaponDef_getLeadLimit);
+	REGISTER_CALLBACK(WeaponDef_getLeadBonus);
+	REGISTER_CALLBACK(WeaponDef_getPredictBoost);
+	REGISTER_CALLBACK(WeaponDef_getNumDamageTypes);
+	REGISTER_CALLBACK(WeaponDef_Damage_getParalyzeDamageTime);
+	REGISTER_CALLBACK(WeaponDef_Damage_getImpulseFactor);
+	REGISTER_CALLBACK(WeaponDef_Damage_getImpulseBoost);
+	REGISTER_CALLBACK(WeaponDef_Damage_getCraterMult);
+	REGISTER_CALLBACK(WeaponDef_Damage_getCraterBoost);
+	REGISTER_CALLBACK(WeaponDef_Damage_getTypes);
+	REGISTER_CALLBACK(WeaponDef_getAreaOfEffect);
+	REGISTER_CALLBACK(WeaponDef_isNoSelfDamage);
+	REGISTER_CALLBACK(WeaponDef_getFireStarter);
+	REGISTER_CALLBACK(WeaponDef_getEdgeEffectiveness);
+	REGISTER_CALLBACK(WeaponDef_getSize);
+	REGISTER_CALLBACK(WeaponDef_getSizeGrowth);
+	REGISTER_CALLBACK(WeaponDef_getCollisionSize);
+	REGISTER_CALLBACK(WeaponDef_getSalvoSize);
+	REGISTER_CALLBACK(WeaponDef_getSalvoDelay);
+	REGISTER_CALLBACK(WeaponDef_getReload);
+	REGISTER_CALLBACK(WeaponDef_getBeamTime);
+	REGISTER_CALLBACK(WeaponDef_isBeamBurst);
+	REGISTER_CALLBACK(WeaponDef_isWaterBounce);
+	REGISTER_CALLBACK(WeaponDef_isGroundBounce);
+	REGISTER_CALLBACK(WeaponDef_getBounceRebound);
+	REGISTER_CALLBACK(WeaponDef_getBounceSlip);
+	REGISTER_CALLBACK(WeaponDef_getNumBounce);
+	REGISTER_CALLBACK(WeaponDef_getMaxAngle);
+	REGISTER_CALLBACK(WeaponDef_getUpTime);
+	REGISTER_CALLBACK(WeaponDef_getFlightTime);
+	REGISTER_CALLBACK(WeaponDef_getCost);
+	REGISTER_CALLBACK(WeaponDef_getProjectilesPerShot);
+	REGISTER_CALLBACK(WeaponDef_isTurret);
+	REGISTER_CALLBACK(WeaponDef_isOnlyForward);
+	REGISTER_CALLBACK(WeaponDef_isFixedLauncher);
+	REGISTER_CALLBACK(WeaponDef_isWaterWeapon);
+	REGISTER_CALLBACK(WeaponDef_isFireSubmersed);
+	REGISTER_CALLBACK(WeaponDef_isSubMissile);
+	REGISTER_CALLBACK(WeaponDef_isTracks);
+	REGISTER_CALLBACK(WeaponDef_isDropped);
+	REGISTER_CALLBACK(WeaponDef_isParalyzer);
+	REGISTER_CALLBACK(WeaponDef_isImpactOnly);
+	REGISTER_CALLBACK(WeaponDef_isNoAutoTarget);
+	REGISTER_CALLBACK(WeaponDef_isManualFire);
+	REGISTER_CALLBACK(WeaponDef_getInterceptor);
+	REGISTER_CALLBACK(WeaponDef_getTargetable);
+	REGISTER_CALLBACK(WeaponDef_isStockpileable);
+	REGISTER_CALLBACK(WeaponDef_getCoverageRange);
+	REGISTER_CALLBACK(WeaponDef_getStockpileTime);
+	REGISTER_CALLBACK(WeaponDef_getIntensity);
+	REGISTER_CALLBACK(WeaponDef_getDuration);
+	REGISTER_CALLBACK(WeaponDef_getFalloffRate);
+	REGISTER_CALLBACK(WeaponDef_isSelfExplode);
+	REGISTER_CALLBACK(WeaponDef_isGravityAffected);
+	REGISTER_CALLBACK(WeaponDef_getHighTrajectory);
+	REGISTER_CALLBACK(WeaponDef_getMyGravity);
+	REGISTER_CALLBACK(WeaponDef_isNoExplode);
+	REGISTER_CALLBACK(WeaponDef_getStartVelocity);
+	REGISTER_CALLBACK(WeaponDef_getWeaponAcceleration);
+	REGISTER_CALLBACK(WeaponDef_getTurnRate);
+	REGISTER_CALLBACK(WeaponDef_getMaxVelocity);
+	REGISTER_CALLBACK(WeaponDef_getProjectileSpeed);
+	REGISTER_CALLBACK(WeaponDef_getExplosionSpeed);
+	REGISTER_CALLBACK(WeaponDef_getOnlyTargetCategory);
+	REGISTER_CALLBACK(WeaponDef_getWobble);
+	REGISTER_CALLBACK(WeaponDef_getDance);
+	REGISTER_CALLBACK(WeaponDef_getTrajectoryHeight);
+	REGISTER_CALLBACK(WeaponDef_isLargeBeamLaser);
+	REGISTER_CALLBACK(WeaponDef_isShield);
+	REGISTER_CALLBACK(WeaponDef_isShieldRepulser);
+	REGISTER_CALLBACK(WeaponDef_isSmartShield);
+	REGISTER_CALLBACK(WeaponDef_isExteriorShield);
+	REGISTER_CALLBACK(WeaponDef_isVisibleShield);
+	REGISTER_CALLBACK(WeaponDef_isVisibleShieldRepulse);
+	REGISTER_CALLBACK(WeaponDef_getVisibleShieldHitFrames);
+	REGISTER_CALLBACK(WeaponDef_Shield_getResourceUse);
+	REGISTER_CALLBACK(WeaponDef_Shield_getRadius);
+	REGISTER_CALLBACK(WeaponDef_Shield_getForce);
+	REGISTER_CALLBACK(WeaponDef_Shield_getMaxSpeed);
+	REGISTER_CALLBACK(WeaponDef_Shield_getPower);
+	REGISTER_CALLBACK(WeaponDef_Shield_getPowerRegen);
+	REGISTER_CALLBACK(WeaponDef_Shield_getPowerRegenResource);
+	REGISTER_CALLBACK(WeaponDef_Shield_getStartingPower);
+	REGISTER_CALLBACK(WeaponDef_Shield_getRechargeDelay);
+	REGISTER_CALLBACK(WeaponDef_Shield_getInterceptType);
+	REGISTER_CALLBACK(WeaponDef_getInterceptedByShieldType);
+	REGISTER_CALLBACK(WeaponDef_isAvoidFriendly);
+	REGISTER_CALLBACK(WeaponDef_isAvoidFeature);
+	REGISTER_CALLBACK(WeaponDef_isAvoidNeutral);
+	REGISTER_CALLBACK(WeaponDef_getTargetBorder);
+	REGISTER_CALLBACK(WeaponDef_getCylinderTargetting);
+	REGISTER_CALLBACK(WeaponDef_getMinIntensity);
+	REGISTER_CALLBACK(WeaponDef_getHeightBoostFactor);
+	REGISTER_CALLBACK(WeaponDef_getProximityPriority);
+	REGISTER_CALLBACK(WeaponDef_getCollisionFlags);
+	REGISTER_CALLBACK(WeaponDef_isSweepFire);
+	REGISTER_CALLBACK(WeaponDef_isAbleToAttackGround);
+	REGISTER_CALLBACK(WeaponDef_getCameraShake);
+	REGISTER_CALLBACK(WeaponDef_getDynDamageExp);
+	REGISTER_CALLBACK(WeaponDef_getDynDamageMin);
+	REGISTER_CALLBACK(WeaponDef_getDynDamageRange);
+	REGISTER_CALLBACK(WeaponDef_isDynDamageInverted);
+	REGISTER_CALLBACK(WeaponDef_getCustomParams);
+	REGISTER_CALLBACK(Unit_Weapon_getDef);
+	REGISTER_CALLBACK(Unit_Weapon_getReloadFrame);
+	REGISTER_CALLBACK(Unit_Weapon_getReloadTime);
+	REGISTER_CALLBACK(Unit_Weapon_getRange);
+	REGISTER_CALLBACK(Unit_Weapon_isShieldEnabled);
+	REGISTER_CALLBACK(Unit_Weapon_getShieldPower);
+	REGISTER_CALLBACK(Debug_GraphDrawer_isEnabled);
+	REGISTER_CALLBACK(getUnitsData);
+
+	#undef REGISTER_CALLBACK
 }
 
 SSkirmishAICallback* skirmishAiCallback_GetInstance(CSkirmishAIWrapper* ai)
@@ -5535,7 +5633,7 @@ SSkirmishAICallback* skirmishAiCallback_GetInstance(CSkirmishAIWrapper* ai)
 	AI_CHEAT_FLAGS[ai->GetSkirmishAIID()] = {false, false};
 	AI_TEAM_IDS[ai->GetSkirmishAIID()] = ai->GetTeamId();
 
-	skirmishAiCallback_init(&AI_CALLBACK_WRAPPERS[ai->GetSkirmishAIID()]);
+	skirmishAiCallback_init(&AI_CALLBACK_WRAPPERS[ai->GetSkirmishAIID()], ai->IsThreaded());
 
 	return &AI_CALLBACK_WRAPPERS[ai->GetSkirmishAIID()];
 }
@@ -1263,6 +1263,8 @@ EXPORT(float            ) skirmishAiCallback_Unit_Weapon_getShieldPower(int skir
 
 EXPORT(bool             ) skirmishAiCallback_Debug_GraphDrawer_isEnabled(int skirmishAIId);
 
+EXPORT(int              ) skirmishAiCallback_getUnitsData(int skirmishAIId, int* unitIds, int unitIds_size, float* positions, float* velocities, float* healths, int* unitDefIds, int* teamIds, float* buildProgresses);
+
 #if	defined(__cplusplus)
 } // extern "C"
 #endif
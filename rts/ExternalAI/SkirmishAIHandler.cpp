@@ -31,7 +31,6 @@ CR_REG_METADATA(CSkirmishAIHandler, (
 		CR_IGNORED(skirmishAIDataMap),
 		CR_IGNORED(luaAIShortNames),
 
-		CR_IGNORED(currentAIId),
 		CR_IGNORED(numSkirmishAIs),
 
 		CR_IGNORED(gameInitialized),
@@ -43,6 +42,8 @@ CR_REG_METADATA(CSkirmishAIHandler, (
 
 CSkirmishAIHandler skirmishAIHandler;
 
+thread_local uint8_t CSkirmishAIHandler::currentAIId = MAX_AIS;
+
 
 void CSkirmishAIHandler::SerializeSkirmishAIHandler(creg::ISerializer* s)
 {
@@ -77,7 +78,6 @@ void CSkirmishAIHandler::ResetState()
 	luaAIShortNames.clear();
 
 	numSkirmishAIs = 0;
-	currentAIId = MAX_AIS;
 
 	gameInitialized = false;
 }
@@ -200,8 +200,10 @@ private:
 	spring::unordered_map<uint8_t, const SkirmishAIData*> skirmishAIDataMap;
 	spring::unordered_set<std::string> luaAIShortNames;
 
-	// the current local AI ID that is executing, MAX_AIS if none (e.g. LuaUI)
-	uint8_t currentAIId = MAX_AIS;
+	// the current local AI ID that is executing, MAX_AIS if none (e.g. LuaUI);
+	// per thread since threaded AIs (see AIThreaded) run their events concurrently
+	static thread_local uint8_t currentAIId;
+
 	uint8_t numSkirmishAIs = 0;
 
 	bool gameInitialized = false;
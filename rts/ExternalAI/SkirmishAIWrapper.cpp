@@ -3,6 +3,7 @@
 #include "SkirmishAIWrapper.h"
 
 #include "AILibraryManager.h"
+#include "EngineOutHandler.h"
 #include "SkirmishAIHandler.h"
 #include "SkirmishAILibrary.h"
 #include "SkirmishAILibraryInfo.h"
@@ -15,6 +16,7 @@
 
 #include "Sim/Units/Unit.h"
 #include "Sim/Units/UnitHandler.h"
+#include "Sim/Misc/GlobalSynced.h"
 #include "Sim/Misc/TeamHandler.h"
 
 #include "System/FileSystem/DataDirsAccess.h"
@@ -22,9 +24,12 @@
 #include "System/FileSystem/FileSystem.h"
 #include "System/Log/ILog.h"
 #include "System/Platform/SharedLib.h"
+#include "System/Platform/Threading.h"
 #include "System/TimeProfiler.h"
 #include "System/StringUtil.h"
 
+#include <cstring>
+#include <functional>
 #include <string>
 #include <sstream>
 #include <iostream>
@@ -50,12 +55,33 @@ CR_REG_METADATA(CSkirmishAIWrapper, (
 	CR_MEMBER(libraryInit),
 
 	CR_MEMBER(cheatEvents),
-	CR_MEMBER(blockEvents),
+	CR_IGNORED(blockEvents), // atomic, see Serialize
+
+	// threaded mode is a local choice, re-read in PreInit
+	CR_IGNORED(threaded),
+	CR_IGNORED(eventThread),
+	CR_IGNORED(eventMutex),
+	CR_IGNORED(eventCond),
+	CR_IGNORED(eventDoneCond),
+	CR_IGNORED(eventQueue),
+	CR_IGNORED(handledFrame),
+	CR_IGNORED(handlingEvent),
+	CR_IGNORED(stopEventThread),
 
 	CR_SERIALIZER(Serialize),
 	CR_POSTLOAD(PostLoad)
 ))
 
+thread_local bool CSkirmishAIWrapper::inEventThread = false;
+
+
+void CSkirmishAIWrapper::Serialize(creg::ISerializer* s)
+{
+	bool block = blockEvents;
+	s->SerializeInt(&block, sizeof(block));
+	blockEvents = block;
+}
+
 void CSkirmishAIWrapper::PreInit(int aiID)
 {
 	const SkirmishAIData* aiData = skirmishAIHandler.GetSkirmishAI(aiID);
@@ -74,6 +100,8 @@ void CSkirmishAIWrapper::PreInit(int aiID)
 
 		cheatEvents = false;
 		blockEvents = false;
+
+		threaded = eoh->ThreadedSkirmishAIs();
 	}
 	{
 		const std::string& kn = key.GetShortName();
@@ -141,6 +169,9 @@ void CSkirmishAIWrapper::Init(bool savedGame) {
 	if (!InitLibrary())
 		return;
 
+	if (threaded)
+		StartEventThread();
+
 	SendInitEvent(savedGame);
 }
 
@@ -149,6 +180,7 @@ void CSkirmishAIWrapper::Kill()
 	assert(Active());
 	// send release event
 	Release(skirmishAIHandler.GetLocalKillFlag(skirmishAIId));
+	StopEventThread();
 
 	{
 		ScopedTimer timer(GetTimerNameHash());
@@ -454,7 +486,207 @@ void CSkirmishAIWrapper::SeismicPing(
 }
 
 
-int CSkirmishAIWrapper::HandleEvent(int topic, const void* data) const {
+// returns the size of the event struct for events that can be queued, 0 for
+// those which must be handled synchronously because the caller expects a
+// reply or they refer to temporary files
+//
+// handling an event synchronously means waiting for the AI thread, which in
+// turn needs the simulation parked; this is only safe between frames,
+// so anything that can be sent from within SimFrame (e.g. Lua messages from
+// GameFrame call-ins) has to be queued
+template<typename T> static constexpr size_t QueuedEventSize() {
+	static_assert(sizeof(T) <= CSkirmishAIWrapper::MAX_QUEUED_EVENT_SIZE, "QueuedEvent::data is too small");
+	return (sizeof(T));
+}
+
+static size_t GetQueuedEventSize(int topic) {
+	switch (topic) {
+		case EVENT_UPDATE          : return (QueuedEventSize<SUpdateEvent>());
+		case EVENT_MESSAGE         : return (QueuedEventSize<SMessageEvent>());
+		case EVENT_UNIT_CREATED    : return (QueuedEventSize<SUnitCreatedEvent>());
+		case EVENT_UNIT_FINISHED   : return (QueuedEventSize<SUnitFinishedEvent>());
+		case EVENT_UNIT_IDLE       : return (QueuedEventSize<SUnitIdleEvent>());
+		case EVENT_UNIT_MOVE_FAILED: return (QueuedEventSize<SUnitMoveFailedEvent>());
+		case EVENT_UNIT_DAMAGED    : return (QueuedEventSize<SUnitDamagedEvent>());
+		case EVENT_UNIT_DESTROYED  : return (QueuedEventSize<SUnitDestroyedEvent>());
+		case EVENT_UNIT_GIVEN      : return (QueuedEventSize<SUnitGivenEvent>());
+		case EVENT_UNIT_CAPTURED   : return (QueuedEventSize<SUnitCapturedEvent>());
+		case EVENT_ENEMY_ENTER_LOS : return (QueuedEventSize<SEnemyEnterLOSEvent>());
+		case EVENT_ENEMY_LEAVE_LOS : return (QueuedEventSize<SEnemyLeaveLOSEvent>());
+		case EVENT_ENEMY_ENTER_RADAR: return (QueuedEventSize<SEnemyEnterRadarEvent>());
+		case EVENT_ENEMY_LEAVE_RADAR: return (QueuedEventSize<SEnemyLeaveRadarEvent>());
+		case EVENT_ENEMY_DAMAGED   : return (QueuedEventSize<SEnemyDamagedEvent>());
+		case EVENT_ENEMY_DESTROYED : return (QueuedEventSize<SEnemyDestroyedEvent>());
+		case EVENT_WEAPON_FIRED    : return (QueuedEventSize<SWeaponFiredEvent>());
+		case EVENT_PLAYER_COMMAND  : return (QueuedEventSize<SPlayerCommandEvent>());
+		case EVENT_SEISMIC_PING    : return (QueuedEventSize<SSeismicPingEvent>());
+		case EVENT_COMMAND_FINISHED: return (QueuedEventSize<SCommandFinishedEvent>());
+		case EVENT_ENEMY_CREATED   : return (QueuedEventSize<SEnemyCreatedEvent>());
+		case EVENT_ENEMY_FINISHED  : return (QueuedEventSize<SEnemyFinishedEvent>());
+		case EVENT_LUA_MESSAGE     : return (QueuedEventSize<SLuaMessageEvent>());
+		default                    : {                                     } break;
+	}
+
+	// EVENT_{INIT,RELEASE,LOAD,SAVE}, only sent by net-commands and (save-)loading
+	return 0;
+}
+
+
+void CSkirmishAIWrapper::StartEventThread()
+{
+	assert(!eventThread.joinable());
+
+	handledFrame = -1;
+	handlingEvent = false;
+	stopEventThread = false;
+
+	eventThread = spring::thread(std::bind(&CSkirmishAIWrapper::EventThreadLoop, this));
+}
+
+void CSkirmishAIWrapper::StopEventThread()
+{
+	if (!eventThread.joinable())
+		return;
+
+	{
+		std::lock_guard<spring::mutex> lck(eventMutex);
+		stopEventThread = true;
+	}
+
+	eventCond.notify_one();
+
+	// the thread might be waiting to make an engine callback
+	eoh->ParkSimulation();
+	eventThread.join();
+	eoh->UnparkSimulation();
+
+	assert(eventQueue.empty());
+}
+
+void CSkirmishAIWrapper::EventThreadLoop()
+{
+	Threading::SetThreadName("skirmishai");
+
+	inEventThread = true;
+
+	std::unique_lock<spring::mutex> lck(eventMutex);
+
+	while (true) {
+		eventCond.wait(lck, [&]() { return (stopEventThread || !eventQueue.empty()); });
+
+		// drain the queue before honoring a stop request
+		if (eventQueue.empty())
+			break;
+
+		QueuedEvent evt = std::move(eventQueue.front());
+		eventQueue.pop_front();
+		handlingEvent = true;
+		lck.unlock();
+
+		switch (evt.topic) {
+			case EVENT_MESSAGE       : { reinterpret_cast<SMessageEvent*      >(evt.data)->message   = evt.str.c_str(); } break;
+			case EVENT_LUA_MESSAGE   : { reinterpret_cast<SLuaMessageEvent*   >(evt.data)->inData    = evt.str.c_str(); } break;
+			case EVENT_UNIT_DAMAGED  : { reinterpret_cast<SUnitDamagedEvent*  >(evt.data)->dir_posF3 = &evt.vec.x;      } break;
+			case EVENT_ENEMY_DAMAGED : { reinterpret_cast<SEnemyDamagedEvent* >(evt.data)->dir_posF3 = &evt.vec.x;      } break;
+			case EVENT_SEISMIC_PING  : { reinterpret_cast<SSeismicPingEvent*  >(evt.data)->pos_posF3 = &evt.vec.x;      } break;
+			case EVENT_PLAYER_COMMAND: { reinterpret_cast<SPlayerCommandEvent*>(evt.data)->unitIds   = evt.ids.data();  } break;
+			default                  : {                                                                                } break;
+		}
+
+		{
+			ScopedMtTimer timer(GetTimerNameHash());
+
+			if (!blockEvents)
+				library->HandleEvent(skirmishAIId, evt.topic, evt.data);
+		}
+
+		lck.lock();
+		handlingEvent = false;
+
+		if (evt.topic == EVENT_UPDATE)
+			handledFrame = evt.frame;
+
+		eventDoneCond.notify_all();
+	}
+}
+
+
+void CSkirmishAIWrapper::WaitForFrame(int frame)
+{
+	// an event in progress is always finished, its next callback would
+	// otherwise have to wait for the simulation to be parked again
+	std::unique_lock<spring::mutex> lck(eventMutex);
+	eventDoneCond.wait(lck, [&]() { return (!handlingEvent && (handledFrame >= frame || eventQueue.empty())); });
+}
+
+void CSkirmishAIWrapper::WaitForEvents()
+{
+	std::unique_lock<spring::mutex> lck(eventMutex);
+	eventDoneCond.wait(lck, [&]() { return (eventQueue.empty() && !handlingEvent); });
+}
+
+
+int CSkirmishAIWrapper::HandleEvent(int topic, const void* data) {
+	if (!eventThread.joinable())
+		return (HandleEventNow(topic, data));
+
+	const size_t size = GetQueuedEventSize(topic);
+
+	if (size == 0) {
+		// let the AI thread catch up first so the event arrives in order;
+		// it might need to make engine callbacks to do so
+		eoh->ParkSimulation();
+		WaitForEvents();
+		eoh->UnparkSimulation();
+
+		return (HandleEventNow(topic, data));
+	}
+
+	{
+		std::lock_guard<spring::mutex> lck(eventMutex);
+
+		QueuedEvent& evt = eventQueue.emplace_back();
+
+		std::memcpy(evt.data, data, size);
+
+		evt.topic = topic;
+		evt.frame = gs->frameNum;
+
+		// pointers into the caller's stack are gone by the time the AI thread
+		// handles the event, keep copies of whatever they point to
+		switch (topic) {
+			case EVENT_UPDATE: {
+				evt.frame = static_cast<const SUpdateEvent*>(data)->frame;
+			} break;
+			case EVENT_MESSAGE: {
+				evt.str = static_cast<const SMessageEvent*>(data)->message;
+			} break;
+			case EVENT_LUA_MESSAGE: {
+				evt.str = static_cast<const SLuaMessageEvent*>(data)->inData;
+			} break;
+			case EVENT_UNIT_DAMAGED: {
+				evt.vec = static_cast<const SUnitDamagedEvent*>(data)->dir_posF3;
+			} break;
+			case EVENT_ENEMY_DAMAGED: {
+				evt.vec = static_cast<const SEnemyDamagedEvent*>(data)->dir_posF3;
+			} break;
+			case EVENT_SEISMIC_PING: {
+				evt.vec = static_cast<const SSeismicPingEvent*>(data)->pos_posF3;
+			} break;
+			case EVENT_PLAYER_COMMAND: {
+				const SPlayerCommandEvent* pce = static_cast<const SPlayerCommandEvent*>(data);
+				evt.ids.assign(pce->unitIds, pce->unitIds + pce->unitIds_size);
+			} break;
+			default: {
+			} break;
+		}
+	}
+
+	eventCond.notify_one();
+	return 0;
+}
+
+int CSkirmishAIWrapper::HandleEventNow(int topic, const void* data) const {
 	ScopedTimer timer(GetTimerNameHash());
 
 	if (!blockEvents || (topic == EVENT_RELEASE))
@@ -463,4 +695,3 @@ int CSkirmishAIWrapper::HandleEvent(int topic, const void* data) const {
 	// to prevent log error spam, signal: OK
 	return 0;
 }
-
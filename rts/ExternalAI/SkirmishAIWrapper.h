@@ -4,6 +4,13 @@
 #define SKIRMISH_AI_WRAPPER_H
 
 #include "SkirmishAIKey.h"
+#include "System/float3.h"
+#include "System/Threading/SpringThreading.h"
+
+#include <atomic>
+#include <deque>
+#include <string>
+#include <vector>
 
 class CSkirmishAILibrary;
 struct SSkirmishAICallback;
@@ -31,7 +38,7 @@ public:
 	CSkirmishAIWrapper& operator = (const CSkirmishAIWrapper& w) = delete;
 	CSkirmishAIWrapper& operator = (CSkirmishAIWrapper&& w) = delete;
 
-	void Serialize(creg::ISerializer* s) {}
+	void Serialize(creg::ISerializer* s);
 	void PostLoad() { SendUnitEvents(); }
 
 
@@ -99,6 +106,21 @@ public:
 
 	bool IsLoadSupported() const;
 
+	/// true if this AI handles its events on a thread of its own
+	bool IsThreaded() const { return threaded; }
+	/// true if called from the event thread of a threaded AI
+	static bool InEventThread() { return inEventThread; }
+
+	/**
+	 * Threaded AIs only: blocks until the AI has handled the Update event
+	 * for <frame>, or has run out of queued events, and is not in the middle
+	 * of another one. The caller must have parked the simulation (see
+	 * CEngineOutHandler::ParkSimulation) for the AI to make progress.
+	 */
+	void WaitForFrame(int frame);
+	/// blocks until the AI thread has handled every queued event
+	void WaitForEvents();
+
 private:
 	bool InitLibrary();
 	void CreateCallback();
@@ -106,16 +128,41 @@ private:
 	void SendInitEvent(bool savedGame);
 	void SendUnitEvents();
 
+	void StartEventThread();
+	void StopEventThread();
+	void EventThreadLoop();
+
 	/**
 	 * CAUTION: takes C AI Interface events, not engine C++ ones!
+	 * For threaded AIs, events that carry no reply are queued and
+	 * handled later on the AI thread; they always return 0 here.
 	 */
-	int HandleEvent(int topic, const void* data) const;
+	int HandleEvent(int topic, const void* data);
+	int HandleEventNow(int topic, const void* data) const;
 
 	uint32_t GetTimerNameHash() const { return *reinterpret_cast<const uint32_t*>(&timerName[0]); }
 
 	const char* GetTimerName() const { return (timerName + sizeof(uint32_t)); }
 	      char* GetTimerName()       { return (timerName + sizeof(uint32_t)); }
 
+public:
+	/// largest S*Event struct that can be queued for threaded AIs
+	static constexpr size_t MAX_QUEUED_EVENT_SIZE = 48;
+
+private:
+	struct QueuedEvent {
+		int topic = -1;
+		int frame = -1;
+
+		// copy of the S*Event struct; its pointer members are re-targeted
+		// at the copies below right before the event is handed to the AI
+		alignas(8) uint8_t data[MAX_QUEUED_EVENT_SIZE];
+
+		float3 vec;
+		std::vector<int> ids;
+		std::string str;
+	};
+
 private:
 	SkirmishAIKey key;
 
@@ -133,7 +180,25 @@ private:
 	bool    released = false; // true after handling Release event
 	bool libraryInit = false; // CSkirmishAILibrary::Init retval
 	bool cheatEvents = false;
-	bool blockEvents = false;
+	bool threaded = false;
+
+	// read by the event thread of threaded AIs
+	std::atomic<bool> blockEvents = {false};
+
+	static thread_local bool inEventThread;
+
+	// threaded mode; the queue and frame counters are guarded by eventMutex
+	spring::thread eventThread;
+	spring::mutex eventMutex;
+	spring::condition_variable eventCond;
+	spring::condition_variable eventDoneCond;
+
+	std::deque<QueuedEvent> eventQueue;
+
+	int handledFrame = -1;
+
+	bool handlingEvent = false;
+	bool stopEventThread = false;
 };
 
 #endif // SKIRMISH_AI_WRAPPER_H
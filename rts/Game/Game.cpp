@@ -14,7 +14,9 @@
 #include "GameSetup.h"
 #include "GlobalUnsynced.h"
 #include "LoadScreen.h"
+#include "LoadStageGraph.h"
 #include "SelectedUnitsHandler.h"
+#include "SimBenchmark.h"
 #include "WaitCommandsAI.h"
 #include "WordCompletion.h"
 #include "IVideoCapturing.h"
@@ -88,6 +90,7 @@
 #include "Sim/MoveTypes/MoveDefHandler.h"
 #include "Sim/MoveTypes/MoveTypeFactory.h"
 #include "Sim/Path/IPathManager.h"
+#include "Sim/Path/PathTrace.h"
 #include "Sim/Projectiles/ExplosionGenerator.h"
 #include "Sim/Projectiles/Projectile.h"
 #include "Sim/Projectiles/ProjectileHandler.h"
@@ -119,6 +122,8 @@
 #include "System/SafeUtil.h"
 #include "System/SpringExitCode.h"
 #include "System/SpringMath.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileQueryFlags.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/LoadSave/LoadSaveHandler.h"
 #include "System/LoadSave/DemoRecorder.h"
@@ -149,6 +154,9 @@ CONFIG(int, ShowPlayerInfo).defaultValue(1).headlessValue(0);
 CONFIG(float, GuiOpacity).defaultValue(0.8f).minimumValue(0.0f).maximumValue(1.0f).description("Sets the opacity of the built-in Spring UI. Generally has no effect on LuaUI widgets. Can be set in-game using shift+, to decrease and shift+. to increase.");
 CONFIG(std::string, InputTextGeo).defaultValue("");
 
+CONFIG(int, SimFrameProfileFrames).defaultValue(0).minimumValue(0).description("Number of most recent sim-frames for which the time spent in each profiled phase is kept (0 disables). See also /SimFrameProfile.");
+CONFIG(std::string, SimFrameProfileFile).defaultValue("").description("If set, p50/p95/p99/max timings of each sim-frame phase are written to this file when the game ends; CSV if the name ends with .csv, JSON otherwise. Requires SimFrameProfileFrames > 0.");
+CONFIG(bool, SyncCheckSections).defaultValue(false).description("Keeps a separate sync checksum per sim subsystem (units, projectiles, path, ...) and sends them along with every sync response, so that desync reports can name the diverging subsystems. Only has an effect in builds with sync checking.");
 CONFIG(int, SmoothTimeOffset).defaultValue(0).headlessValue(0).description("Enables frametimeoffset smoothing, 0 = off (old version), -1 = forced 0.5,  1-20 smooth, recommended = 2-3");
 
 CGame* game = nullptr;
@@ -256,6 +264,12 @@ CGame::CGame(const std::string& mapFileName, const std::string& modFileName, ILo
 	ParseInputTextGeometry("default");
 	ParseInputTextGeometry(configHandler->GetString("InputTextGeo"));
 
+	CFramePhaseRecorder::GetInstance().Init(configHandler->GetInt("SimFrameProfileFrames"));
+
+	#ifdef SYNCCHECK
+	CSyncChecker::SetSectionsEnabled(configHandler->GetBool("SyncCheckSections"));
+	#endif
+
 	// clear left-over receivers in case we reloaded
 	gameCommandConsole.ResetState();
 
@@ -289,6 +303,16 @@ CGame::~CGame()
 	ENTER_SYNCED_CODE();
 	LOG("[Game::%s][1]", __func__);
 
+	// GameEnd already exported if the game ran to completion
+	if (!gameOver)
+		ExportSimFrameProfile();
+
+	simBenchmark.Finish();
+	// a game can end before the dump's last frame
+	CloseDumpStateBinary();
+
+	CFramePhaseRecorder::GetInstance().Kill();
+
 	RmlGui::Shutdown();
 	helper->Kill();
 	KillLua(true);
@@ -361,162 +385,60 @@ void CGame::Load(const std::string& mapFileName)
 
 	ZoneScoped;
 
-	std::vector<std::string> contentErrors;
-
 	auto& globalQuit = gu->globalQuit;
-	bool  forcedQuit = false;
 
 	LuaParser baseDefsParser("gamedata/defs.lua", SPRING_VFS_MOD_BASE, SPRING_VFS_ZIP, {true}, {false});
 	LuaParser nullDefsParser("return {UnitDefs = {}, FeatureDefs = {}, WeaponDefs = {}, ArmorDefs = {}, MoveDefs = {}}", SPRING_VFS_ZIP, 0, {true}, {true});
 
 	LuaParser* defsParser = &baseDefsParser;
 
-	try {
-		LOG("[Game::%s][1] globalQuit=%d threaded=%d", __func__, globalQuit.load(), !Threading::IsMainThread());
-
-		LoadMap(mapFileName);
-		Watchdog::ClearTimer(WDT_LOAD);
-		LoadDefs(defsParser);
-		Watchdog::ClearTimer(WDT_LOAD);
-	} catch (const content_error& e) {
-		contentErrors.emplace_back(e.what());
-		LOG_L(L_ERROR, "[Game::%s][1] forced quit with exception \"%s\"", __func__, e.what());
-
-		defsParser = &nullDefsParser;
-		defsParser->Execute();
-
-		// we can not (yet) do a clean early exit here because the dtor assumes
-		// all loading stages proceeded normally; just force automatic shutdown
-		forcedQuit = true;
-	}
-
-	try {
-		LOG("[Game::%s][2] globalQuit=%d forcedQuit=%d", __func__, globalQuit.load(), forcedQuit);
-
-		PreLoadSimulation(defsParser);
-		Watchdog::ClearTimer(WDT_LOAD);
-		PreLoadRendering();
-		Watchdog::ClearTimer(WDT_LOAD);
-	} catch (const content_error& e) {
-		contentErrors.emplace_back(e.what());
-		LOG_L(L_ERROR, "[Game::%s][2] forced quit with exception \"%s\"", __func__, e.what());
-		forcedQuit = true;
-	}
-
-	try {
-		LOG("[Game::%s][3] globalQuit=%d forcedQuit=%d", __func__, globalQuit.load(), forcedQuit);
-
-		PostLoadSimulation(defsParser);
-		Watchdog::ClearTimer(WDT_LOAD);
-		PostLoadRendering();
-		Watchdog::ClearTimer(WDT_LOAD);
-	} catch (const content_error& e) {
-		contentErrors.emplace_back(e.what());
-		LOG_L(L_ERROR, "[Game::%s][3] forced quit with exception \"%s\"", __func__, e.what());
-		forcedQuit = true;
-	}
-	if (!forcedQuit) {
-		try {
-			LOG("[Game::%s][4] globalQuit=%d forcedQuit=%d", __func__, globalQuit.load(), forcedQuit);
-
-			LoadInterface();
-			Watchdog::ClearTimer(WDT_LOAD);
-		} catch (const content_error& e) {
-			contentErrors.emplace_back(e.what());
-			LOG_L(L_ERROR, "[Game::%s][4] forced quit with exception \"%s\"", __func__, e.what());
-			forcedQuit = true;
-		}
-	}
-
-	if (!forcedQuit) {
-		try {
-			LOG("[Game::%s][5] globalQuit=%d forcedQuit=%d", __func__, globalQuit.load(), forcedQuit);
+	LOG("[Game::%s] globalQuit=%d threaded=%d", __func__, globalQuit.load(), !Threading::IsMainThread());
 
-			LoadFinalize();
-			Watchdog::ClearTimer(WDT_LOAD);
-		} catch (const content_error& e) {
-			contentErrors.emplace_back(e.what());
-			LOG_L(L_ERROR, "[Game::%s][5] forced quit with exception \"%s\"", __func__, e.what());
-			forcedQuit = true;
-		}
-	}
-
-	if (!forcedQuit) {
-		try {
-			LOG("[Game::%s][6] globalQuit=%d forcedQuit=%d", __func__, globalQuit.load(), forcedQuit);
-
-			LoadLua(saveFileHandler != nullptr, false);
-			Watchdog::ClearTimer(WDT_LOAD);
-		} catch (const content_error& e) {
-			contentErrors.emplace_back(e.what());
-			LOG_L(L_ERROR, "[Game::%s][6] forced quit with exception \"%s\"", __func__, e.what());
-			forcedQuit = true;
+	// NOTE:
+	//   STAGE_ASYNC stages run on worker threads next to the loading thread;
+	//   they must not touch GL, the load-lock or Lua handles, and must draw
+	//   nothing from gsRNG that the concurrent stages also draw from (only
+	//   the defs parser uses it before the simulation exists)
+	//
+	//   every stage without STAGE_SKIP_ON_ERROR has to run even after a
+	//   content_error, we can not (yet) do a clean early exit because the
+	//   dtor assumes all loading stages proceeded normally; a failure just
+	//   forces automatic shutdown
+	CLoadStageGraph loadGraph;
+
+	// sounds get parsed while the map loads; the defs parser has to wait for
+	// it since its Game table exposes the map dimensions (read from readMap),
+	// and then overlaps with the icons being loaded
+	const auto mapStage = loadGraph.AddStage("LoadMap", [&]() { LoadMap(mapFileName); });
+	const auto defsStage = loadGraph.AddStage("LoadDefs", [&]() { LoadDefs(defsParser); }, {mapStage}, CLoadStageGraph::STAGE_ASYNC);
+	const auto iconStage = loadGraph.AddStage("LoadIcons", [&]() { LoadIcons(); });
+	const auto soundStage = loadGraph.AddStage("LoadSoundDefs", [&]() { LoadSoundDefs(); }, {}, CLoadStageGraph::STAGE_ASYNC);
+
+	const auto preSimStage = loadGraph.AddStage("PreLoadSimulation", [&]() {
+		if (loadGraph.HasFailed(mapStage) || loadGraph.HasFailed(defsStage)) {
+			defsParser = &nullDefsParser;
+			defsParser->Execute();
 		}
-	}
 
-	try {
-		LOG("[Game::%s][7] globalQuit=%d forcedQuit=%d", __func__, globalQuit.load(), forcedQuit);
-
-		if (!globalQuit && saveFileHandler != nullptr) {
-			loadscreen->SetLoadMessage("Loading Saved Game");
-			{
-				auto lock = CLoadLock::GetUniqueLock();
-				saveFileHandler->LoadGame();
-				Watchdog::ClearTimer(WDT_LOAD);
-			}
-			LoadLua(false, true);
-			Watchdog::ClearTimer(WDT_LOAD);
-		} else {
-			ENTER_SYNCED_CODE();
-			{
-				auto lock = CLoadLock::GetUniqueLock();
-				eventHandler.GamePreload();
-				Watchdog::ClearTimer(WDT_LOAD);
-				eventHandler.CollectGarbage(true);
-				Watchdog::ClearTimer(WDT_LOAD);
-			}
-			LEAVE_SYNCED_CODE();
-		}
-		// Update height bounds and pathing after pregame or a saved game load.
-		{
-			ENTER_SYNCED_CODE();
-			// update features / units in case they need to be rendered before the sim starts
-			// (e.g. during start position selection)
-			featureHandler.UpdatePostFrame();
-			unitHandler.UpdatePostFrame();
-
-			//needed in case pre-game terraform changed the map
-			readMap->UpdateHeightBounds();
-			Watchdog::ClearTimer(WDT_LOAD);
-			pathManager->PostFinalizeRefresh();
-			Watchdog::ClearTimer(WDT_LOAD);
-			LEAVE_SYNCED_CODE();
-		}
+		PreLoadSimulation(defsParser);
+	}, {mapStage, defsStage}, CLoadStageGraph::STAGE_ASYNC);
+	const auto preDrawStage = loadGraph.AddStage("PreLoadRendering", [&]() { PreLoadRendering(); }, {mapStage});
 
-		{
-			char msgBuf[512];
+	// unit-defs resolve their sounds while being parsed
+	const auto postSimStage = loadGraph.AddStage("PostLoadSimulation", [&]() { PostLoadSimulation(defsParser); }, {preSimStage, preDrawStage, iconStage, soundStage});
+	const auto postDrawStage = loadGraph.AddStage("PostLoadRendering", [&]() { PostLoadRendering(); }, {postSimStage});
 
-			SNPRINTF(msgBuf, sizeof(msgBuf), "[Game::%s][lua{Rules,Gaia}={%p,%p}][locale=\"%s\"]", __func__, luaRules, luaGaia, setlocale(LC_ALL, nullptr));
-			CLIENT_NETLOG(gu->myPlayerNum, LOG_LEVEL_INFO, msgBuf);
-		}
-	} catch (const content_error& e) {
-		contentErrors.emplace_back(e.what());
-		LOG_L(L_ERROR, "[Game::%s][7] forced quit with exception \"%s\"", __func__, e.what());
-		forcedQuit = true;
-	}
+	const auto guiStage = loadGraph.AddStage("LoadInterface", [&]() { LoadInterface(); }, {postDrawStage}, CLoadStageGraph::STAGE_SKIP_ON_ERROR);
+	const auto pfsStage = loadGraph.AddStage("LoadFinalize", [&]() { LoadFinalize(); }, {guiStage}, CLoadStageGraph::STAGE_SKIP_ON_ERROR);
+	const auto luaStage = loadGraph.AddStage("LoadLua", [&]() { LoadLua(saveFileHandler != nullptr, false); }, {pfsStage}, CLoadStageGraph::STAGE_SKIP_ON_ERROR);
+	const auto gameStage = loadGraph.AddStage("LoadGameState", [&]() { LoadGameState(); }, {luaStage});
 
-	if (!forcedQuit) {
-		try {
-			LOG("[Game::%s][8] globalQuit=%d forcedQuit=%d", __func__, globalQuit.load(), forcedQuit);
+	loadGraph.AddStage("LoadSkirmishAIs", [&]() { LoadSkirmishAIs(); }, {gameStage}, CLoadStageGraph::STAGE_SKIP_ON_ERROR);
+	loadGraph.Run();
+	loadGraph.LogTimings("Game::Load");
 
-			LoadSkirmishAIs();
-			Watchdog::ClearTimer(WDT_LOAD);
-		} catch (const content_error& e) {
-			contentErrors.emplace_back(e.what());
-			LOG_L(L_ERROR, "[Game::%s][8] forced quit with exception \"%s\"", __func__, e.what());
-			forcedQuit = true;
-		}
-	}
+	const std::vector<std::string> contentErrors = loadGraph.GetErrors();
+	const bool forcedQuit = !contentErrors.empty();
 
 	Watchdog::DeregisterThread(WDT_LOAD);
 	AddTimedJobs();
@@ -531,7 +453,6 @@ void CGame::Load(const std::string& mapFileName)
 	globalQuit = globalQuit | forcedQuit;
 }
 
-
 void CGame::LoadMap(const std::string& mapFileName)
 {
 	ENTER_SYNCED_CODE();
@@ -621,26 +542,30 @@ void CGame::LoadDefs(LuaParser* defsParser)
 
 	}
 
-	{
-		loadscreen->SetLoadMessage("Loading Radar Icons");
-		auto lock = CLoadLock::GetUniqueLock();
-		icon::iconHandler.Init();
-	}
-	{
-		SCOPED_ONCE_TIMER("Game::LoadDefs (Sound)");
-		loadscreen->SetLoadMessage("Loading Sound Definitions");
-
-		LuaParser soundDefsParser("gamedata/sounds.lua", SPRING_VFS_MOD_BASE, SPRING_VFS_MOD_BASE);
-		soundDefsParser.GetTable("Spring");
-		soundDefsParser.AddFunc("GetModOptions", LuaSyncedRead::GetModOptions);
-		soundDefsParser.AddFunc("GetMapOptions", LuaSyncedRead::GetMapOptions);
-		soundDefsParser.EndTable();
+	LEAVE_SYNCED_CODE();
+}
 
-		sound->LoadSoundDefs(&soundDefsParser);
-		chatSound = sound->GetDefSoundId("IncomingChat");
-	}
+void CGame::LoadIcons()
+{
+	loadscreen->SetLoadMessage("Loading Radar Icons");
+	auto lock = CLoadLock::GetUniqueLock();
+	icon::iconHandler.Init();
+}
 
-	LEAVE_SYNCED_CODE();
+void CGame::LoadSoundDefs()
+{
+	SCOPED_ONCE_TIMER("Game::LoadDefs (Sound)");
+	loadscreen->SetLoadMessage("Loading Sound Definitions");
+
+	LuaParser soundDefsParser("gamedata/sounds.lua", SPRING_VFS_MOD_BASE, SPRING_VFS_MOD_BASE);
+	soundDefsParser.GetTable("Spring");
+	soundDefsParser.AddFunc("GetModOptions", LuaSyncedRead::GetModOptions);
+	soundDefsParser.AddFunc("GetMapOptions", LuaSyncedRead::GetMapOptions);
+	soundDefsParser.EndTable();
+
+	// CSound serializes this against its own thread
+	sound->LoadSoundDefs(&soundDefsParser);
+	chatSound = sound->GetDefSoundId("IncomingChat");
 }
 
 
@@ -884,6 +809,54 @@ void CGame::LoadLua(bool dryRun, bool onlyUnsynced)
 	}
 }
 
+void CGame::LoadGameState()
+{
+	ZoneScoped;
+
+	if (!gu->globalQuit && saveFileHandler != nullptr) {
+		loadscreen->SetLoadMessage("Loading Saved Game");
+		{
+			auto lock = CLoadLock::GetUniqueLock();
+			saveFileHandler->LoadGame();
+			Watchdog::ClearTimer(WDT_LOAD);
+		}
+		LoadLua(false, true);
+		Watchdog::ClearTimer(WDT_LOAD);
+	} else {
+		ENTER_SYNCED_CODE();
+		{
+			auto lock = CLoadLock::GetUniqueLock();
+			eventHandler.GamePreload();
+			Watchdog::ClearTimer(WDT_LOAD);
+			eventHandler.CollectGarbage(true);
+			Watchdog::ClearTimer(WDT_LOAD);
+		}
+		LEAVE_SYNCED_CODE();
+	}
+	// Update height bounds and pathing after pregame or a saved game load.
+	{
+		ENTER_SYNCED_CODE();
+		// update features / units in case they need to be rendered before the sim starts
+		// (e.g. during start position selection)
+		featureHandler.UpdatePostFrame();
+		unitHandler.UpdatePostFrame();
+
+		//needed in case pre-game terraform changed the map
+		readMap->UpdateHeightBounds();
+		Watchdog::ClearTimer(WDT_LOAD);
+		pathManager->PostFinalizeRefresh();
+		Watchdog::ClearTimer(WDT_LOAD);
+		LEAVE_SYNCED_CODE();
+	}
+
+	{
+		char msgBuf[512];
+
+		SNPRINTF(msgBuf, sizeof(msgBuf), "[Game::%s][lua{Rules,Gaia}={%p,%p}][locale=\"%s\"]", __func__, luaRules, luaGaia, setlocale(LC_ALL, nullptr));
+		CLIENT_NETLOG(gu->myPlayerNum, LOG_LEVEL_INFO, msgBuf);
+	}
+}
+
 void CGame::LoadSkirmishAIs()
 {
 	if (gameSetup->hostDemo)
@@ -1677,6 +1650,18 @@ void CGame::StartPlaying()
 		eventHandler.GameStart();
 }
 
+void CGame::ExportSimFrameProfile() const
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	const std::string fileName = configHandler->GetString("SimFrameProfileFile");
+
+	if (fileName.empty() || !CFramePhaseRecorder::GetInstance().IsEnabled())
+		return;
+
+	CFramePhaseRecorder::GetInstance().Export(dataDirsAccess.LocateFile(fileName, FileQueryFlags::WRITE));
+}
+
+
 static const char* const tracingSimFrameName = "SimFrame";
 
 void CGame::SimFrame() {
@@ -1743,6 +1728,8 @@ void CGame::SimFrame() {
 		CTeamHighlight::Update(gs->frameNum);
 	}
 
+	CFramePhaseRecorder::GetInstance().BeginFrame(gs->frameNum);
+
 	// everything from here is simulation
 	{
 		SCOPED_SPECIAL_TIMER("Sim");
@@ -1754,6 +1741,7 @@ void CGame::SimFrame() {
 
 		{
 			SCOPED_TIMER("Sim::GameFrame");
+			SYNC_SECTION(LUA);
 
 			// keep garbage-collection rate tied to sim-speed
 			// (fixed 30Hz gc is not enough while catching up)
@@ -1763,13 +1751,26 @@ void CGame::SimFrame() {
 			eventHandler.GameFrame(gs->frameNum);
 		}
 
+		SYNC_SECTION(MISC);
 		helper->Update();
 		readMap->Update();
 		smoothGround.UpdateSmoothMesh();
 		mapDamage->Update();
+
+		SYNC_SECTION(UNITS);
 		unitHandler.Update();
-		pathManager->Update();
+
+		SYNC_SECTION(PATH);
+		if (pathTraceReplayer.IsEnabled()) {
+			pathTraceReplayer.Update();
+		} else {
+			pathManager->Update();
+		}
+
+		SYNC_SECTION(PROJECTILES);
 		projectileHandler.Update();
+
+		SYNC_SECTION(FEATURES);
 		featureHandler.Update();
 		{
 			/* The default GAME_SPEED is 30, which doesn't divide 1000 well,
@@ -1781,26 +1782,44 @@ void CGame::SimFrame() {
 			static constexpr int tickMs = 1000 / GAME_SPEED;
 
 			SCOPED_TIMER("Sim::Script");
+			SYNC_SECTION(UNITS);
 			unitScriptEngine->Tick(tickMs);
 
 			unitHandler.UpdatePostAnimation();
 		}
+		SYNC_SECTION(MISC);
 		envResHandler.Update();
+
+		SYNC_SECTION(LOS);
 		losHandler->Update();
 		// dead ghosts have to be updated in sim, after los,
 		// to make sure they represent the current knowledge correctly.
 		// should probably be split from drawer
 		CUnitDrawer::UpdateGhostedBuildings();
+		SYNC_SECTION(PROJECTILES);
 		interceptHandler.Update(false);
 
+		SYNC_SECTION(TEAMS);
 		teamHandler.GameFrame(gs->frameNum);
 		playerHandler.GameFrame(gs->frameNum);
+
+		SYNC_SECTION(LUA);
 		eventHandler.GameFramePost(gs->frameNum);
 
+		SYNC_SECTION(MISC);
 		unitHandler.UpdatePostFrame();
 		featureHandler.UpdatePostFrame();
+
+		#ifdef SYNCCHECK
+		{
+			const auto rngState = gsRNG.GetGenState();
+			CSyncChecker::SyncToSection(CSyncChecker::SYNC_SECTION_RNG, &rngState, sizeof(rngState));
+		}
+		#endif
 	}
 
+	CFramePhaseRecorder::GetInstance().EndFrame();
+
 	lastSimFrameTime = spring_gettime();
 	gu->avgSimFrameTime = mix(gu->avgSimFrameTime, (lastSimFrameTime - lastFrameTime).toMilliSecsf(), 0.05f);
 	gu->avgSimFrameTime = std::max(gu->avgSimFrameTime, 0.01f);
@@ -1809,8 +1828,16 @@ void CGame::SimFrame() {
 
 	FrameMarkEnd(tracingSimFrameName);
 
+	if (simBenchmark.IsEnabled()) {
+		#ifdef SYNCCHECK
+		simBenchmark.AddFrame(gs->frameNum, lastSimFrameTime - lastFrameTime, CSyncChecker::GetChecksum());
+		#else
+		simBenchmark.AddFrame(gs->frameNum, lastSimFrameTime - lastFrameTime, 0);
+		#endif
+	}
+
 	#ifdef HEADLESS
-	{
+	if (!simBenchmark.IsEnabled()) {
 		const float msecMaxSimFrameTime = 1000.0f / (GAME_SPEED * gs->wantedSpeedFactor);
 		const float msecDifSimFrameTime = (lastSimFrameTime - lastFrameTime).toMilliSecsf();
 		// multiply by 0.5 to give unsynced code some execution time (50% of our sleep-budget)
@@ -1824,6 +1851,7 @@ void CGame::SimFrame() {
 
 	// useful for desync-debugging (enter instead of -1 start & end frame of the range you want to debug)
 	DumpState(-1, -1, 1, std::nullopt);
+	DumpStateBinary(-1, -1, 1);
 
 	ASSERT_SYNCED(gsRNG.GetGenState());
 	LEAVE_SYNCED_CODE();
@@ -1864,8 +1892,11 @@ void CGame::GameEnd(const std::vector<unsigned char>& winningAllyTeams, bool tim
 	CEndGameBox::Create(winningAllyTeams);
 #ifdef    HEADLESS
 	CTimeProfiler::GetInstance().PrintProfilingInfo();
+	CFramePhaseRecorder::GetInstance().PrintSummary();
 #endif // HEADLESS
 
+	ExportSimFrameProfile();
+
 	CDemoRecorder* record = clientNet->GetDemoRecorder();
 
 	if (!record->IsValid())
@@ -57,12 +57,15 @@ private:
 
 	void LoadMap(const std::string& mapName);
 	void LoadDefs(LuaParser* defsParser);
+	void LoadIcons();
+	void LoadSoundDefs();
 	void PreLoadSimulation(LuaParser* defsParser);
 	void PostLoadSimulation(LuaParser* defsParser);
 	void PreLoadRendering();
 	void PostLoadRendering();
 	void LoadInterface();
 	void LoadLua(bool onlySynced, bool onlyUnsynced);
+	void LoadGameState();
 	void LoadSkirmishAIs();
 	void LoadFinalize();
 	void PostLoad();
@@ -148,6 +151,9 @@ private:
 	void SimFrame();
 	void StartPlaying();
 
+	/// writes the sim-frame phase statistics to SimFrameProfileFile, if set
+	void ExportSimFrameProfile() const;
+
 public:
 	GameDrawMode gameDrawMode = gameNotDrawing;
 
@@ -38,6 +38,7 @@
 #include "Sim/Weapons/Weapon.h"
 #include "System/EventHandler.h"
 #include "System/SpringMath.h"
+#include "System/Threading/ThreadPool.h"
 #include "System/Sound/ISoundChannels.h"
 
 #include "System/Misc/TracyDefs.h"
@@ -57,6 +58,9 @@ void CGameHelper::Init()
 
 void CGameHelper::Kill()
 {
+	queuedExplosions.clear();
+	numQueuedExplosions = 0;
+	batchExplosions = false;
 }
 
 void CGameHelper::Update()
@@ -104,37 +108,37 @@ float CGameHelper::CalcImpulseScale(const DamageArray& damages, const float expD
 	return std::clamp(rawImpulseScale, -MAX_EXPLOSION_IMPULSE, MAX_EXPLOSION_IMPULSE);
 }
 
-void CGameHelper::DoExplosionDamage(
-	CUnit* unit,
-	CUnit* owner,
+template<typename T>
+CGameHelper::ExplosionFalloff CGameHelper::CalcExplosionFalloff(
+	const T* object,
+	const LocalModelPiece* hitPiece,
 	const float3& expPos,
 	const float expRadius,
-	const float expSpeed,
 	const float expEdgeEffect,
-	const bool ignoreOwner,
-	const DamageArray& damages,
-	const int weaponDefID,
-	const int projectileID
+	const DamageArray& damages
 ) {
-	RECOIL_DETAILED_TRACY_ZONE;
-	assert(unit != nullptr);
+	ExplosionFalloff falloff;
 
-	if (ignoreOwner && (unit == owner))
-		return;
-
-	const LocalModelPiece* lhp = unit->GetLastHitPiece(gs->frameNum);
-	const CollisionVolume* vol = unit->GetCollisionVolume(lhp);
+	const CollisionVolume* vol = object->GetCollisionVolume(hitPiece);
 
-	const float3& lhpPos = (lhp != nullptr && vol == lhp->GetCollisionVolume())? lhp->GetAbsolutePos(): ZeroVector;
-	const float3& volPos = vol->GetWorldSpacePos(unit, lhpPos);
+	const float3& lhpPos = (hitPiece != nullptr && vol == hitPiece->GetCollisionVolume())? hitPiece->GetAbsolutePos(): ZeroVector;
+	const float3& volPos = vol->GetWorldSpacePos(object, lhpPos);
 
 	// linear damage falloff with distance
-	const float expDist = (expRadius != 0.0f) ? vol->GetPointSurfaceDistance(unit, lhp, expPos) : 0.0f;
-	const float expRim = expDist * expEdgeEffect;
+	// (features have always measured against their full volume)
+	if constexpr (std::is_same_v<T, CUnit>) {
+		falloff.expDist = (expRadius != 0.0f) ? vol->GetPointSurfaceDistance(object, hitPiece, expPos) : 0.0f;
+	} else {
+		falloff.expDist = (expRadius != 0.0f) ? vol->GetPointSurfaceDistance(object, nullptr, expPos) : 0.0f;
+	}
+
+	const float expRim = falloff.expDist * expEdgeEffect;
 
 	// return early if (distance > radius)
-	if (expDist > expRadius)
-		return;
+	if (falloff.expDist > expRadius)
+		return falloff;
+
+	falloff.inRange = true;
 
 	// expEdgeEffect should be in [0, 1], so expRadius >= expDist >= expDist*expEdgeEffect
 	assert(expRadius >= expRim);
@@ -144,11 +148,11 @@ void CGameHelper::DoExplosionDamage(
 
 	// avoid float calculations when not needed, these can introduce
 	// tiny errors where a unit then survives on 0.0001 health
-	const float expDistanceMod = expEdgeEffect == 1.0f || expDist < 1.0f
+	falloff.expDistanceMod = expEdgeEffect == 1.0f || falloff.expDist < 1.0f
 		? 1.0f
-		: (expRadius + 0.001f - expDist) / (expRadius + 0.001f - expRim)
+		: (expRadius + 0.001f - falloff.expDist) / (expRadius + 0.001f - expRim)
 	;
-	const float modImpulseScale = CalcImpulseScale(damages, expDistanceMod);
+	const float modImpulseScale = CalcImpulseScale(damages, falloff.expDistanceMod);
 
 	// NOTE: if an explosion occurs right underneath a
 	// unit's map footprint, it might cause damage even
@@ -158,56 +162,76 @@ void CGameHelper::DoExplosionDamage(
 	// include units that should not be touched)
 
 	const float3 impulseDir = (volPos - expPos).SafeNormalize();
-	const float3 expImpulse = impulseDir * modImpulseScale;
+	falloff.impulse = impulseDir * modImpulseScale;
+
+	return falloff;
+}
 
-	DamageArray expDamages = damages * expDistanceMod;
+void CGameHelper::ApplyExplosionDamage(
+	CUnit* unit,
+	CUnit* owner,
+	const ExplosionFalloff& falloff,
+	const float expSpeed,
+	const DamageArray& damages,
+	const int weaponDefID,
+	const int projectileID
+) {
+	DamageArray expDamages = damages * falloff.expDistanceMod;
 
-	if (expDist < (expSpeed * DIRECT_EXPLOSION_DAMAGE_SPEED_SCALE)) {
+	if (falloff.expDist < (expSpeed * DIRECT_EXPLOSION_DAMAGE_SPEED_SCALE)) {
 		// damage directly
-		unit->DoDamage(expDamages, expImpulse, owner, weaponDefID, projectileID);
+		unit->DoDamage(expDamages, falloff.impulse, owner, weaponDefID, projectileID);
 	} else {
 		// damage later
-		waitingDamages[(gs->frameNum + int(expDist / expSpeed) - (DIRECT_EXPLOSION_DAMAGE_SPEED_SCALE - 1)) & (waitingDamages.size() - 1)].emplace_back(std::move(expDamages), expImpulse, ((owner != nullptr)? owner->id: -1), unit->id, weaponDefID, projectileID);
+		waitingDamages[(gs->frameNum + int(falloff.expDist / expSpeed) - (DIRECT_EXPLOSION_DAMAGE_SPEED_SCALE - 1)) & (waitingDamages.size() - 1)].emplace_back(std::move(expDamages), falloff.impulse, ((owner != nullptr)? owner->id: -1), unit->id, weaponDefID, projectileID);
 	}
 }
 
 void CGameHelper::DoExplosionDamage(
-	CFeature* feature,
+	CUnit* unit,
 	CUnit* owner,
 	const float3& expPos,
 	const float expRadius,
+	const float expSpeed,
 	const float expEdgeEffect,
+	const bool ignoreOwner,
 	const DamageArray& damages,
 	const int weaponDefID,
 	const int projectileID
 ) {
 	RECOIL_DETAILED_TRACY_ZONE;
-	assert(feature != nullptr);
-
-	const LocalModelPiece* lhp = feature->GetLastHitPiece(gs->frameNum);
-	const CollisionVolume* vol = feature->GetCollisionVolume(lhp);
+	assert(unit != nullptr);
 
-	const float3& lhpPos = (lhp != nullptr && vol == lhp->GetCollisionVolume())? lhp->GetAbsolutePos(): ZeroVector;
-	const float3& volPos = vol->GetWorldSpacePos(feature, lhpPos);
+	if (ignoreOwner && (unit == owner))
+		return;
 
-	const float expDist = (expRadius != 0.0f) ? vol->GetPointSurfaceDistance(feature, nullptr, expPos) : 0.0f;
-	const float expRim = expDist * expEdgeEffect;
+	const ExplosionFalloff falloff = CalcExplosionFalloff(unit, unit->GetLastHitPiece(gs->frameNum), expPos, expRadius, expEdgeEffect, damages);
 
-	if (expDist > expRadius)
+	if (!falloff.inRange)
 		return;
 
-	assert(expRadius >= expRim);
+	ApplyExplosionDamage(unit, owner, falloff, expSpeed, damages, weaponDefID, projectileID);
+}
 
-	const float expDistanceMod = expEdgeEffect == 1.0f || expDist < 1.0f
-		? 1.0f
-		: (expRadius + 0.001f - expDist) / (expRadius + 0.001f - expRim)
-	;
-	const float modImpulseScale = CalcImpulseScale(damages, expDistanceMod);
+void CGameHelper::DoExplosionDamage(
+	CFeature* feature,
+	CUnit* owner,
+	const float3& expPos,
+	const float expRadius,
+	const float expEdgeEffect,
+	const DamageArray& damages,
+	const int weaponDefID,
+	const int projectileID
+) {
+	RECOIL_DETAILED_TRACY_ZONE;
+	assert(feature != nullptr);
 
-	const float3 impulseDir = (volPos - expPos).SafeNormalize();
-	const float3 expImpulse = impulseDir * modImpulseScale;
+	const ExplosionFalloff falloff = CalcExplosionFalloff(feature, feature->GetLastHitPiece(gs->frameNum), expPos, expRadius, expEdgeEffect, damages);
 
-	feature->DoDamage(damages * expDistanceMod, expImpulse, owner, weaponDefID, projectileID);
+	if (!falloff.inRange)
+		return;
+
+	feature->DoDamage(damages * falloff.expDistanceMod, falloff.impulse, owner, weaponDefID, projectileID);
 }
 
 
@@ -216,6 +240,15 @@ void CGameHelper::DamageObjectsInExplosionRadius(
 	const CExplosionParams& params,
 	const float expRad,
 	const int weaponDefID
+) {
+	DamageObjectsInExplosionRadius(params, expRad, weaponDefID, nullptr);
+}
+
+void CGameHelper::DamageObjectsInExplosionRadius(
+	const CExplosionParams& params,
+	const float expRad,
+	const int weaponDefID,
+	const QueuedExplosion* queued
 ) {
 	RECOIL_DETAILED_TRACY_ZONE;
 	static std::vector<CUnit*> unitCache;
@@ -224,30 +257,275 @@ void CGameHelper::DamageObjectsInExplosionRadius(
 	const unsigned int oldNumUnits = unitCache.size();
 	const unsigned int oldNumFeatures = featureCache.size();
 
+	// always query, even for batched explosions: Lua reacting to an earlier
+	// explosion of the batch may have moved objects into range of this one
 	quadField.GetUnitsAndFeaturesColVol(params.pos, expRad, unitCache, featureCache);
 
 	const unsigned int newNumUnits = unitCache.size();
 	const unsigned int newNumFeatures = featureCache.size();
 
+	size_t unitCursor = 0;
+	size_t featureCursor = 0;
+
 	// damage all units within the explosion radius
 	// NOTE:
 	//   this can recursively trigger ::Explosion() again
 	//   which would overwrite our object cache if we did
 	//   not keep track of end-markers --> certain objects
 	//   would not be damaged AT ALL (!)
-	for (unsigned int n = oldNumUnits; n < newNumUnits; n++)
-		DoExplosionDamage(unitCache[n], params.owner, params.pos, expRad, params.explosionSpeed, params.edgeEffectiveness, params.ignoreOwner, params.damages, weaponDefID, params.projectileID);
+	for (unsigned int n = oldNumUnits; n < newNumUnits; n++) {
+		CUnit* unit = unitCache[n];
+
+		// reuse the falloff EndExplosionBatch computed if the unit is unchanged
+		const ExplosionTarget* target = nullptr;
+
+		if (queued != nullptr && !(params.ignoreOwner && (unit == params.owner)))
+			target = FindExplosionTarget(queued->units, queued->unitTargets, unitCursor, unit);
+
+		if (target == nullptr) {
+			DoExplosionDamage(unit, params.owner, params.pos, expRad, params.explosionSpeed, params.edgeEffectiveness, params.ignoreOwner, params.damages, weaponDefID, params.projectileID);
+			continue;
+		}
+
+		if (!target->falloff.inRange)
+			continue;
+
+		ApplyExplosionDamage(unit, params.owner, target->falloff, params.explosionSpeed, params.damages, weaponDefID, params.projectileID);
+	}
 
 	unitCache.resize(oldNumUnits);
 
 	// damage all features within the explosion radius
-	for (unsigned int n = oldNumFeatures; n < newNumFeatures; n++)
-		DoExplosionDamage(featureCache[n], params.owner, params.pos, expRad, params.edgeEffectiveness, params.damages, weaponDefID, params.projectileID);
+	for (unsigned int n = oldNumFeatures; n < newNumFeatures; n++) {
+		CFeature* feature = featureCache[n];
+
+		const ExplosionTarget* target = nullptr;
+
+		if (queued != nullptr)
+			target = FindExplosionTarget(queued->features, queued->featureTargets, featureCursor, feature);
+
+		if (target == nullptr) {
+			DoExplosionDamage(feature, params.owner, params.pos, expRad, params.edgeEffectiveness, params.damages, weaponDefID, params.projectileID);
+			continue;
+		}
+
+		if (!target->falloff.inRange)
+			continue;
+
+		feature->DoDamage(params.damages * target->falloff.expDistanceMod, target->falloff.impulse, params.owner, weaponDefID, params.projectileID);
+	}
 
 	featureCache.resize(oldNumFeatures);
 }
 
+
+template<typename T>
+const CGameHelper::ExplosionTarget* CGameHelper::FindExplosionTarget(
+	const std::vector<T*>& objects,
+	const std::vector<ExplosionTarget>& targets,
+	size_t& cursor,
+	const T* object
+) {
+	// both lists come from the same quadfield query order, so anything
+	// gathered earlier is found at or after the previous match
+	const auto it = std::find(objects.begin() + cursor, objects.end(), object);
+
+	if (it == objects.end())
+		return nullptr;
+
+	cursor = (it - objects.begin()) + 1;
+
+	const ExplosionTarget& target = targets[cursor - 1];
+
+	if (target.HasMoved(object, gs->frameNum))
+		return nullptr;
+
+	return &target;
+}
+
+
+void CGameHelper::ExplosionTarget::Snapshot(const CSolidObject* obj, int frame)
+{
+	// piece transforms are updated lazily, bring them up to date here
+	if ((hitPiece = obj->GetLastHitPiece(frame)) != nullptr)
+		pieceMatrix = hitPiece->GetModelSpaceMatrix();
+
+	volume = obj->GetCollisionVolume(hitPiece);
+
+	pos = obj->pos;
+	frontdir = obj->frontdir;
+	updir = obj->updir;
+	midPos = obj->midPos;
+	aimPos = obj->aimPos;
+
+	volScales = volume->GetScales();
+	volOffsets = volume->GetOffsets();
+	volType = volume->GetVolumeType();
+	volAxis = volume->GetPrimaryAxis();
+}
+
+bool CGameHelper::ExplosionTarget::HasMoved(const CSolidObject* obj, int frame) const
+{
+	if (hitPiece != obj->GetLastHitPiece(frame))
+		return true;
+
+	// Lua can swap between the object and piece volumes or reshape either
+	const CollisionVolume* vol = obj->GetCollisionVolume(hitPiece);
+
+	if (vol != volume || vol->GetVolumeType() != volType || vol->GetPrimaryAxis() != volAxis)
+		return true;
+
+	// float3::operator!= is epsilon-based, anything but exact could change the result
+	const auto Differs = [](const float3& a, const float3& b) { return (a.x != b.x || a.y != b.y || a.z != b.z); };
+
+	if (Differs(volScales, vol->GetScales()) || Differs(volOffsets, vol->GetOffsets()))
+		return true;
+
+	if (Differs(pos, obj->pos) || Differs(frontdir, obj->frontdir) || Differs(updir, obj->updir))
+		return true;
+	if (Differs(midPos, obj->midPos) || Differs(aimPos, obj->aimPos))
+		return true;
+
+	// scripts can move the hit piece without moving the object
+	return (hitPiece != nullptr && !std::equal(std::begin(pieceMatrix.m), std::end(pieceMatrix.m), std::begin(hitPiece->GetModelSpaceMatrix().m)));
+}
+
+
+void CGameHelper::BeginExplosionBatch()
+{
+	assert(!batchExplosions);
+	assert(numQueuedExplosions == 0);
+
+	// synced Explosion call-ins must keep firing in between the collisions
+	// that cause them, gadgets watching any weapon keep the serial path
+	batchExplosions = !eventHandler.HasSyncedClient("Explosion");
+}
+
+void CGameHelper::GatherExplosionTargets(QueuedExplosion& queued, int threadNum)
+{
+	queued.units.clear();
+	queued.features.clear();
+	queued.unitTargets.clear();
+	queued.featureTargets.clear();
+
+	if (queued.impactOnly)
+		return;
+
+	quadField.GetUnitsAndFeaturesColVolMT(queued.pos, std::max(1.0f, queued.damageAreaOfEffect), queued.units, queued.features, threadNum);
+
+	queued.unitTargets.resize(queued.units.size());
+	queued.featureTargets.resize(queued.features.size());
+}
+
+void CGameHelper::EndExplosionBatch()
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+
+	// anything exploding from here on (e.g. dying units) is resolved immediately
+	batchExplosions = false;
+
+	if (numQueuedExplosions == 0)
+		return;
+
+	const int frameNum = gs->frameNum;
+
+	// 1) find the objects in range of each explosion
+	for_mt(0, numQueuedExplosions, [&](const int i) {
+		GatherExplosionTargets(queuedExplosions[i], ThreadPool::GetThreadNum());
+	});
+
+	// 2) snapshot the state the falloffs depend on; this also brings the
+	// lazily updated hit-piece transforms up to date before going parallel
+	for (size_t i = 0; i < numQueuedExplosions; i++) {
+		QueuedExplosion& queued = queuedExplosions[i];
+
+		for (size_t n = 0; n < queued.units.size(); n++) {
+			queued.unitTargets[n].Snapshot(queued.units[n], frameNum);
+		}
+		for (size_t n = 0; n < queued.features.size(); n++) {
+			queued.featureTargets[n].Snapshot(queued.features[n], frameNum);
+		}
+	}
+
+	// 3) damage falloff and impulse per object
+	for_mt(0, numQueuedExplosions, [&](const int i) {
+		QueuedExplosion& queued = queuedExplosions[i];
+
+		const float expRad = std::max(1.0f, queued.damageAreaOfEffect);
+
+		for (size_t n = 0; n < queued.units.size(); n++) {
+			queued.unitTargets[n].falloff = CalcExplosionFalloff(queued.units[n], queued.unitTargets[n].hitPiece, queued.pos, expRad, queued.edgeEffectiveness, queued.damages);
+		}
+		for (size_t n = 0; n < queued.features.size(); n++) {
+			queued.featureTargets[n].falloff = CalcExplosionFalloff(queued.features[n], queued.featureTargets[n].hitPiece, queued.pos, expRad, queued.edgeEffectiveness, queued.damages);
+		}
+	});
+
+	// 4) commit in the order the explosions happened; deletions are deferred
+	// until the end of the frame so all gathered objects stay valid, and the
+	// targets are queried again so objects that were created or moved while
+	// committing an earlier explosion are not missed
+	for (size_t i = 0; i < numQueuedExplosions; i++) {
+		QueuedExplosion& queued = queuedExplosions[i];
+
+		const CExplosionParams params = {
+			.pos                  = queued.pos,
+			.dir                  = queued.dir,
+			.damages              = queued.damages,
+			.weaponDef            = queued.weaponDef,
+			.owner                = queued.owner,
+			.hitObject            = ExplosionHitObject(queued.hitUnit, queued.hitFeature, queued.hitWeapon),
+			.craterAreaOfEffect   = queued.craterAreaOfEffect,
+			.damageAreaOfEffect   = queued.damageAreaOfEffect,
+			.edgeEffectiveness    = queued.edgeEffectiveness,
+			.explosionSpeed       = queued.explosionSpeed,
+			.gfxMod               = queued.gfxMod,
+			.maxGroundDeformation = queued.maxGroundDeformation,
+			.impactOnly           = queued.impactOnly,
+			.ignoreOwner          = queued.ignoreOwner,
+			.damageGround         = queued.damageGround,
+			.projectileID         = queued.projectileID
+		};
+
+		ExplosionImpl(params, &queued);
+	}
+
+	numQueuedExplosions = 0;
+}
+
+
 void CGameHelper::Explosion(const CExplosionParams& params) {
+	if (!batchExplosions) {
+		ExplosionImpl(params, nullptr);
+		return;
+	}
+
+	if (numQueuedExplosions == queuedExplosions.size())
+		queuedExplosions.emplace_back();
+
+	QueuedExplosion& queued = queuedExplosions[numQueuedExplosions++];
+
+	queued.damages = params.damages;
+	queued.pos = params.pos;
+	queued.dir = params.dir;
+	queued.weaponDef = params.weaponDef;
+	queued.owner = params.owner;
+	queued.hitUnit = params.hitObject.GetTyped<CUnit>();
+	queued.hitFeature = params.hitObject.GetTyped<CFeature>();
+	queued.hitWeapon = params.hitObject.GetTyped<CWeapon>();
+	queued.craterAreaOfEffect = params.craterAreaOfEffect;
+	queued.damageAreaOfEffect = params.damageAreaOfEffect;
+	queued.edgeEffectiveness = params.edgeEffectiveness;
+	queued.explosionSpeed = params.explosionSpeed;
+	queued.gfxMod = params.gfxMod;
+	queued.maxGroundDeformation = params.maxGroundDeformation;
+	queued.impactOnly = params.impactOnly;
+	queued.ignoreOwner = params.ignoreOwner;
+	queued.damageGround = params.damageGround;
+	queued.projectileID = params.projectileID;
+}
+
+void CGameHelper::ExplosionImpl(const CExplosionParams& params, const QueuedExplosion* queued) {
 	RECOIL_DETAILED_TRACY_ZONE;
 	const DamageArray& damages = params.damages;
 
@@ -300,7 +578,7 @@ void CGameHelper::Explosion(const CExplosionParams& params) {
 			);
 		}
 	} else {
-		DamageObjectsInExplosionRadius(params, damageAOE, weaponDefID);
+		DamageObjectsInExplosionRadius(params, damageAOE, weaponDefID, queued);
 
 		// deform the map if the explosion was above-ground
 		// (but had large enough radius to touch the ground)
@@ -1141,10 +1419,12 @@ float3 CGameHelper::ClosestBuildPos(
 		// check for nearby blocking objects
 		for (int z = zmin; z < zmax; ++z) {
 			for (int x = xmin; x < xmax; ++x) {
+				// no building or feature anywhere in this square
+				if ((groundBlockingObjectMap.GetCellMaskUnsafe(z * mapDims.mapx + x) & CGroundBlockingObjectMap::CELL_MASK_IMMOBILE) == 0)
+					continue;
+
 				const CSolidObject* solObj = groundBlockingObjectMap.GroundBlockedUnsafe(z * mapDims.mapx + x);
 
-				if (solObj == nullptr)
-					continue;
 				// immobile=true implies Feature or Building
 				if (!solObj->immobile)
 					continue;
@@ -1163,10 +1443,11 @@ float3 CGameHelper::ClosestBuildPos(
 			// none found, check for nearby factories with open yards
 			for (int z = zmin; z < zmax; ++z) {
 				for (int x = xmin; x < xmax; ++x) {
+					if ((groundBlockingObjectMap.GetCellMaskUnsafe(z * mapDims.mapx + x) & CGroundBlockingObjectMap::CELL_MASK_IMMOBILE) == 0)
+						continue;
+
 					const CSolidObject* solObj = groundBlockingObjectMap.GroundBlockedUnsafe(z * mapDims.mapx + x);
 
-					if (solObj == nullptr)
-						continue;
 					if (!solObj->immobile)
 						continue;
 					if (!solObj->yardOpen)
@@ -8,6 +8,7 @@
 #include "Sim/Misc/GlobalConstants.h"
 #include "System/TemplateUtils.hpp"
 #include "System/EventClient.h"
+#include "System/Matrix44f.h"
 #include "System/float3.h"
 #include "System/float4.h"
 #include "System/type2.h"
@@ -27,6 +28,8 @@ class CMobileCAI;
 struct UnitDef;
 struct MoveDef;
 struct BuildInfo;
+struct LocalModelPiece;
+struct CollisionVolume;
 
 class ExplosionHitObject {
 private:
@@ -243,7 +246,113 @@ public:
 	void DamageObjectsInExplosionRadius(const CExplosionParams& params, const float expRad, const int weaponDefID);
 	void Explosion(const CExplosionParams& params);
 
+	/**
+	 * While a batch is open, Explosion() only queues its parameters and
+	 * EndExplosionBatch resolves the queue in the original order. Gathering
+	 * the objects in range and the damage falloff run in parallel across
+	 * explosions; damage, impulses, craters and events are then committed
+	 * serially exactly as an immediate Explosion() would, re-querying the
+	 * objects in range and reusing only falloffs of unchanged objects.
+	 * Explosions caused while committing (e.g. by dying units) are not
+	 * batched, and nothing is while a synced Explosion call-in is active.
+	 */
+	void BeginExplosionBatch();
+	void EndExplosionBatch();
+
 private:
+	struct ExplosionFalloff {
+		float expDist = 0.0f;
+		float expDistanceMod = 0.0f;
+
+		float3 impulse;
+
+		bool inRange = false;
+	};
+
+	struct ExplosionTarget {
+		// state the falloff was computed from; if an earlier explosion
+		// (or Lua reacting to it) changed any of it, it is recomputed
+		void Snapshot(const CSolidObject* obj, int frame);
+		bool HasMoved(const CSolidObject* obj, int frame) const;
+
+		const LocalModelPiece* hitPiece;
+		const CollisionVolume* volume;
+
+		CMatrix44f pieceMatrix;
+
+		float3 pos;
+		float3 frontdir;
+		float3 updir;
+		float3 midPos;
+		float3 aimPos;
+
+		float3 volScales;
+		float3 volOffsets;
+		int volType;
+		int volAxis;
+
+		ExplosionFalloff falloff;
+	};
+
+	struct QueuedExplosion {
+		// CExplosionParams references its damages and owns a non-copyable
+		// hit-object, so store everything needed to rebuild it by value
+		DamageArray damages;
+
+		float3 pos;
+		float3 dir;
+
+		const WeaponDef* weaponDef;
+
+		CUnit* owner;
+		CUnit* hitUnit;
+		CFeature* hitFeature;
+		CWeapon* hitWeapon;
+
+		float craterAreaOfEffect;
+		float damageAreaOfEffect;
+		float edgeEffectiveness;
+		float explosionSpeed;
+		float gfxMod;
+		float maxGroundDeformation;
+
+		bool impactOnly;
+		bool ignoreOwner;
+		bool damageGround;
+
+		uint32_t projectileID;
+
+		// objects in range when the batch was resolved, and their falloffs;
+		// only a cache, the committing explosion queries its targets again
+		std::vector<CUnit*> units;
+		std::vector<CFeature*> features;
+		std::vector<ExplosionTarget> unitTargets;
+		std::vector<ExplosionTarget> featureTargets;
+	};
+
+	template<typename T>
+	static ExplosionFalloff CalcExplosionFalloff(
+		const T* object,
+		const LocalModelPiece* hitPiece,
+		const float3& expPos,
+		const float expRadius,
+		const float expEdgeEffect,
+		const DamageArray& damages
+	);
+
+	void ApplyExplosionDamage(CUnit* unit, CUnit* owner, const ExplosionFalloff& falloff, const float expSpeed, const DamageArray& damages, const int weaponDefID, const int projectileID);
+	void DamageObjectsInExplosionRadius(const CExplosionParams& params, const float expRad, const int weaponDefID, const QueuedExplosion* queued);
+
+	template<typename T>
+	static const ExplosionTarget* FindExplosionTarget(const std::vector<T*>& objects, const std::vector<ExplosionTarget>& targets, size_t& cursor, const T* object);
+
+	void GatherExplosionTargets(QueuedExplosion& queued, int threadNum);
+	void ExplosionImpl(const CExplosionParams& params, const QueuedExplosion* queued);
+
+	std::vector<QueuedExplosion> queuedExplosions;
+	size_t numQueuedExplosions = 0;
+	bool batchExplosions = false;
+
 	struct WaitingDamage {
 		WaitingDamage(const DamageArray& _damage, const float3& _impulse, int _attackerID, int _targetID, int _weaponID, int _projectileID)
 		: attackerID(_attackerID)
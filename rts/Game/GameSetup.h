@@ -220,6 +220,8 @@ public:
 	std::string demoName;
 
 	inline static bool forceOnlyLocal = false;
+	/// feed demo frames to the client as fast as it consumes them (--sim-benchmark)
+	inline static bool unpacedDemoPlayback = false;
 private:
 	spring::unordered_map<int, int> playerRemap;
 	spring::unordered_map<int, int> teamRemap;
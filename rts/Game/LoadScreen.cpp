@@ -344,6 +344,9 @@ void CLoadScreen::SetLoadMessage(const std::string& text, bool replaceLast)
 
 	if (mtLoading)
 		return;
+	// async loading stages run on workers without a GL context
+	if (!Threading::IsGameLoadThread())
+		return;
 
 	Update();
 	Draw();
@@ -0,0 +1,181 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "LoadStageGraph.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+
+#include "System/Exceptions.h"
+#include "System/Log/ILog.h"
+#include "System/Platform/Watchdog.h"
+#include "System/Threading/ThreadPool.h"
+
+
+CLoadStageGraph::~CLoadStageGraph()
+{
+	// async stages capture the caller's locals by reference; never let
+	// them outlive the graph, even if Run was left through an exception
+	for (Stage& stage: stages) {
+		if (stage.async && stage.launched)
+			stage.future.wait();
+	}
+}
+
+
+CLoadStageGraph::StageID CLoadStageGraph::AddStage(const char* name, std::function<void()>&& func, std::initializer_list<StageID> deps, uint32_t flags)
+{
+	Stage& stage = stages.emplace_back();
+
+	stage.name = name;
+	stage.func = std::move(func);
+	stage.deps = deps;
+
+	stage.async = ((flags & STAGE_ASYNC) != 0);
+	stage.skipOnError = ((flags & STAGE_SKIP_ON_ERROR) != 0);
+
+	// dependencies must already exist, which also rules out cycles
+	assert(std::all_of(stage.deps.begin(), stage.deps.end(), [&](StageID d) { return (d < (stages.size() - 1)); }));
+
+	return static_cast<StageID>(stages.size() - 1);
+}
+
+
+void CLoadStageGraph::Run()
+{
+	runStartTime = spring_gettime();
+
+	for (Stage& stage: stages) {
+		// start every async stage that is ready before (possibly) blocking
+		// on a dependency, so they overlap with the loading thread's work
+		LaunchReadyStages();
+
+		if (stage.async)
+			continue;
+
+		for (const StageID dep: stage.deps) {
+			WaitForStage(stages[dep]);
+		}
+
+		stage.launched = true;
+
+		ExecStage(stage);
+
+		stage.done = true;
+	}
+
+	// async stages no synchronous stage depended on
+	for (Stage& stage: stages) {
+		WaitForStage(stage);
+	}
+
+	runEndTime = spring_gettime();
+}
+
+
+bool CLoadStageGraph::HasErrors() const
+{
+	std::lock_guard<spring::mutex> lck(errorMutex);
+	return (!errors.empty());
+}
+
+std::vector<std::string> CLoadStageGraph::GetErrors() const
+{
+	std::lock_guard<spring::mutex> lck(errorMutex);
+	return errors;
+}
+
+
+void CLoadStageGraph::LogTimings(const char* caller) const
+{
+	float sumTime = 0.0f;
+
+	for (const Stage& stage: stages) {
+		sumTime += (stage.endTime - stage.startTime).toMilliSecsf();
+	}
+
+	// sum > wall-time is what overlapping the stages bought us
+	LOG("[%s] loading stages took %.1fms (%.1fms if run sequentially)", caller, (runEndTime - runStartTime).toMilliSecsf(), sumTime);
+
+	for (const Stage& stage: stages) {
+		const char* status = stage.skipped? "skipped": (stage.failed? "failed": "done");
+		const char* thread = stage.async? "worker": "loader";
+
+		const float startTime = (stage.startTime - runStartTime).toMilliSecsf();
+		const float deltaTime = (stage.endTime - stage.startTime).toMilliSecsf();
+
+		LOG("\t%-24s %9.1fms (started at %9.1fms on %s thread, %s)", stage.name.c_str(), deltaTime, startTime, thread, status);
+	}
+}
+
+
+bool CLoadStageGraph::IsDone(const Stage& stage) const
+{
+	if (!stage.async)
+		return stage.done;
+	if (!stage.launched)
+		return false;
+
+	return (stage.future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+}
+
+bool CLoadStageGraph::DepsDone(const Stage& stage) const
+{
+	return (std::all_of(stage.deps.begin(), stage.deps.end(), [&](StageID d) { return IsDone(stages[d]); }));
+}
+
+
+void CLoadStageGraph::LaunchReadyStages()
+{
+	for (Stage& stage: stages) {
+		if (!stage.async || stage.launched)
+			continue;
+		if (!DepsDone(stage))
+			continue;
+
+		stage.launched = true;
+		stage.future = ThreadPool::Enqueue([this, &stage]() { ExecStage(stage); });
+	}
+}
+
+void CLoadStageGraph::WaitForStage(Stage& stage)
+{
+	if (!stage.async)
+		return;
+
+	while (!IsDone(stage)) {
+		// the stage (or one it depends on) is making progress elsewhere;
+		// keep launching newly ready stages and the watchdog at bay
+		LaunchReadyStages();
+		Watchdog::ClearTimer(WDT_LOAD);
+
+		if (stage.launched)
+			stage.future.wait_for(std::chrono::milliseconds(10));
+	}
+
+	// rethrows anything that escaped ExecStage
+	stage.future.get();
+}
+
+void CLoadStageGraph::ExecStage(Stage& stage)
+{
+	stage.startTime = spring_gettime();
+
+	if (stage.skipOnError && HasErrors()) {
+		stage.skipped = true;
+	} else {
+		try {
+			stage.func();
+		} catch (const content_error& e) {
+			LOG_L(L_ERROR, "[LoadStageGraph::%s] stage \"%s\" forced quit with exception \"%s\"", __func__, stage.name.c_str(), e.what());
+
+			std::lock_guard<spring::mutex> lck(errorMutex);
+			errors.emplace_back(e.what());
+			stage.failed = true;
+		}
+	}
+
+	stage.endTime = spring_gettime();
+
+	Watchdog::ClearTimer(WDT_LOAD);
+}
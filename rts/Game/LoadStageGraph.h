@@ -0,0 +1,103 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef _LOAD_STAGE_GRAPH_H
+#define _LOAD_STAGE_GRAPH_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "System/Misc/SpringTime.h"
+#include "System/Threading/SpringThreading.h"
+
+/**
+ * Runs the stages of CGame::Load as a small dependency graph.
+ *
+ * Stages run on the loading thread in the order they were added, unless
+ * they are flagged as STAGE_ASYNC; those are handed to the ThreadPool as
+ * soon as all their dependencies are done and overlap with whatever the
+ * loading thread does meanwhile. Async stages must not touch GL, the
+ * load-lock or any Lua handle, and must not depend on a stage added after
+ * them.
+ *
+ * Dependencies only order stages: a stage whose dependency failed with a
+ * content_error still runs (the CGame dtor expects every basic loading
+ * step to have happened), unless it is flagged STAGE_SKIP_ON_ERROR.
+ */
+class CLoadStageGraph
+{
+public:
+	typedef uint32_t StageID;
+
+	enum StageFlags {
+		STAGE_ASYNC         = 1 << 0, ///< may run on a worker thread
+		STAGE_SKIP_ON_ERROR = 1 << 1, ///< not run once any stage has failed
+	};
+
+public:
+	CLoadStageGraph() = default;
+	CLoadStageGraph(const CLoadStageGraph&) = delete;
+	~CLoadStageGraph();
+
+	CLoadStageGraph& operator = (const CLoadStageGraph&) = delete;
+
+	StageID AddStage(const char* name, std::function<void()>&& func, std::initializer_list<StageID> deps = {}, uint32_t flags = 0);
+
+	/**
+	 * Runs all stages and returns once every one of them has finished.
+	 * Exceptions other than content_error are rethrown on the calling
+	 * thread, including those thrown by async stages.
+	 */
+	void Run();
+
+	bool HasErrors() const;
+	/// only valid once the stage is done, i.e. from a stage depending on it
+	bool HasFailed(StageID id) const { return stages[id].failed; }
+
+	std::vector<std::string> GetErrors() const;
+
+	void LogTimings(const char* caller) const;
+
+private:
+	struct Stage {
+		std::string name;
+		std::function<void()> func;
+		std::vector<StageID> deps;
+
+		std::shared_future<void> future;
+
+		spring_time startTime;
+		spring_time endTime;
+
+		bool async = false;
+		bool skipOnError = false;
+
+		bool launched = false;
+		bool done = false; // only used by synchronous stages
+		bool skipped = false;
+		bool failed = false;
+	};
+
+	bool IsDone(const Stage& stage) const;
+	bool DepsDone(const Stage& stage) const;
+
+	void LaunchReadyStages();
+	void WaitForStage(Stage& stage);
+	void ExecStage(Stage& stage);
+
+private:
+	// stages hold futures and are referenced by worker threads
+	std::deque<Stage> stages;
+	std::vector<std::string> errors;
+
+	mutable spring::mutex errorMutex;
+
+	spring_time runStartTime;
+	spring_time runEndTime;
+};
+
+#endif // _LOAD_STAGE_GRAPH_H
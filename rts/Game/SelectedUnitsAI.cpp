@@ -245,6 +245,9 @@ bool CSelectedUnitsHandlerAI::GiveCommandNet(Command& c, int playerNum)
 	}
 	{
 		// command without special group modifiers
+		std::vector<CUnit*> units;
+		units.reserve(numSelectedUnits);
+
 		for (const int unitID: netSelectedUnitIDs) {
 			CUnit* unit = unitHandler.GetUnit(unitID);
 
@@ -256,9 +259,13 @@ bool CSelectedUnitsHandlerAI::GiveCommandNet(Command& c, int playerNum)
 			if (MayRequireSetMaxSpeedCommand(c))
 				SetUnitWantedMaxSpeedNet(unit);
 
-			unit->commandAI->GiveCommand(c, playerNum, ret = true, false);
+			units.push_back(unit);
 		}
 
+		CCommandAI::GiveCommandToUnits(units, c, playerNum, true, false);
+
+		ret = !units.empty();
+
 		if (cmdID != CMD_WAIT)
 			return ret;
 		if (playerNum != gu->myPlayerNum)
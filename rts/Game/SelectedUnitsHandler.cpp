@@ -762,6 +762,17 @@ void CSelectedUnitsHandler::ClearNetSelect(int playerId)
 	netSelected[playerId].clear();
 }
 
+static bool CanGiveAINetOrder(const CUnit* unit, const CPlayer* player, int aiTeamID)
+{
+	// no warning; will result in false bug reports due to latency between
+	// time of giving valid orders on units which then change team through
+	// e.g. LuaRules
+	// AI's are hosted by players, but do not have any Player representation
+	// themselves and should not be automatically controllable by their host
+	// on the other hand they should always be able to control their OWN team
+	return ((aiTeamID != MAX_TEAMS || player->CanControlTeam(unit->team)) && (aiTeamID == MAX_TEAMS || aiTeamID == unit->team));
+}
+
 // handles NETMSG_AICOMMAND{S}'s sent by AICallback / LuaUnsyncedCtrl (!)
 void CSelectedUnitsHandler::AINetOrder(int unitID, int aiTeamID, int playerID, const Command& c)
 {
@@ -776,13 +787,7 @@ void CSelectedUnitsHandler::AINetOrder(int unitID, int aiTeamID, int playerID, c
 	if (player == nullptr)
 		return;
 
-	// no warning; will result in false bug reports due to latency between
-	// time of giving valid orders on units which then change team through
-	// e.g. LuaRules
-	// AI's are hosted by players, but do not have any Player representation
-	// themselves and should not be automatically controllable by their host
-	// on the other hand they should always be able to control their OWN team
-	if ((aiTeamID == MAX_TEAMS && !player->CanControlTeam(unit->team)) || (aiTeamID != MAX_TEAMS && aiTeamID != unit->team))
+	if (!CanGiveAINetOrder(unit, player, aiTeamID))
 		return;
 
 	// always pulled from net, synced command by definition
@@ -791,6 +796,32 @@ void CSelectedUnitsHandler::AINetOrder(int unitID, int aiTeamID, int playerID, c
 	unit->commandAI->GiveCommand(c, playerID, true, false);
 }
 
+// handles NETMSG_AICOMMANDS's that give the same command to every unit
+void CSelectedUnitsHandler::AINetOrder(const std::vector<int32_t>& unitIDs, int aiTeamID, int playerID, const Command& c)
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	const CPlayer* player = playerHandler.Player(playerID);
+
+	if (player == nullptr)
+		return;
+
+	std::vector<CUnit*> units;
+	units.reserve(unitIDs.size());
+
+	for (const int32_t unitID: unitIDs) {
+		CUnit* unit = unitHandler.GetUnit(unitID);
+
+		if (unit == nullptr)
+			continue;
+		if (!CanGiveAINetOrder(unit, player, aiTeamID))
+			continue;
+
+		units.push_back(unit);
+	}
+
+	CCommandAI::GiveCommandToUnits(units, c, playerID, true, false);
+}
+
 
 /******************************************************************************/
 //
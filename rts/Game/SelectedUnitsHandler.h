@@ -24,6 +24,7 @@ public:
 	void SelectGroup(int num);
 	void SetGroup(CGroup* group, bool fromFactory= false, bool autoSelect = false);
 	void AINetOrder(int unitID, int aiTeamID, int playerID, const Command& c);
+	void AINetOrder(const std::vector<int32_t>& unitIDs, int aiTeamID, int playerID, const Command& c);
 	int GetDefaultCmd(const CUnit* unit, const CFeature* feature);
 
 	void NetOrder(Command& c, int playerId);
@@ -0,0 +1,189 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+
+#include "SimBenchmark.h"
+#include "Sim/Misc/GlobalConstants.h"
+#include "System/SpringExitCode.h"
+#include "System/Config/ConfigHandler.h"
+#include "System/Log/ILog.h"
+
+#include "System/Misc/TracyDefs.h"
+
+CONFIG(float, SimBenchmarkTolerance).defaultValue(0.1f).minimumValue(0.0f).description("Fraction by which the total sim-time of a --sim-benchmark run may exceed its baseline before the run counts as a regression.");
+
+CSimBenchmark simBenchmark;
+
+
+static std::uint64_t GetTotalSimTime(const std::vector<CSimBenchmark::Frame>& frames)
+{
+	std::uint64_t sum = 0;
+
+	for (const auto& frame: frames) {
+		sum += frame.simTime;
+	}
+
+	return sum;
+}
+
+static std::uint32_t GetSimTimePercentile(const std::vector<CSimBenchmark::Frame>& frames, float pct)
+{
+	std::vector<std::uint32_t> times;
+	times.reserve(frames.size());
+
+	for (const auto& frame: frames) {
+		times.push_back(frame.simTime);
+	}
+
+	if (times.empty())
+		return 0;
+
+	const size_t idx = std::min(times.size() - 1, static_cast<size_t>(times.size() * pct));
+
+	std::nth_element(times.begin(), times.begin() + idx, times.end());
+	return times[idx];
+}
+
+
+
+void CSimBenchmark::SetFiles(const std::string& outputFile, const std::string& baselineFile)
+{
+	outputFileName = outputFile;
+	baselineFileName = baselineFile;
+
+	frames.clear();
+	frames.reserve(GAME_SPEED * 60 * 60);
+}
+
+void CSimBenchmark::AddFrame(int frameNum, spring_time simTime, std::uint32_t checkSum)
+{
+	frames.push_back({frameNum, static_cast<std::uint32_t>(std::max<std::int64_t>(simTime.toMicroSecsi(), 0)), checkSum});
+}
+
+void CSimBenchmark::Finish()
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	if (!IsEnabled() || frames.empty())
+		return;
+
+	const std::uint64_t totalTime = GetTotalSimTime(frames);
+
+	LOG("[SimBenchmark::%s] %u frames in %.3fs (%.1f sim-frames/s, p50=%.3fms p99=%.3fms)",
+		__func__,
+		static_cast<unsigned int>(frames.size()),
+		totalTime * 1e-6,
+		frames.size() / std::max(totalTime * 1e-6, 1e-6),
+		GetSimTimePercentile(frames, 0.50f) * 1e-3f,
+		GetSimTimePercentile(frames, 0.99f) * 1e-3f
+	);
+
+	WriteFrames(outputFileName, frames);
+
+	if (!baselineFileName.empty())
+		CompareBaseline();
+
+	frames.clear();
+}
+
+
+bool CSimBenchmark::ReadFrames(const std::string& fileName, std::vector<Frame>& frames)
+{
+	std::FILE* file = std::fopen(fileName.c_str(), "r");
+
+	if (file == nullptr) {
+		LOG_L(L_ERROR, "[SimBenchmark::%s] could not open \"%s\"", __func__, fileName.c_str());
+		return false;
+	}
+
+	char header[64];
+	Frame frame;
+
+	if (std::fgets(header, sizeof(header), file) != nullptr) {
+		while (std::fscanf(file, "%" SCNd32 ",%" SCNu32 ",%" SCNx32, &frame.frameNum, &frame.simTime, &frame.checkSum) == 3) {
+			frames.push_back(frame);
+		}
+	}
+
+	std::fclose(file);
+	return true;
+}
+
+bool CSimBenchmark::WriteFrames(const std::string& fileName, const std::vector<Frame>& frames)
+{
+	std::FILE* file = std::fopen(fileName.c_str(), "w");
+
+	if (file == nullptr) {
+		LOG_L(L_ERROR, "[SimBenchmark::%s] could not open \"%s\" for writing", __func__, fileName.c_str());
+		return false;
+	}
+
+	std::fprintf(file, "frame,simTimeUs,checkSum\n");
+
+	for (const Frame& frame: frames) {
+		std::fprintf(file, "%" PRId32 ",%" PRIu32 ",%08" PRIx32 "\n", frame.frameNum, frame.simTime, frame.checkSum);
+	}
+
+	std::fclose(file);
+	return true;
+}
+
+
+void CSimBenchmark::CompareBaseline() const
+{
+	std::vector<Frame> baseline;
+
+	if (!ReadFrames(baselineFileName, baseline) || baseline.empty()) {
+		LOG_L(L_ERROR, "[SimBenchmark::%s] no frames in baseline \"%s\"", __func__, baselineFileName.c_str());
+		spring::exitCode = spring::EXIT_CODE_FAILURE;
+		return;
+	}
+
+	// both runs replay the same demo, so frames line up by index; compare
+	// only the common prefix in case either run was cut short
+	const size_t numFrames = std::min(frames.size(), baseline.size());
+
+	if (frames.size() != baseline.size())
+		LOG_L(L_WARNING, "[SimBenchmark::%s] frame count differs from baseline (%u vs %u)", __func__, static_cast<unsigned int>(frames.size()), static_cast<unsigned int>(baseline.size()));
+
+	for (size_t i = 0; i < numFrames; i++) {
+		if (frames[i].frameNum != baseline[i].frameNum) {
+			LOG_L(L_ERROR, "[SimBenchmark::%s] frame sequence differs from baseline at index %u", __func__, static_cast<unsigned int>(i));
+			spring::exitCode = spring::EXIT_CODE_DESYNC;
+			break;
+		}
+
+		// a zero checksum means the build was not compiled with SYNCCHECK
+		if (frames[i].checkSum == 0 || baseline[i].checkSum == 0)
+			continue;
+		if (frames[i].checkSum == baseline[i].checkSum)
+			continue;
+
+		LOG_L(L_ERROR, "[SimBenchmark::%s] checksum differs from baseline first at frame %d (%08x vs %08x)", __func__, frames[i].frameNum, frames[i].checkSum, baseline[i].checkSum);
+		spring::exitCode = spring::EXIT_CODE_DESYNC;
+		break;
+	}
+
+	const std::vector<Frame> curFrames(frames.begin(), frames.begin() + numFrames);
+	const std::vector<Frame> refFrames(baseline.begin(), baseline.begin() + numFrames);
+
+	const double curTime = GetTotalSimTime(curFrames) * 1e-6;
+	const double refTime = GetTotalSimTime(refFrames) * 1e-6;
+	const double ratio = curTime / std::max(refTime, 1e-6);
+
+	LOG("[SimBenchmark::%s] total sim-time %.3fs vs baseline %.3fs (%+.1f%%), p50 %.3fms vs %.3fms, p99 %.3fms vs %.3fms",
+		__func__,
+		curTime, refTime, (ratio - 1.0) * 100.0,
+		GetSimTimePercentile(curFrames, 0.50f) * 1e-3f, GetSimTimePercentile(refFrames, 0.50f) * 1e-3f,
+		GetSimTimePercentile(curFrames, 0.99f) * 1e-3f, GetSimTimePercentile(refFrames, 0.99f) * 1e-3f
+	);
+
+	if (ratio <= (1.0 + configHandler->GetFloat("SimBenchmarkTolerance")))
+		return;
+
+	LOG_L(L_ERROR, "[SimBenchmark::%s] sim-time regression exceeds tolerance", __func__);
+
+	if (spring::exitCode == spring::EXIT_CODE_SUCCESS)
+		spring::exitCode = spring::EXIT_CODE_FAILURE;
+}
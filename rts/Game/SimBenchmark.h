@@ -0,0 +1,52 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef SIM_BENCHMARK_H
+#define SIM_BENCHMARK_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "System/Misc/SpringTime.h"
+
+/**
+ * Demo-driven simulation benchmark (--sim-benchmark).
+ *
+ * While a demo is replayed unpaced (no server pacing, no HEADLESS sleep) the
+ * wall-clock time of every SimFrame and the sync checksum after it are kept;
+ * at the end of the game they are written as CSV and, if a baseline file of
+ * the same format is given, compared against it. A checksum mismatch or a
+ * total sim-time above the allowed tolerance sets a non-zero exit code.
+ */
+class CSimBenchmark {
+public:
+	void SetFiles(const std::string& outputFile, const std::string& baselineFile);
+
+	bool IsEnabled() const { return !outputFileName.empty(); }
+
+	void AddFrame(int frameNum, spring_time simTime, std::uint32_t checkSum);
+	void Finish();
+
+public:
+	struct Frame {
+		std::int32_t frameNum;
+		std::uint32_t simTime; // microseconds
+		std::uint32_t checkSum;
+	};
+
+private:
+	static bool ReadFrames(const std::string& fileName, std::vector<Frame>& frames);
+	static bool WriteFrames(const std::string& fileName, const std::vector<Frame>& frames);
+
+	void CompareBaseline() const;
+
+private:
+	std::string outputFileName;
+	std::string baselineFileName;
+
+	std::vector<Frame> frames;
+};
+
+extern CSimBenchmark simBenchmark;
+
+#endif
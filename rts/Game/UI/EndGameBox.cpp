@@ -569,7 +569,7 @@ void CEndGameBox::FillTeamStats()
 		if (pteam->gaia)
 			continue;
 
-		for (const auto& si: pteam->statHistory) {
+		pteam->statHistory.ForEach(0, pteam->statHistory.size(), [&](size_t, const TeamStatistics& si) {
 			stats[ 0].AddStat(team, 0);
 
 			stats[ 1].AddStat(team, si.metalUsed);
@@ -602,6 +602,6 @@ void CEndGameBox::FillTeamStats()
 
 			stats[21].AddStat(team, si.damageDealt);
 			stats[22].AddStat(team, si.damageReceived);
-		}
+		});
 	}
 }
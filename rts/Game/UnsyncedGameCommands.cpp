@@ -104,6 +104,8 @@
 #include "System/TimeProfiler.h"
 #include "System/Log/ILog.h"
 #include "System/Config/ConfigHandler.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileQueryFlags.h"
 #include "System/FileSystem/SimpleParser.h"
 #include "System/Sound/ISound.h"
 #include "System/Sound/ISoundChannels.h"
@@ -3705,6 +3707,27 @@ public:
 	}
 };
 
+class DumpStateBinaryActionExecutor : public IUnsyncedActionExecutor {
+public:
+	DumpStateBinaryActionExecutor() : IUnsyncedActionExecutor("DumpStateBinary", "dump game-state to a compact binary file, see tools/DumpStateDiff") {
+	}
+
+	bool Execute(const UnsyncedAction& action) const final {
+		std::vector<std::string> args = CSimpleParser::Tokenize(action.GetArgs());
+
+		switch (args.size()) {
+			case 1: { DumpStateBinary(StringToInt(args[0]), StringToInt(args[0]),                    1); } break;
+			case 2: { DumpStateBinary(StringToInt(args[0]), StringToInt(args[1]),                    1); } break;
+			case 3: { DumpStateBinary(StringToInt(args[0]), StringToInt(args[1]), StringToInt(args[2])); } break;
+			default: {
+				LOG_L(L_WARNING, "/DumpStateBinary: wrong syntax");
+			} break;
+		}
+
+		return true;
+	}
+};
+
 class DumpRNGActionExecutor : public IUnsyncedActionExecutor {
 public:
 	DumpRNGActionExecutor() : IUnsyncedActionExecutor("DumpRNG", "dump SyncedRNG-state to file") {
@@ -3881,6 +3904,43 @@ public:
 
 
 
+/// /SimFrameProfile [<numFrames> | dump <fileName>]
+class SimFrameProfileActionExecutor : public IUnsyncedActionExecutor {
+public:
+	SimFrameProfileActionExecutor() : IUnsyncedActionExecutor(
+		"SimFrameProfile",
+		"Print per-phase sim-frame timing percentiles, restart recording over the given number of frames (0 stops), or dump them to a .json or .csv file"
+	) {
+	}
+
+	bool Execute(const UnsyncedAction& action) const final {
+		const std::vector<std::string> args = CSimpleParser::Tokenize(action.GetArgs());
+		CFramePhaseRecorder& recorder = CFramePhaseRecorder::GetInstance();
+
+		switch (args.size()) {
+			case 0: {
+				recorder.PrintSummary();
+			} break;
+			case 1: {
+				recorder.Init(std::max(StringToInt(args[0]), 0));
+			} break;
+			case 2: {
+				if (args[0] != "dump")
+					return false;
+
+				recorder.Export(dataDirsAccess.LocateFile(args[1], FileQueryFlags::WRITE));
+			} break;
+			default: {
+				return false;
+			} break;
+		}
+
+		return true;
+	}
+};
+
+
+
 class RedirectToSyncedActionExecutor : public IUnsyncedActionExecutor {
 public:
 	RedirectToSyncedActionExecutor(const std::string& command): IUnsyncedActionExecutor(
@@ -4204,6 +4264,7 @@ void UnsyncedGameCommands::AddDefaultActionExecutors()
 	AddActionExecutor(AllocActionExecutor<RemoveActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<SendActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<DumpStateActionExecutor>());
+	AddActionExecutor(AllocActionExecutor<DumpStateBinaryActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<DumpRNGActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<SaveActionExecutor>(true));
 	AddActionExecutor(AllocActionExecutor<SaveActionExecutor>(false));
@@ -4211,6 +4272,7 @@ void UnsyncedGameCommands::AddDefaultActionExecutors()
 	AddActionExecutor(AllocActionExecutor<ReloadTexturesActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<DumpAtlasActionExecutor>());
 	AddActionExecutor(AllocActionExecutor<DebugInfoActionExecutor>());
+	AddActionExecutor(AllocActionExecutor<SimFrameProfileActionExecutor>());
 
 	// XXX are these redirects really required?
 	AddActionExecutor(AllocActionExecutor<RedirectToSyncedActionExecutor>("ATM"));
@@ -666,6 +666,69 @@ bool CSyncedLuaHandle::AllowCommand(const CUnit* unit, const Command& cmd, int p
 }
 
 
+/*** Called once when a command is given to a group of units, before any of their queues are altered.
+ *
+ * @function SyncedCallins:AllowUnitsCommand
+ *
+ * Used for orders given to several units at once (by players or through
+ * `Spring.GiveOrderToUnitArray` in unsynced code). Units that pass are still
+ * offered to `AllowCommand` individually, so validation that does not depend
+ * on the single unit can be moved here to avoid one call per unit.
+ *
+ * @param unitIDs integer[]
+ * @param cmdID integer
+ * @param cmdParams number[]
+ * @param cmdOptions CommandOptions
+ * @param playerID integer
+ * @param synced boolean
+ * @param fromLua boolean
+ * @return boolean|boolean[] allowed `false` blocks the command for every unit, a table of booleans parallel to `unitIDs` blocks it for those set to `false`.
+ */
+void CSyncedLuaHandle::AllowUnitsCommand(const std::vector<CUnit*>& units, const Command& cmd, int playerNum, bool fromSynced, bool fromLua, std::vector<uint8_t>& allowed)
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	LUA_CALL_IN_CHECK(L);
+	luaL_checkstack(L, 7 + 3, __func__);
+
+	static const LuaHashString cmdStr(__func__);
+	if (!cmdStr.GetGlobalFunc(L))
+		return; // the call is not defined
+
+	lua_createtable(L, units.size(), 0);
+
+	for (size_t i = 0; i < units.size(); i++) {
+		lua_pushnumber(L, units[i]->id);
+		lua_rawseti(L, -2, i + 1);
+	}
+
+	lua_pushnumber(L, cmd.GetID());
+
+	LuaUtils::PushCommandParamsTable(L, cmd, false);
+	LuaUtils::PushCommandOptionsTable(L, cmd, false);
+
+	lua_pushnumber(L, playerNum);
+	lua_pushboolean(L, fromSynced);
+	lua_pushboolean(L, fromLua);
+
+	// call the function
+	if (!RunCallIn(L, cmdStr, 7, 1))
+		return;
+
+	// get the results
+	if (lua_istable(L, -1)) {
+		for (size_t i = 0; i < units.size(); i++) {
+			lua_rawgeti(L, -1, i + 1);
+			allowed[i] &= luaL_optboolean(L, -1, true);
+			lua_pop(L, 1);
+		}
+	} else if (!luaL_optboolean(L, -1, true)) {
+		std::fill(allowed.begin(), allowed.end(), 0);
+	}
+
+	lua_pop(L, 1);
+}
+
+
 /*** Called just before unit is created.
  *
  * @function SyncedCallins:AllowUnitCreation
@@ -58,6 +58,7 @@ class CSyncedLuaHandle : public CLuaHandle
 	public: // call-ins
 		bool CommandFallback(const CUnit* unit, const Command& cmd) override;
 		bool AllowCommand(const CUnit* unit, const Command& cmd, int playerNum, bool fromSynced, bool fromLua) override;
+		void AllowUnitsCommand(const std::vector<CUnit*>& units, const Command& cmd, int playerNum, bool fromSynced, bool fromLua, std::vector<uint8_t>& allowed) override;
 
 		std::pair <bool, bool> AllowUnitCreation(const UnitDef* unitDef, const CUnit* builder, const BuildInfo* buildInfo) override;
 		bool AllowUnitTransfer(const CUnit* unit, int newTeam, bool capture) override;
@@ -7073,6 +7073,7 @@ int LuaSyncedCtrl::SetMapSquareTerrainType(lua_State* L)
 
 	readMap->GetTypeMapSynced()[tz * mapDims.hmapx + tx] = std::max(0, std::min(ntt, (CMapInfo::NUM_TERRAIN_TYPES - 1)));
 	pathManager->TerrainChange(hx, hz,  hx + 1, hz + 1,  TERRAINCHANGE_SQUARE_TYPEMAP_INDEX);
+	mapDamage->TerrainTypeMapChanged(tx, tz);
 
 	lua_pushnumber(L, ott);
 	return 1;
@@ -80,6 +80,8 @@
 #include "System/StringUtil.h"
 
 #include <cctype>
+#include <cstddef>
+#include <cstring>
 #include <type_traits>
 
 
@@ -162,6 +164,7 @@ bool LuaSyncedRead::PushEntries(lua_State* L)
 	REGISTER_LUA_CFUNC(GetTeamRulesParam);
 	REGISTER_LUA_CFUNC(GetTeamRulesParams);
 	REGISTER_LUA_CFUNC(GetTeamStatsHistory);
+	REGISTER_LUA_CFUNC(GetTeamStatsHistoryValues);
 	REGISTER_LUA_CFUNC(GetTeamLuaAI);
 	REGISTER_LUA_CFUNC(GetTeamMaxUnits);
 
@@ -2047,7 +2050,6 @@ int LuaSyncedRead::GetTeamStatsHistory(lua_State* L)
 	}
 
 	const auto& teamStats = team->statHistory;
-	auto it = teamStats.cbegin();
 	const int statCount = teamStats.size();
 
 	int start = 0;
@@ -2062,51 +2064,164 @@ int LuaSyncedRead::GetTeamStatsHistory(lua_State* L)
 		end = max(0, min(statCount - 1, end));
 	}
 
-	std::advance(it, start);
-
 	lua_createtable(L, max(0, end - start), 0);
-	if (statCount > 0) {
-		int count = 1;
-		for (int i = start; i <= end; ++i, ++it) {
-			const TeamStatistics& stats = *it;
-			lua_createtable(L, 0, 21); {
-				if (i+1 == teamStats.size()) {
-					// the `stats.frame` var indicates the frame when a new entry needs to get added,
-					// for the most recent stats entry this lies obviously in the future,
-					// so we just output the current frame here
-					HSTR_PUSH_NUMBER(L, "time",         gs->GetLuaSimFrame() / GAME_SPEED);
-					HSTR_PUSH_NUMBER(L, "frame",        gs->GetLuaSimFrame());
-				} else {
-					HSTR_PUSH_NUMBER(L, "time",         stats.frame / GAME_SPEED);
-					HSTR_PUSH_NUMBER(L, "frame",        stats.frame);
-				}
 
-				HSTR_PUSH_NUMBER(L, "metalUsed",        stats.metalUsed);
-				HSTR_PUSH_NUMBER(L, "metalProduced",    stats.metalProduced);
-				HSTR_PUSH_NUMBER(L, "metalExcess",      stats.metalExcess);
-				HSTR_PUSH_NUMBER(L, "metalReceived",    stats.metalReceived);
-				HSTR_PUSH_NUMBER(L, "metalSent",        stats.metalSent);
-
-				HSTR_PUSH_NUMBER(L, "energyUsed",       stats.energyUsed);
-				HSTR_PUSH_NUMBER(L, "energyProduced",   stats.energyProduced);
-				HSTR_PUSH_NUMBER(L, "energyExcess",     stats.energyExcess);
-				HSTR_PUSH_NUMBER(L, "energyReceived",   stats.energyReceived);
-				HSTR_PUSH_NUMBER(L, "energySent",       stats.energySent);
-
-				HSTR_PUSH_NUMBER(L, "damageDealt",      stats.damageDealt);
-				HSTR_PUSH_NUMBER(L, "damageReceived",   stats.damageReceived);
-
-				HSTR_PUSH_NUMBER(L, "unitsProduced",    stats.unitsProduced);
-				HSTR_PUSH_NUMBER(L, "unitsDied",        stats.unitsDied);
-				HSTR_PUSH_NUMBER(L, "unitsReceived",    stats.unitsReceived);
-				HSTR_PUSH_NUMBER(L, "unitsSent",        stats.unitsSent);
-				HSTR_PUSH_NUMBER(L, "unitsCaptured",    stats.unitsCaptured);
-				HSTR_PUSH_NUMBER(L, "unitsOutCaptured", stats.unitsOutCaptured);
-				HSTR_PUSH_NUMBER(L, "unitsKilled",      stats.unitsKilled);
+	int count = 1;
+
+	teamStats.ForEach(start, end + 1, [&](size_t i, const TeamStatistics& stats) {
+		lua_createtable(L, 0, 21); {
+			if (i+1 == teamStats.size()) {
+				// the `stats.frame` var indicates the frame when a new entry needs to get added,
+				// for the most recent stats entry this lies obviously in the future,
+				// so we just output the current frame here
+				HSTR_PUSH_NUMBER(L, "time",         gs->GetLuaSimFrame() / GAME_SPEED);
+				HSTR_PUSH_NUMBER(L, "frame",        gs->GetLuaSimFrame());
+			} else {
+				HSTR_PUSH_NUMBER(L, "time",         stats.frame / GAME_SPEED);
+				HSTR_PUSH_NUMBER(L, "frame",        stats.frame);
 			}
-			lua_rawseti(L, -2, count++);
+
+			HSTR_PUSH_NUMBER(L, "metalUsed",        stats.metalUsed);
+			HSTR_PUSH_NUMBER(L, "metalProduced",    stats.metalProduced);
+			HSTR_PUSH_NUMBER(L, "metalExcess",      stats.metalExcess);
+			HSTR_PUSH_NUMBER(L, "metalReceived",    stats.metalReceived);
+			HSTR_PUSH_NUMBER(L, "metalSent",        stats.metalSent);
+
+			HSTR_PUSH_NUMBER(L, "energyUsed",       stats.energyUsed);
+			HSTR_PUSH_NUMBER(L, "energyProduced",   stats.energyProduced);
+			HSTR_PUSH_NUMBER(L, "energyExcess",     stats.energyExcess);
+			HSTR_PUSH_NUMBER(L, "energyReceived",   stats.energyReceived);
+			HSTR_PUSH_NUMBER(L, "energySent",       stats.energySent);
+
+			HSTR_PUSH_NUMBER(L, "damageDealt",      stats.damageDealt);
+			HSTR_PUSH_NUMBER(L, "damageReceived",   stats.damageReceived);
+
+			HSTR_PUSH_NUMBER(L, "unitsProduced",    stats.unitsProduced);
+			HSTR_PUSH_NUMBER(L, "unitsDied",        stats.unitsDied);
+			HSTR_PUSH_NUMBER(L, "unitsReceived",    stats.unitsReceived);
+			HSTR_PUSH_NUMBER(L, "unitsSent",        stats.unitsSent);
+			HSTR_PUSH_NUMBER(L, "unitsCaptured",    stats.unitsCaptured);
+			HSTR_PUSH_NUMBER(L, "unitsOutCaptured", stats.unitsOutCaptured);
+			HSTR_PUSH_NUMBER(L, "unitsKilled",      stats.unitsKilled);
 		}
-	}
+		lua_rawseti(L, -2, count++);
+	});
+
+	return 1;
+}
+
+
+/***
+ * Get a single stat over a range of the team stats history.
+ *
+ * Cheaper than `Spring.GetTeamStatsHistory` when only one value per entry is
+ * needed, e.g. for graphs, since no table is created for each entry.
+ *
+ * @function Spring.GetTeamStatsHistoryValues
+ * @param teamID integer
+ * @param statName string Any `TeamStats` field name.
+ * @param startIndex integer
+ * @param endIndex integer? (Default: startIndex)
+ * @return number[]? values The stat values, or `nil` if unable to resolve team or stat.
+ */
+int LuaSyncedRead::GetTeamStatsHistoryValues(lua_State* L)
+{
+	const CTeam* team = ParseTeam(L, __func__, 1);
+
+	if (team == nullptr || game == nullptr)
+		return 0;
+
+	const int teamID = team->teamNum;
+
+	if (!LuaUtils::IsAlliedTeam(L, teamID) && !game->IsGameOver())
+		return 0;
+
+	enum StatType {
+		STAT_FRAME,
+		STAT_TIME,
+		STAT_INT,
+		STAT_FLOAT,
+	};
+
+	struct StatField {
+		const char* name;
+		size_t offset;
+		StatType type;
+	};
+
+	static constexpr StatField statFields[] = {
+		{"frame",            offsetof(TeamStatistics, frame           ), STAT_FRAME},
+		{"time",             offsetof(TeamStatistics, frame           ), STAT_TIME },
+		{"metalUsed",        offsetof(TeamStatistics, metalUsed       ), STAT_FLOAT},
+		{"metalProduced",    offsetof(TeamStatistics, metalProduced   ), STAT_FLOAT},
+		{"metalExcess",      offsetof(TeamStatistics, metalExcess     ), STAT_FLOAT},
+		{"metalReceived",    offsetof(TeamStatistics, metalReceived   ), STAT_FLOAT},
+		{"metalSent",        offsetof(TeamStatistics, metalSent       ), STAT_FLOAT},
+		{"energyUsed",       offsetof(TeamStatistics, energyUsed      ), STAT_FLOAT},
+		{"energyProduced",   offsetof(TeamStatistics, energyProduced  ), STAT_FLOAT},
+		{"energyExcess",     offsetof(TeamStatistics, energyExcess    ), STAT_FLOAT},
+		{"energyReceived",   offsetof(TeamStatistics, energyReceived  ), STAT_FLOAT},
+		{"energySent",       offsetof(TeamStatistics, energySent      ), STAT_FLOAT},
+		{"damageDealt",      offsetof(TeamStatistics, damageDealt     ), STAT_FLOAT},
+		{"damageReceived",   offsetof(TeamStatistics, damageReceived  ), STAT_FLOAT},
+		{"unitsProduced",    offsetof(TeamStatistics, unitsProduced   ), STAT_INT  },
+		{"unitsDied",        offsetof(TeamStatistics, unitsDied       ), STAT_INT  },
+		{"unitsReceived",    offsetof(TeamStatistics, unitsReceived   ), STAT_INT  },
+		{"unitsSent",        offsetof(TeamStatistics, unitsSent       ), STAT_INT  },
+		{"unitsCaptured",    offsetof(TeamStatistics, unitsCaptured   ), STAT_INT  },
+		{"unitsOutCaptured", offsetof(TeamStatistics, unitsOutCaptured), STAT_INT  },
+		{"unitsKilled",      offsetof(TeamStatistics, unitsKilled     ), STAT_INT  },
+	};
+
+	const char* statName = luaL_checkstring(L, 2);
+	const auto fieldIt = std::find_if(std::begin(statFields), std::end(statFields), [&](const StatField& f) { return (std::strcmp(f.name, statName) == 0); });
+
+	if (fieldIt == std::end(statFields))
+		return 0;
+
+	const StatField& field = *fieldIt;
+
+	const auto& teamStats = team->statHistory;
+	const int statCount = teamStats.size();
+
+	const int start = std::clamp(luaL_checkint(L, 3) - 1, 0, statCount - 1);
+	const int end = std::clamp(luaL_optint(L, 4, start + 1) - 1, 0, statCount - 1);
+
+	lua_createtable(L, max(0, end - start + 1), 0);
+
+	int count = 1;
+
+	teamStats.ForEach(start, end + 1, [&](size_t i, const TeamStatistics& stats) {
+		const char* fieldPtr = reinterpret_cast<const char*>(&stats) + field.offset;
+
+		int intValue = 0;
+		float floatValue = 0.0f;
+
+		switch (field.type) {
+			case STAT_FRAME:
+			case STAT_TIME: {
+				std::memcpy(&intValue, fieldPtr, sizeof(intValue));
+
+				// see GetTeamStatsHistory, the latest entry's frame lies in the future
+				if ((i + 1) == teamStats.size())
+					intValue = gs->GetLuaSimFrame();
+				if (field.type == STAT_TIME)
+					intValue /= GAME_SPEED;
+
+				lua_pushnumber(L, intValue);
+			} break;
+			case STAT_INT: {
+				std::memcpy(&intValue, fieldPtr, sizeof(intValue));
+				lua_pushnumber(L, intValue);
+			} break;
+			case STAT_FLOAT: {
+				std::memcpy(&floatValue, fieldPtr, sizeof(floatValue));
+				lua_pushnumber(L, floatValue);
+			} break;
+		}
+
+		lua_rawseti(L, -2, count++);
+	});
 
 	return 1;
 }
@@ -73,6 +73,7 @@ class LuaSyncedRead {
 		static int GetTeamRulesParam(lua_State* L);
 		static int GetTeamRulesParams(lua_State* L);
 		static int GetTeamStatsHistory(lua_State* L);
+		static int GetTeamStatsHistoryValues(lua_State* L);
 		static int GetTeamMaxUnits(lua_State* L);
 
 		static int GetAllUnits(lua_State* L);
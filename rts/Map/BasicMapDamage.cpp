@@ -32,10 +32,6 @@ void CBasicMapDamage::Init()
 		craterTable[a] = c1 * (1.0f - r) * (0.5f + 0.5f * c2);
 	}
 
-	for (int a = 0; a < CMapInfo::NUM_TERRAIN_TYPES; ++a) {
-		TerrainTypeHardnessChanged(a);
-	}
-
 	// 3x3 smoothing kernel
 	weightTable[0] = 1.0f / 16.0f;
 	weightTable[1] = 2.0f / 16.0f;
@@ -47,6 +43,22 @@ void CBasicMapDamage::Init()
 	weightTable[7] = 2.0f / 16.0f;
 	weightTable[8] = 1.0f / 16.0f;
 
+	// keep the hardness map empty until all types are known, otherwise
+	// each TerrainTypeHardnessChanged call would rebuild it from scratch
+	smoothedInvHardness.clear();
+
+	for (int a = 0; a < CMapInfo::NUM_TERRAIN_TYPES; ++a) {
+		TerrainTypeHardnessChanged(a);
+	}
+
+	smoothedInvHardness.resize(mapDims.hmapx * mapDims.hmapy, 0.0f);
+	UpdateHardnessMap(0, 0, mapDims.hmapx - 1, mapDims.hmapy - 1);
+
+	// allocated on first use
+	heightDeltas.clear();
+	deltaRects.clear();
+	recalcRects.clear();
+	movedBuildings.clear();
 
 	explSquaresPoolIdx = 0;
 	explUpdateQueueIdx = 0;
@@ -66,6 +78,58 @@ void CBasicMapDamage::TerrainTypeHardnessChanged(int ttIndex)
 	// table should contain only positive or only negative values, never both
 	rawHardness[ttIndex] = mapHardness * std::max(0.001f, mapInfo->terrainTypes[ttIndex].hardness);
 	invHardness[ttIndex] = 1.0f / rawHardness[ttIndex];
+
+	if (smoothedInvHardness.empty())
+		return;
+
+	// any number of squares can use this type, rebuild everything
+	UpdateHardnessMap(0, 0, mapDims.hmapx - 1, mapDims.hmapy - 1);
+}
+
+void CBasicMapDamage::TerrainTypeMapChanged(int tx, int tz)
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	// every square whose 3x3 neighborhood includes (tx, tz)
+	UpdateHardnessMap(
+		std::max(tx - 1, 0), std::max(tz - 1, 0),
+		std::min(tx + 1, mapDims.hmapx - 1), std::min(tz + 1, mapDims.hmapy - 1)
+	);
+}
+
+void CBasicMapDamage::TerrainTypeMapReloaded()
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	if (smoothedInvHardness.empty())
+		return;
+
+	UpdateHardnessMap(0, 0, mapDims.hmapx - 1, mapDims.hmapy - 1);
+}
+
+void CBasicMapDamage::UpdateHardnessMap(int tx1, int tz1, int tx2, int tz2)
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	const unsigned char* typeMap = readMap->GetTypeMapSynced();
+
+	for (int tz = tz1; tz <= tz2; tz++) {
+		for (int tx = tx1; tx <= tx2; tx++) {
+			// prevent formation of spikes from isolated "soft spots"
+			// (one or two random squares with extremely low hardness
+			// surrounded by high-strength terrain)
+			float sumRawHardness = 0.0f;
+
+			for (int j = -1; j <= 1; j++) {
+				for (int i = -1; i <= 1; i++) {
+					const int tmz = std::clamp(tz + j, 0, mapDims.hmapy - 1);
+					const int tmx = std::clamp(tx + i, 0, mapDims.hmapx - 1);
+					const int tti = typeMap[tmz * mapDims.hmapx + tmx];
+
+					sumRawHardness += (rawHardness[tti] * weightTable[(j + 1) * 3 + (i + 1)]);
+				}
+			}
+
+			smoothedInvHardness[tz * mapDims.hmapx + tx] = 1.0f / sumRawHardness;
+		}
+	}
 }
 
 void CBasicMapDamage::TerrainTypeSpeedModChanged(int ttIndex)
@@ -118,6 +182,8 @@ void CBasicMapDamage::Explosion(const float3& pos, float strength, float radius,
 
 	// figure out how much height to add to each square
 	for (int y = e.y1; y <= e.y2; ++y) {
+		const float* invHardnessRow = &smoothedInvHardness[(y >> 1) * mapDims.hmapx];
+
 		for (int x = e.x1; x <= e.x2; ++x) {
 			const CSolidObject* so = groundBlockingObjectMap.GroundBlockedUnsafe(y * mapDims.mapx + x);
 
@@ -132,35 +198,13 @@ void CBasicMapDamage::Explosion(const float3& pos, float strength, float radius,
 			const float relDist = std::min(1.0f, expDist * invRadius);
 
 			const unsigned int tableIdx = relDist * CRATER_TABLE_SIZE;
-			// const unsigned int ttypeIdx = typeMap[(y >> 1) * mapDims.hmapx + (x >> 1)];
-
-
-			// prevent formation of spikes from isolated "soft spots"
-			// (one or two random squares with extremely low hardness
-			// surrounded by high-strength terrain)
-			float sumRawHardness = 0.0f;
-			float avgInvHardness = 0.0f;
-
-			for (int j = -1; j <= 1; j++) {
-				for (int i = -1; i <= 1; i++) {
-					const int tmz = std::clamp((y >> 1) + j, 0, mapDims.hmapy - 1);
-					const int tmx = std::clamp((x >> 1) + i, 0, mapDims.hmapx - 1);
-					const int tti = typeMap[tmz * mapDims.hmapx + tmx];
-
-					sumRawHardness += (rawHardness[tti] * weightTable[(j + 1) * 3 + (i + 1)]);
-				}
-			}
-
-			avgInvHardness = 1.0f / sumRawHardness;
-
 
 			// FIXME: compensate for flattened ground under dead buildings
 			const float prevDif = curHeightMap[y * mapDims.mapxp1 + x] - orgHeightMap[y * mapDims.mapxp1 + x];
 			      float explDif = baseStrength;
 
 			explDif *= craterTable[tableIdx];
-			explDif *= avgInvHardness;
-			// explDif *= invHardness[ttypeIdx];
+			explDif *= invHardnessRow[x >> 1];
 
 			if ((prevDif * explDif) > 0.0f)
 				explDif /= ((math::fabs(prevDif) / EXPLOSION_LIFETIME) + 1);
@@ -257,6 +301,14 @@ void CBasicMapDamage::Update()
 {
 	SCOPED_TIMER("Sim::BasicMapDamage");
 
+	if (explUpdateQueueIdx >= explosionUpdateQueue.size())
+		return;
+
+	if (heightDeltas.empty())
+		heightDeltas.resize(mapDims.mapxp1 * mapDims.mapyp1, 0.0f);
+
+	// accumulate this frame's height changes of every active explosion
+	// (in queue order) so overlapping craters touch each square only once
 	for (unsigned int i = explUpdateQueueIdx, n = explosionUpdateQueue.size(); i < n; i++) {
 		Explo& e = explosionUpdateQueue[i];
 
@@ -268,10 +320,12 @@ void CBasicMapDamage::Update()
 
 		for (int y = e.y1; y <= e.y2; ++y) {
 			for (int x = e.x1; x <= e.x2; ++x) {
-				readMap->AddHeight(y * mapDims.mapxp1 + x, explosionSquaresPool[ (expSquarePoolIdx++) % explosionSquaresPool.size() ]);
+				heightDeltas[y * mapDims.mapxp1 + x] += explosionSquaresPool[ (expSquarePoolIdx++) % explosionSquaresPool.size() ];
 			}
 		}
 
+		deltaRects.emplace_back(e.x1, e.y1, e.x2, e.y2);
+
 
 		for (const ExploBuilding& b: e.buildings) {
 			CUnit* unit = unitHandler.GetUnit(b.id);
@@ -282,19 +336,50 @@ void CBasicMapDamage::Update()
 			// only change ground level if building is still here
 			for (int z = b.tz1; z < b.tz2; z++) {
 				for (int x = b.tx1; x < b.tx2; x++) {
-					readMap->AddHeight(z * mapDims.mapxp1 + x, b.dif);
+					heightDeltas[z * mapDims.mapxp1 + x] += b.dif;
 				}
 			}
 
-			unit->Move(UpVector * b.dif, true);
+			deltaRects.emplace_back(b.tx1, b.tz1, b.tx2 - 1, b.tz2 - 1);
+			movedBuildings.emplace_back(unit, b.dif);
 		}
 
 		if (e.ttl != 0)
 			continue;
 
-		RecalcArea(e.x1 - 1, e.x2 + 1, e.y1 - 1, e.y2 + 1);
+		recalcRects.emplace_back(e.x1 - 1, e.y1 - 1, e.x2 + 1, e.y2 + 1);
 	}
 
+	// apply the merged field; squares covered by more than one rectangle
+	// are zeroed after the first so they are not added to twice
+	for (const SRectangle& r: deltaRects) {
+		for (int y = r.y1; y <= r.y2; ++y) {
+			for (int x = r.x1; x <= r.x2; ++x) {
+				float& delta = heightDeltas[y * mapDims.mapxp1 + x];
+
+				readMap->AddHeight(y * mapDims.mapxp1 + x, delta);
+				delta = 0.0f;
+			}
+		}
+	}
+
+	for (const auto& [unit, dif]: movedBuildings) {
+		unit->Move(UpVector * dif, true);
+	}
+
+	deltaRects.clear();
+	movedBuildings.clear();
+
+	// one recalculation per region of overlapping finished craters rather
+	// than one per explosion; LOS and path updates dominate the cost here
+	MergeRecalcRects();
+
+	for (const SRectangle& r: recalcRects) {
+		RecalcArea(r.x1, r.x2, r.y1, r.y2);
+	}
+
+	recalcRects.clear();
+
 
 	// pop explosions that are no longer being processed
 	while (explUpdateQueueIdx < explosionUpdateQueue.size()) {
@@ -309,3 +394,40 @@ void CBasicMapDamage::Update()
 	explUpdateQueueIdx = 0;
 }
 
+void CBasicMapDamage::MergeRecalcRects()
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	// merge two rectangles whenever they overlap (or touch) and their
+	// bounding box is not larger than the two areas combined, i.e. when
+	// recalculating the union is never more work than doing both
+	for (bool merged = true; merged; ) {
+		merged = false;
+
+		for (size_t i = 0; i < recalcRects.size(); i++) {
+			for (size_t j = i + 1; j < recalcRects.size(); /*no-op*/) {
+				const SRectangle& a = recalcRects[i];
+				const SRectangle& b = recalcRects[j];
+
+				const bool touching =
+					a.x1 <= b.x2 && b.x1 <= a.x2 &&
+					a.y1 <= b.y2 && b.y1 <= a.y2;
+
+				const SRectangle u = {
+					std::min(a.x1, b.x1), std::min(a.y1, b.y1),
+					std::max(a.x2, b.x2), std::max(a.y2, b.y2)
+				};
+
+				if (!touching || u.GetArea() > (a.GetArea() + b.GetArea())) {
+					j++;
+					continue;
+				}
+
+				recalcRects[i] = u;
+				recalcRects[j] = recalcRects.back();
+				recalcRects.pop_back();
+
+				merged = true;
+			}
+		}
+	}
+}
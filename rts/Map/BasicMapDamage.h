@@ -4,9 +4,13 @@
 #define _BASIC_MAP_DAMAGE_H
 
 #include "MapDamage.h"
+#include "System/Rectangle.h"
 
+#include <utility>
 #include <vector>
 
+class CUnit;
+
 class CBasicMapDamage : public IMapDamage
 {
 public:
@@ -14,6 +18,8 @@ public:
 	void RecalcArea(int x1, int x2, int y1, int y2) override;
 	void TerrainTypeHardnessChanged(int ttIndex) override;
 	void TerrainTypeSpeedModChanged(int ttIndex) override;
+	void TerrainTypeMapChanged(int tx, int tz) override;
+	void TerrainTypeMapReloaded() override;
 
 	void Init() override;
 	void Update() override;
@@ -21,6 +27,10 @@ public:
 	bool Disabled() const override { return false; }
 
 private:
+	/// recomputes smoothedInvHardness for typemap squares [tx1, tx2] x [tz1, tz2]
+	void UpdateHardnessMap(int tx1, int tz1, int tx2, int tz2);
+	void MergeRecalcRects();
+
 	void SetExplosionSquare(float v) {
 		explosionSquaresPool[explSquaresPoolIdx] = v;
 
@@ -61,6 +71,22 @@ private:
 	std::vector<float> explosionSquaresPool;
 	std::vector<Explo> explosionUpdateQueue;
 
+	/**
+	 * 1 / (3x3-weighted rawHardness) per typemap square; used instead of
+	 * convolving the typemap for every square an explosion touches
+	 */
+	std::vector<float> smoothedInvHardness;
+
+	/**
+	 * Per-frame sum of the height changes of all active explosions (by
+	 * corner heightmap square), applied in one pass by Update. Only the
+	 * squares inside deltaRects are ever non-zero.
+	 */
+	std::vector<float> heightDeltas;
+	std::vector<SRectangle> deltaRects;
+	std::vector<SRectangle> recalcRects;
+	std::vector<std::pair<CUnit*, float>> movedBuildings;
+
 	static constexpr unsigned int CRATER_TABLE_SIZE = 200;
 	static constexpr unsigned int EXPLOSION_LIFETIME = 10;
 
@@ -0,0 +1,380 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef HEIGHTMAP_KERNELS_H
+#define HEIGHTMAP_KERNELS_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include "xsimd/xsimd.hpp"
+#include "Sim/Misc/GlobalConstants.h"
+#include "System/FastMath.h"
+#include "System/SpringMath.h"
+#include "System/float3.h"
+
+// FMA contraction would fuse the SIMD lanes and the scalar tail differently
+// (or not at all), so it is turned off for the kernels regardless of MARCH
+#if defined(__clang__)
+	#pragma float_control(push)
+	#pragma clang fp contract(off)
+#elif defined(__GNUC__)
+	#pragma GCC push_options
+	#pragma GCC optimize("fp-contract=off")
+#endif
+
+/**
+ * Per-row kernels deriving the synced center-, max- and mip-heightmaps, the
+ * face and center normals and the slopemap from the corner heightmap, see
+ * CReadMap::UpdateHeightMapSynced. Column ranges are inclusive for all but
+ * the mip kernel, like the loops they were taken from.
+ *
+ * Each kernel has a scalar reference and an xsimd variant. The latter does
+ * exactly the same IEEE operations in the same order per element (no FMA,
+ * no reassociation, no approximate reciprocals; std::min/max tie-breaking
+ * and isqrt2_nosse are replicated) so results are bit-identical and safe
+ * to use in synced code. Gathers that do not map onto contiguous loads
+ * (mips, slopes, AoS normals) go through small stack buffers.
+ */
+namespace HeightMapKernels {
+	inline void CenterHeightRow(const float* cornerHM, float* centerHM, float* maxHM, int mapx, int y, int x1, int x2)
+	{
+		const int mapxp1 = mapx + 1;
+
+		for (int x = x1; x <= x2; x++) {
+			const int idxTL = (y + 0) * mapxp1 + x + 0;
+			const int idxTR = (y + 0) * mapxp1 + x + 1;
+			const int idxBL = (y + 1) * mapxp1 + x + 0;
+			const int idxBR = (y + 1) * mapxp1 + x + 1;
+
+			const int index = y * mapx + x;
+			const float height =
+				cornerHM[idxTL] +
+				cornerHM[idxTR] +
+				cornerHM[idxBL] +
+				cornerHM[idxBR];
+			centerHM[index] = height * 0.25f;
+			maxHM[index] = std::max
+					( std::max(cornerHM[idxTL], cornerHM[idxTR])
+					, std::max(cornerHM[idxBL], cornerHM[idxBR])
+					);
+		}
+	}
+
+	/// topMipX is the width of topMip; processes columns x in [sx, ex) with step 2, y must be even
+	inline void MipHeightRow(const float* topMip, float* subMip, int topMipX, int y, int sx, int ex)
+	{
+		for (int x = sx; x < ex; x += 2) {
+			const float height =
+				topMip[(x    ) + (y    ) * topMipX] +
+				topMip[(x    ) + (y + 1) * topMipX] +
+				topMip[(x + 1) + (y    ) * topMipX] +
+				topMip[(x + 1) + (y + 1) * topMipX];
+			subMip[(x / 2) + (y / 2) * topMipX / 2] = height * 0.25f;
+		}
+	}
+
+	inline void FaceNormalRow(const float* cornerHM, float3* faceNormals, float3* centerNormals, float3* centerNormals2D, int mapx, int y, int x1, int x2)
+	{
+		const int mapxp1 = mapx + 1;
+
+		float3 fnTL;
+		float3 fnBR;
+
+		for (int x = x1; x <= x2; x++) {
+			const int idxTL = (y    ) * mapxp1 + x; // TL
+			const int idxBL = (y + 1) * mapxp1 + x; // BL
+
+			const float& hTL = cornerHM[idxTL    ];
+			const float& hTR = cornerHM[idxTL + 1];
+			const float& hBL = cornerHM[idxBL    ];
+			const float& hBR = cornerHM[idxBL + 1];
+
+			// normal of top-left triangle (face) in square
+			//
+			//  *---> e1
+			//  |
+			//  |
+			//  v
+			//  e2
+			//const float3 e1( SQUARE_SIZE, hTR - hTL,           0);
+			//const float3 e2(           0, hBL - hTL, SQUARE_SIZE);
+			//const float3 fnTL = (e2.cross(e1)).Normalize();
+			// negated by multiplication, like FaceNormalRowSIMD has to
+			fnTL.y = SQUARE_SIZE;
+			fnTL.x = (hTR - hTL) * -1.0f;
+			fnTL.z = (hBL - hTL) * -1.0f;
+			fnTL.Normalize();
+
+			// normal of bottom-right triangle (face) in square
+			//
+			//         e3
+			//         ^
+			//         |
+			//         |
+			//  e4 <---*
+			//const float3 e3(-SQUARE_SIZE, hBL - hBR,           0);
+			//const float3 e4(           0, hTR - hBR,-SQUARE_SIZE);
+			//const float3 fnBR = (e4.cross(e3)).Normalize();
+			fnBR.y = SQUARE_SIZE;
+			fnBR.x = (hBL - hBR);
+			fnBR.z = (hTR - hBR);
+			fnBR.Normalize();
+
+			faceNormals[(y * mapx + x) * 2    ] = fnTL;
+			faceNormals[(y * mapx + x) * 2 + 1] = fnBR;
+			// square-normal
+			centerNormals[y * mapx + x] = (fnTL + fnBR).Normalize();
+			centerNormals2D[y * mapx + x] = (fnTL + fnBR).Normalize2D();
+		}
+	}
+
+	/// hmapx is the width of slopeMap, i.e. mapx / 2
+	inline void SlopeRow(const float3* faceNormals, float* slopeMap, int mapx, int hmapx, int y, int sx, int ex)
+	{
+		for (int x = sx; x <= ex; x++) {
+			const int idx0 = (y*2    ) * (mapx) + x*2;
+			const int idx1 = (y*2 + 1) * (mapx) + x*2;
+
+			float avgslope = 0.0f;
+			avgslope += faceNormals[(idx0    ) * 2    ].y;
+			avgslope += faceNormals[(idx0    ) * 2 + 1].y;
+			avgslope += faceNormals[(idx0 + 1) * 2    ].y;
+			avgslope += faceNormals[(idx0 + 1) * 2 + 1].y;
+			avgslope += faceNormals[(idx1    ) * 2    ].y;
+			avgslope += faceNormals[(idx1    ) * 2 + 1].y;
+			avgslope += faceNormals[(idx1 + 1) * 2    ].y;
+			avgslope += faceNormals[(idx1 + 1) * 2 + 1].y;
+			avgslope *= 0.125f;
+
+			float maxslope =              faceNormals[(idx0    ) * 2    ].y;
+			maxslope = std::min(maxslope, faceNormals[(idx0    ) * 2 + 1].y);
+			maxslope = std::min(maxslope, faceNormals[(idx0 + 1) * 2    ].y);
+			maxslope = std::min(maxslope, faceNormals[(idx0 + 1) * 2 + 1].y);
+			maxslope = std::min(maxslope, faceNormals[(idx1    ) * 2    ].y);
+			maxslope = std::min(maxslope, faceNormals[(idx1    ) * 2 + 1].y);
+			maxslope = std::min(maxslope, faceNormals[(idx1 + 1) * 2    ].y);
+			maxslope = std::min(maxslope, faceNormals[(idx1 + 1) * 2 + 1].y);
+
+			// smooth it a bit, so small holes don't block huge tanks
+			const float lerp = maxslope / avgslope;
+			const float slope = mix(maxslope, avgslope, lerp);
+
+			slopeMap[y * hmapx + x] = 1.0f - slope;
+		}
+	}
+
+
+#ifdef XSIMD_BATCH_FLOAT_SIZE
+	static constexpr int BATCH_SIZE = XSIMD_BATCH_FLOAT_SIZE;
+
+	using FloatBatch = xsimd::batch<float, BATCH_SIZE>;
+	using Int32Batch = xsimd::batch<int32_t, BATCH_SIZE>;
+	using FloatLanes = std::array<float, BATCH_SIZE>;
+
+	// std::max and std::min semantics; the first argument wins ties (+0 vs -0)
+	inline FloatBatch MaxBatch(const FloatBatch& a, const FloatBatch& b) { return xsimd::select(a < b, b, a); }
+	inline FloatBatch MinBatch(const FloatBatch& a, const FloatBatch& b) { return xsimd::select(b < a, b, a); }
+
+	/// exact negation; xsimd's unary minus is 0 - x on some targets, which turns -0 into +0
+	inline FloatBatch NegBatch(const FloatBatch& x) { return (x * FloatBatch(-1.0f)); }
+
+	inline FloatBatch LoadBatch(const float* src) { return xsimd::load_unaligned(src); }
+	inline FloatBatch LoadBatch(const FloatLanes& src) { return xsimd::load_unaligned(src.data()); }
+
+	/// fastmath::isqrt2_nosse
+	inline FloatBatch ISqrt2Batch(FloatBatch x)
+	{
+		const FloatBatch xh = FloatBatch(0.5f) * x;
+
+		Int32Batch i = xsimd::bitwise_cast<Int32Batch>(x);
+		i = Int32Batch(0x5f375a86) - (i >> 1);
+		x = xsimd::bitwise_cast<FloatBatch>(i);
+		x = x * (FloatBatch(1.5f) - xh * (x * x));
+		x = x * (FloatBatch(1.5f) - xh * (x * x));
+		return x;
+	}
+
+	/// float3::SafeNormalize (which float3::Normalize resolves to) on SoA components
+	inline void NormalizeBatch(FloatBatch& x, FloatBatch& y, FloatBatch& z)
+	{
+		const FloatBatch sql = x * x + y * y + z * z;
+		const FloatBatch scl = ISqrt2Batch(sql);
+		const auto nrm = (sql > FloatBatch(float3::nrm_eps()));
+
+		x = xsimd::select(nrm, x * scl, x);
+		y = xsimd::select(nrm, y * scl, y);
+		z = xsimd::select(nrm, z * scl, z);
+	}
+
+
+	inline void CenterHeightRowSIMD(const float* cornerHM, float* centerHM, float* maxHM, int mapx, int y, int x1, int x2)
+	{
+		const int mapxp1 = mapx + 1;
+
+		int x = x1;
+
+		for (; (x + BATCH_SIZE - 1) <= x2; x += BATCH_SIZE) {
+			const FloatBatch hTL = LoadBatch(cornerHM + (y + 0) * mapxp1 + x + 0);
+			const FloatBatch hTR = LoadBatch(cornerHM + (y + 0) * mapxp1 + x + 1);
+			const FloatBatch hBL = LoadBatch(cornerHM + (y + 1) * mapxp1 + x + 0);
+			const FloatBatch hBR = LoadBatch(cornerHM + (y + 1) * mapxp1 + x + 1);
+
+			xsimd::store_unaligned(centerHM + y * mapx + x, (hTL + hTR + hBL + hBR) * FloatBatch(0.25f));
+			xsimd::store_unaligned(maxHM + y * mapx + x, MaxBatch(MaxBatch(hTL, hTR), MaxBatch(hBL, hBR)));
+		}
+
+		CenterHeightRow(cornerHM, centerHM, maxHM, mapx, y, x, x2);
+	}
+
+	inline void MipHeightRowSIMD(const float* topMip, float* subMip, int topMipX, int y, int sx, int ex)
+	{
+		const float* rowT = topMip + (y    ) * topMipX;
+		const float* rowB = topMip + (y + 1) * topMipX;
+
+		FloatLanes hTL;
+		FloatLanes hBL;
+		FloatLanes hTR;
+		FloatLanes hBR;
+		FloatLanes height;
+
+		int x = sx;
+
+		for (; (x + (BATCH_SIZE - 1) * 2) < ex; x += BATCH_SIZE * 2) {
+			for (int i = 0; i < BATCH_SIZE; i++) {
+				hTL[i] = rowT[x + i * 2    ];
+				hBL[i] = rowB[x + i * 2    ];
+				hTR[i] = rowT[x + i * 2 + 1];
+				hBR[i] = rowB[x + i * 2 + 1];
+			}
+
+			xsimd::store_unaligned(height.data(), (LoadBatch(hTL) + LoadBatch(hBL) + LoadBatch(hTR) + LoadBatch(hBR)) * FloatBatch(0.25f));
+
+			// subMip rows are not necessarily contiguous with x/2 for odd sx
+			for (int i = 0; i < BATCH_SIZE; i++) {
+				subMip[((x + i * 2) / 2) + (y / 2) * topMipX / 2] = height[i];
+			}
+		}
+
+		MipHeightRow(topMip, subMip, topMipX, y, x, ex);
+	}
+
+	inline void FaceNormalRowSIMD(const float* cornerHM, float3* faceNormals, float3* centerNormals, float3* centerNormals2D, int mapx, int y, int x1, int x2)
+	{
+		const int mapxp1 = mapx + 1;
+
+		std::array<FloatLanes, 3> tl;
+		std::array<FloatLanes, 3> br;
+		std::array<FloatLanes, 3> cn;
+		std::array<FloatLanes, 3> cn2D;
+
+		int x = x1;
+
+		for (; (x + BATCH_SIZE - 1) <= x2; x += BATCH_SIZE) {
+			const FloatBatch hTL = LoadBatch(cornerHM + (y    ) * mapxp1 + x    );
+			const FloatBatch hTR = LoadBatch(cornerHM + (y    ) * mapxp1 + x + 1);
+			const FloatBatch hBL = LoadBatch(cornerHM + (y + 1) * mapxp1 + x    );
+			const FloatBatch hBR = LoadBatch(cornerHM + (y + 1) * mapxp1 + x + 1);
+
+			FloatBatch tlx = NegBatch(hTR - hTL);
+			FloatBatch tly = FloatBatch(SQUARE_SIZE * 1.0f);
+			FloatBatch tlz = NegBatch(hBL - hTL);
+			NormalizeBatch(tlx, tly, tlz);
+
+			FloatBatch brx = (hBL - hBR);
+			FloatBatch bry = FloatBatch(SQUARE_SIZE * 1.0f);
+			FloatBatch brz = (hTR - hBR);
+			NormalizeBatch(brx, bry, brz);
+
+			FloatBatch cnx = tlx + brx;
+			FloatBatch cny = tly + bry;
+			FloatBatch cnz = tlz + brz;
+
+			// Normalize2D zeroes y first
+			FloatBatch c2x = cnx;
+			FloatBatch c2y = FloatBatch(0.0f);
+			FloatBatch c2z = cnz;
+
+			NormalizeBatch(cnx, cny, cnz);
+			NormalizeBatch(c2x, c2y, c2z);
+
+			xsimd::store_unaligned(tl[0].data(), tlx); xsimd::store_unaligned(tl[1].data(), tly); xsimd::store_unaligned(tl[2].data(), tlz);
+			xsimd::store_unaligned(br[0].data(), brx); xsimd::store_unaligned(br[1].data(), bry); xsimd::store_unaligned(br[2].data(), brz);
+			xsimd::store_unaligned(cn[0].data(), cnx); xsimd::store_unaligned(cn[1].data(), cny); xsimd::store_unaligned(cn[2].data(), cnz);
+			xsimd::store_unaligned(cn2D[0].data(), c2x); xsimd::store_unaligned(cn2D[1].data(), c2y); xsimd::store_unaligned(cn2D[2].data(), c2z);
+
+			for (int i = 0; i < BATCH_SIZE; i++) {
+				const int idx = y * mapx + x + i;
+
+				faceNormals[idx * 2    ] = {tl[0][i], tl[1][i], tl[2][i]};
+				faceNormals[idx * 2 + 1] = {br[0][i], br[1][i], br[2][i]};
+
+				centerNormals[idx] = {cn[0][i], cn[1][i], cn[2][i]};
+				centerNormals2D[idx] = {cn2D[0][i], cn2D[1][i], cn2D[2][i]};
+			}
+		}
+
+		FaceNormalRow(cornerHM, faceNormals, centerNormals, centerNormals2D, mapx, y, x, x2);
+	}
+
+	inline void SlopeRowSIMD(const float3* faceNormals, float* slopeMap, int mapx, int hmapx, int y, int sx, int ex)
+	{
+		// the eight face normals covering each slopemap square, in summation order
+		std::array<FloatLanes, 8> ny;
+
+		int x = sx;
+
+		for (; (x + BATCH_SIZE - 1) <= ex; x += BATCH_SIZE) {
+			for (int i = 0; i < BATCH_SIZE; i++) {
+				const int idx0 = (y*2    ) * (mapx) + (x + i)*2;
+				const int idx1 = (y*2 + 1) * (mapx) + (x + i)*2;
+
+				ny[0][i] = faceNormals[(idx0    ) * 2    ].y;
+				ny[1][i] = faceNormals[(idx0    ) * 2 + 1].y;
+				ny[2][i] = faceNormals[(idx0 + 1) * 2    ].y;
+				ny[3][i] = faceNormals[(idx0 + 1) * 2 + 1].y;
+				ny[4][i] = faceNormals[(idx1    ) * 2    ].y;
+				ny[5][i] = faceNormals[(idx1    ) * 2 + 1].y;
+				ny[6][i] = faceNormals[(idx1 + 1) * 2    ].y;
+				ny[7][i] = faceNormals[(idx1 + 1) * 2 + 1].y;
+			}
+
+			FloatBatch avgslope = FloatBatch(0.0f);
+			FloatBatch maxslope = LoadBatch(ny[0]);
+
+			for (const FloatLanes& lanes: ny) {
+				avgslope = avgslope + LoadBatch(lanes);
+			}
+			for (size_t j = 1; j < ny.size(); j++) {
+				maxslope = MinBatch(maxslope, LoadBatch(ny[j]));
+			}
+
+			avgslope = avgslope * FloatBatch(0.125f);
+
+			const FloatBatch lerp = maxslope / avgslope;
+			const FloatBatch slope = maxslope + (avgslope - maxslope) * lerp;
+
+			xsimd::store_unaligned(slopeMap + y * hmapx + x, FloatBatch(1.0f) - slope);
+		}
+
+		SlopeRow(faceNormals, slopeMap, mapx, hmapx, y, x, ex);
+	}
+
+#else
+
+	// no SIMD instruction set available, forward to the references
+	inline void CenterHeightRowSIMD(const float* cornerHM, float* centerHM, float* maxHM, int mapx, int y, int x1, int x2) { CenterHeightRow(cornerHM, centerHM, maxHM, mapx, y, x1, x2); }
+	inline void MipHeightRowSIMD(const float* topMip, float* subMip, int topMipX, int y, int sx, int ex) { MipHeightRow(topMip, subMip, topMipX, y, sx, ex); }
+	inline void FaceNormalRowSIMD(const float* cornerHM, float3* faceNormals, float3* centerNormals, float3* centerNormals2D, int mapx, int y, int x1, int x2) { FaceNormalRow(cornerHM, faceNormals, centerNormals, centerNormals2D, mapx, y, x1, x2); }
+	inline void SlopeRowSIMD(const float3* faceNormals, float* slopeMap, int mapx, int hmapx, int y, int sx, int ex) { SlopeRow(faceNormals, slopeMap, mapx, hmapx, y, sx, ex); }
+
+#endif
+}
+
+#if defined(__clang__)
+	#pragma float_control(pop)
+#elif defined(__GNUC__)
+	#pragma GCC pop_options
+#endif
+
+#endif // HEIGHTMAP_KERNELS_H
@@ -18,6 +18,10 @@ public:
 	virtual void RecalcArea(int x1, int x2, int y1, int y2) = 0;
 	virtual void TerrainTypeHardnessChanged(int ttIndex) {}
 	virtual void TerrainTypeSpeedModChanged(int ttIndex) {}
+	/// typemap square (tx, tz) was assigned a different terrain-type
+	virtual void TerrainTypeMapChanged(int tx, int tz) {}
+	/// any part of the typemap may have changed, e.g. when restored from a savegame
+	virtual void TerrainTypeMapReloaded() {}
 
 	virtual void Init() = 0;
 	virtual void Update() = 0;
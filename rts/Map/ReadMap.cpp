@@ -4,8 +4,11 @@
 #include <cstdlib>
 #include <cstring> // memcpy
 
+#include <nowide/cstdio.hpp>
+
 #include "xsimd/xsimd.hpp"
 #include "ReadMap.h"
+#include "HeightMapKernels.hpp"
 #include "MapDamage.h"
 #include "MapInfo.h"
 #include "MetalMap.h"
@@ -17,13 +20,17 @@
 #include "System/SpringMath.h"
 #include "System/Threading/ThreadPool.h"
 #include "System/FileSystem/ArchiveScanner.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileQueryFlags.h"
 #include "System/FileSystem/FileHandler.h"
 #include "System/FileSystem/FileSystem.h"
+#include "System/FileSystem/FileView.h"
 #include "System/Log/ILog.h"
 #include "System/SpringHash.h"
 #include "System/SafeUtil.h"
 #include "System/TimeProfiler.h"
 #include "System/XSimdOps.hpp"
+#include "Game/GameVersion.h"
 #include "Game/GlobalUnsynced.h"
 #include "Sim/Misc/LosHandler.h"
 
@@ -290,6 +297,8 @@ void CReadMap::PostLoad()
 
 	hmUpdated = true;
 
+	// SerializeTypeMap restored the (possibly Lua-modified) typemap behind its back
+	mapDamage->TerrainTypeMapReloaded();
 	mapDamage->RecalcArea(0, mapDims.mapx, 0, mapDims.mapy);
 }
 #endif //USING_CREG
@@ -404,7 +413,13 @@ void CReadMap::Initialize()
 
 	// not callable here because losHandler is still uninitialized, deferred to Game::PostLoadSim
 	// InitHeightMapDigestVectors();
-	UpdateHeightMapSynced({0, 0, mapDims.mapx, mapDims.mapy});
+	if (ReadDerivedHeightMapCache()) {
+		// what UpdateHeightMapSynced does for the initial update
+		unsyncedHeightMapUpdates.push_back({0, 0, mapDims.mapx, mapDims.mapy});
+	} else {
+		UpdateHeightMapSynced({0, 0, mapDims.mapx, mapDims.mapy});
+		WriteDerivedHeightMapCache();
+	}
 
 	unsyncedHeightInfo.resize(
 		(mapDims.mapx / PATCH_SIZE) * (mapDims.mapy / PATCH_SIZE),
@@ -619,24 +634,7 @@ void CReadMap::UpdateCenterHeightmap(const SRectangle& rect, bool initialize) co
 	const float* heightmapSynced = GetCornerHeightMapSynced();
 
 	for_mt_chunk(rect.z1, rect.z2 + 1, [heightmapSynced, &rect](const int y) {
-		for (int x = rect.x1; x <= rect.x2; x++) {
-			const int idxTL = (y + 0) * mapDims.mapxp1 + x + 0;
-			const int idxTR = (y + 0) * mapDims.mapxp1 + x + 1;
-			const int idxBL = (y + 1) * mapDims.mapxp1 + x + 0;
-			const int idxBR = (y + 1) * mapDims.mapxp1 + x + 1;
-
-			const int index = y * mapDims.mapx + x;
-			const float height =
-				heightmapSynced[idxTL] +
-				heightmapSynced[idxTR] +
-				heightmapSynced[idxBL] +
-				heightmapSynced[idxBR];
-			centerHeightMap[index] = height * 0.25f;
-			maxHeightMap[index] = std::max
-					( std::max(heightmapSynced[idxTL], heightmapSynced[idxTR])
-					, std::max(heightmapSynced[idxBL], heightmapSynced[idxBR])
-					);
-		}
+		HeightMapKernels::CenterHeightRowSIMD(heightmapSynced, centerHeightMap.data(), maxHeightMap.data(), mapDims.mapx, y, rect.x1, rect.x2);
 	}, 256);
 }
 
@@ -652,18 +650,11 @@ void CReadMap::UpdateMipHeightmaps(const SRectangle& rect, bool initialize)
 		const int sy = (rect.z1 >> i) & (~1);
 		const int ey = (rect.z2 >> i);
 
-		float* topMipMap = mipPointerHeightMaps[i    ];
-		float* subMipMap = mipPointerHeightMaps[i + 1];
+		const float* topMipMap = mipPointerHeightMaps[i    ];
+		      float* subMipMap = mipPointerHeightMaps[i + 1];
 
 		for (int y = sy; y < ey; y += 2) {
-			for (int x = sx; x < ex; x += 2) {
-				const float height =
-					topMipMap[(x    ) + (y    ) * hmapx] +
-					topMipMap[(x    ) + (y + 1) * hmapx] +
-					topMipMap[(x + 1) + (y    ) * hmapx] +
-					topMipMap[(x + 1) + (y + 1) * hmapx];
-				subMipMap[(x / 2) + (y / 2) * hmapx / 2] = height * 0.25f;
-			}
+			HeightMapKernels::MipHeightRowSIMD(topMipMap, subMipMap, hmapx, y, sx, ex);
 		}
 	}
 }
@@ -680,60 +671,16 @@ void CReadMap::UpdateFaceNormals(const SRectangle& rect, bool initialize)
 	const int x2 = std::min(mapDims.mapxm1, rect.x2 + 1);
 
 	for_mt_chunk(z1, z2 + 1, [&](const int y) {
-		float3 fnTL;
-		float3 fnBR;
-
-		for (int x = x1; x <= x2; x++) {
-			const int idxTL = (y    ) * mapDims.mapxp1 + x; // TL
-			const int idxBL = (y + 1) * mapDims.mapxp1 + x; // BL
-
-			const float& hTL = heightmapSynced[idxTL    ];
-			const float& hTR = heightmapSynced[idxTL + 1];
-			const float& hBL = heightmapSynced[idxBL    ];
-			const float& hBR = heightmapSynced[idxBL + 1];
-
-			// normal of top-left triangle (face) in square
-			//
-			//  *---> e1
-			//  |
-			//  |
-			//  v
-			//  e2
-			//const float3 e1( SQUARE_SIZE, hTR - hTL,           0);
-			//const float3 e2(           0, hBL - hTL, SQUARE_SIZE);
-			//const float3 fnTL = (e2.cross(e1)).Normalize();
-			fnTL.y = SQUARE_SIZE;
-			fnTL.x = - (hTR - hTL);
-			fnTL.z = - (hBL - hTL);
-			fnTL.Normalize();
-
-			// normal of bottom-right triangle (face) in square
-			//
-			//         e3
-			//         ^
-			//         |
-			//         |
-			//  e4 <---*
-			//const float3 e3(-SQUARE_SIZE, hBL - hBR,           0);
-			//const float3 e4(           0, hTR - hBR,-SQUARE_SIZE);
-			//const float3 fnBR = (e4.cross(e3)).Normalize();
-			fnBR.y = SQUARE_SIZE;
-			fnBR.x = (hBL - hBR);
-			fnBR.z = (hTR - hBR);
-			fnBR.Normalize();
-
-			faceNormalsSynced[(y * mapDims.mapx + x) * 2    ] = fnTL;
-			faceNormalsSynced[(y * mapDims.mapx + x) * 2 + 1] = fnBR;
-			// square-normal
-			centerNormalsSynced[y * mapDims.mapx + x] = (fnTL + fnBR).Normalize();
-			centerNormals2D[y * mapDims.mapx + x] = (fnTL + fnBR).Normalize2D();
-
-			if (initialize) {
-				faceNormalsUnsynced[(y * mapDims.mapx + x) * 2    ] = faceNormalsSynced[(y * mapDims.mapx + x) * 2    ];
-				faceNormalsUnsynced[(y * mapDims.mapx + x) * 2 + 1] = faceNormalsSynced[(y * mapDims.mapx + x) * 2 + 1];
-				centerNormalsUnsynced[y * mapDims.mapx + x] = centerNormalsSynced[y * mapDims.mapx + x];
-			}
-		}
+		HeightMapKernels::FaceNormalRowSIMD(heightmapSynced, faceNormalsSynced.data(), centerNormalsSynced.data(), centerNormals2D.data(), mapDims.mapx, y, x1, x2);
+
+		if (!initialize)
+			return;
+
+		const int idx1 = y * mapDims.mapx + x1;
+		const int idx2 = y * mapDims.mapx + x2 + 1;
+
+		std::copy(faceNormalsSynced.begin() + idx1 * 2, faceNormalsSynced.begin() + idx2 * 2, faceNormalsUnsynced.begin() + idx1 * 2);
+		std::copy(centerNormalsSynced.begin() + idx1, centerNormalsSynced.begin() + idx2, centerNormalsUnsynced.begin() + idx1);
 	}, 64);
 }
 
@@ -747,40 +694,174 @@ void CReadMap::UpdateSlopemap(const SRectangle& rect, bool initialize)
 	const int ey = std::min(mapDims.hmapy - 1, (rect.z2 / 2) + 1);
 
 	for_mt_chunk(sy, ey + 1, [sx, ex](const int y) {
-		for (int x = sx; x <= ex; x++) {
-			const int idx0 = (y*2    ) * (mapDims.mapx) + x*2;
-			const int idx1 = (y*2 + 1) * (mapDims.mapx) + x*2;
-
-			float avgslope = 0.0f;
-			avgslope += faceNormalsSynced[(idx0    ) * 2    ].y;
-			avgslope += faceNormalsSynced[(idx0    ) * 2 + 1].y;
-			avgslope += faceNormalsSynced[(idx0 + 1) * 2    ].y;
-			avgslope += faceNormalsSynced[(idx0 + 1) * 2 + 1].y;
-			avgslope += faceNormalsSynced[(idx1    ) * 2    ].y;
-			avgslope += faceNormalsSynced[(idx1    ) * 2 + 1].y;
-			avgslope += faceNormalsSynced[(idx1 + 1) * 2    ].y;
-			avgslope += faceNormalsSynced[(idx1 + 1) * 2 + 1].y;
-			avgslope *= 0.125f;
-
-			float maxslope =              faceNormalsSynced[(idx0    ) * 2    ].y;
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx0    ) * 2 + 1].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx0 + 1) * 2    ].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx0 + 1) * 2 + 1].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx1    ) * 2    ].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx1    ) * 2 + 1].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx1 + 1) * 2    ].y);
-			maxslope = std::min(maxslope, faceNormalsSynced[(idx1 + 1) * 2 + 1].y);
-
-			// smooth it a bit, so small holes don't block huge tanks
-			const float lerp = maxslope / avgslope;
-			const float slope = mix(maxslope, avgslope, lerp);
-
-			slopeMap[y * mapDims.hmapx + x] = 1.0f - slope;
-		}
+		HeightMapKernels::SlopeRowSIMD(faceNormalsSynced.data(), slopeMap.data(), mapDims.mapx, mapDims.hmapx, y, sx, ex);
 	}, 128);
 }
 
 
+namespace {
+	constexpr char HEIGHTMAP_CACHE_MAGIC[8] = {'S', 'P', 'R', 'H', 'M', 'A', 'P', 'C'};
+	constexpr uint32_t HEIGHTMAP_CACHE_VERSION = 1;
+
+	struct HeightMapCacheHeader {
+		char magic[sizeof(HEIGHTMAP_CACHE_MAGIC)];
+		uint32_t version;
+		// derived values are only bit-exact for a given engine build
+		uint32_t syncVersionHash;
+		uint32_t mapChecksum;
+		int32_t mapx;
+		int32_t mapy;
+		// over all sections, guards against truncated or corrupted files
+		uint32_t dataChecksum;
+	};
+
+	std::string GetHeightMapCacheDir() {
+		return (FileSystem::GetCacheDir() + FileSystem::GetNativePathSeparator() + "heightmaps" + FileSystem::GetNativePathSeparator());
+	}
+
+	std::string GetHeightMapCacheFileName(uint32_t mapChecksum) {
+		char fileName[32];
+		snprintf(fileName, sizeof(fileName), "%08x.bin", mapChecksum);
+		return (GetHeightMapCacheDir() + fileName);
+	}
+
+	HeightMapCacheHeader MakeHeightMapCacheHeader(uint32_t mapChecksum) {
+		HeightMapCacheHeader header;
+
+		std::memcpy(header.magic, HEIGHTMAP_CACHE_MAGIC, sizeof(header.magic));
+
+		header.version = HEIGHTMAP_CACHE_VERSION;
+		header.syncVersionHash = spring::LiteHash(SpringVersion::GetSync().data(), SpringVersion::GetSync().size(), 0);
+		header.mapChecksum = mapChecksum;
+		header.mapx = mapDims.mapx;
+		header.mapy = mapDims.mapy;
+		header.dataChecksum = 0;
+
+		return header;
+	}
+}
+
+
+/// synced maps only, the unsynced normals are copies of their synced counterparts after loading
+template<typename F> void CReadMap::ForEachDerivedHeightMap(F&& func)
+{
+	func(centerHeightMap.data(), centerHeightMap.size() * sizeof(float));
+	func(maxHeightMap.data(), maxHeightMap.size() * sizeof(float));
+
+	for (auto& mipHeightMap: mipCenterHeightMaps) {
+		func(mipHeightMap.data(), mipHeightMap.size() * sizeof(float));
+	}
+
+	func(faceNormalsSynced.data(), faceNormalsSynced.size() * sizeof(float3));
+	func(centerNormalsSynced.data(), centerNormalsSynced.size() * sizeof(float3));
+	func(centerNormals2D.data(), centerNormals2D.size() * sizeof(float3));
+	func(slopeMap.data(), slopeMap.size() * sizeof(float));
+}
+
+bool CReadMap::ReadDerivedHeightMapCache()
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	const std::string cacheFileName = GetHeightMapCacheFileName(mapChecksum);
+	const std::string cacheFilePath = dataDirsAccess.LocateFile(cacheFileName);
+
+	CFileView fileView;
+
+	if (!FileSystem::FileExists(cacheFilePath) || !fileView.MapFile(cacheFilePath))
+		return false;
+
+	const HeightMapCacheHeader refHeader = MakeHeightMapCacheHeader(mapChecksum);
+	HeightMapCacheHeader fileHeader;
+
+	size_t dataSize = sizeof(fileHeader);
+
+	ForEachDerivedHeightMap([&](const void*, size_t size) { dataSize += size; });
+
+	if (fileView.size() != dataSize) {
+		LOG_L(L_WARNING, "[ReadMap::%s] ignoring cache \"%s\" (size " _STPF_ ", expected " _STPF_ ")", __func__, cacheFileName.c_str(), fileView.size(), dataSize);
+		return false;
+	}
+
+	std::memcpy(&fileHeader, fileView.data(), sizeof(fileHeader));
+
+	bool valid = true;
+	valid &= (std::memcmp(fileHeader.magic, refHeader.magic, sizeof(refHeader.magic)) == 0);
+	valid &= (fileHeader.version == refHeader.version);
+	valid &= (fileHeader.syncVersionHash == refHeader.syncVersionHash);
+	valid &= (fileHeader.mapChecksum == refHeader.mapChecksum);
+	valid &= (fileHeader.mapx == refHeader.mapx);
+	valid &= (fileHeader.mapy == refHeader.mapy);
+
+	if (!valid) {
+		LOG_L(L_WARNING, "[ReadMap::%s] ignoring outdated cache \"%s\"", __func__, cacheFileName.c_str());
+		return false;
+	}
+
+	// these are synced, so never trust a corrupted file; check before copying anything
+	const uint8_t* sectionData = fileView.data() + sizeof(fileHeader);
+	uint32_t dataChecksum = 0;
+
+	ForEachDerivedHeightMap([&](const void*, size_t size) {
+		dataChecksum = spring::LiteHash(sectionData, size, dataChecksum);
+		sectionData += size;
+	});
+
+	if (dataChecksum != fileHeader.dataChecksum) {
+		LOG_L(L_WARNING, "[ReadMap::%s] ignoring corrupted cache \"%s\"", __func__, cacheFileName.c_str());
+		return false;
+	}
+
+	sectionData = fileView.data() + sizeof(fileHeader);
+
+	ForEachDerivedHeightMap([&](void* data, size_t size) {
+		std::memcpy(data, sectionData, size);
+		sectionData += size;
+	});
+
+	std::copy(faceNormalsSynced.begin(), faceNormalsSynced.end(), faceNormalsUnsynced.begin());
+	std::copy(centerNormalsSynced.begin(), centerNormalsSynced.end(), centerNormalsUnsynced.begin());
+
+	LOG("[ReadMap::%s] loaded derived heightmaps from \"%s\"", __func__, cacheFileName.c_str());
+	return true;
+}
+
+void CReadMap::WriteDerivedHeightMapCache() const
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	if (!FileSystem::CreateDirectory(GetHeightMapCacheDir()))
+		return;
+
+	HeightMapCacheHeader header = MakeHeightMapCacheHeader(mapChecksum);
+
+	ForEachDerivedHeightMap([&](const void* data, size_t size) {
+		header.dataChecksum = spring::LiteHash(data, size, header.dataChecksum);
+	});
+
+	const std::string cacheFileName = GetHeightMapCacheFileName(mapChecksum);
+	const std::string cacheFilePath = dataDirsAccess.LocateFile(cacheFileName, FileQueryFlags::WRITE);
+
+	FILE* out = nowide::fopen(cacheFilePath.c_str(), "wb");
+
+	if (out == nullptr) {
+		LOG_L(L_WARNING, "[ReadMap::%s] failed to write to \"%s\"", __func__, cacheFilePath.c_str());
+		return;
+	}
+
+	bool written = (fwrite(&header, sizeof(header), 1, out) == 1);
+
+	ForEachDerivedHeightMap([&](const void* data, size_t size) {
+		written = written && (fwrite(data, 1, size, out) == size);
+	});
+
+	const bool closed = (fclose(out) != EOF);
+
+	if (!written || !closed) {
+		LOG_L(L_WARNING, "[ReadMap::%s] failed to write to \"%s\"", __func__, cacheFilePath.c_str());
+		// never leave a truncated cache behind
+		FileSystem::Remove(cacheFilePath);
+	}
+}
+
+
 /// split the update into multiple invididual (los-square) chunks
 void CReadMap::HeightMapUpdateLOSCheck(const SRectangle& hgtMapRect)
 {
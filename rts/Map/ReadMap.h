@@ -238,6 +238,15 @@ private:
 	void UpdateFaceNormals(const SRectangle& rect, bool initialize);
 	void UpdateSlopemap(const SRectangle& rect, bool initialize);
 
+	/**
+	 * the derived maps of an undeformed heightmap only depend on the map
+	 * (file), so they are cached per mapChecksum across loads
+	 */
+	bool ReadDerivedHeightMapCache();
+	void WriteDerivedHeightMapCache() const;
+
+	template<typename F> static void ForEachDerivedHeightMap(F&& func);
+
 	inline void HeightMapUpdateLOSCheck(const SRectangle& hgtMapRect);
 	inline bool HasHeightMapViewChanged(const int2 losMapPos);
 
@@ -62,6 +62,7 @@ void GameParticipant::Kill(const std::string& reason, const bool flush)
 	aiClientLinks[MAX_AIS].link.reset();
 #ifdef SYNCCHECK
 	syncResponse.clear();
+	syncSections.clear();
 #endif
 
 	myState = (disconnected) ? DISCONNECTED : DISCONNECTING;
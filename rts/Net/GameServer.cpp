@@ -50,6 +50,7 @@
 #include "System/Net/Connection.h"
 #include "System/Net/LocalConnection.h"
 #include "System/Net/UnpackPacket.h"
+#include "System/Sync/SyncChecker.h"
 #include "System/LoadSave/DemoRecorder.h"
 #include "System/LoadSave/DemoReader.h"
 #include "System/Log/ILog.h"
@@ -750,6 +751,9 @@ void CGameServer::CheckSync()
 				for (const auto& desyncGroup: desyncGroups) {
 					const std::string& playerNames = GetPlayerNames(desyncGroup.second);
 					Message(spring::format(SyncError, playerNames.c_str(), outstandingSyncFrame, desyncGroup.first, correctChecksum));
+
+					// all players in a group share the same checksum; any of them localizes the desync
+					ReportDesyncSection(desyncGroup.second[0], playerNames, outstandingSyncFrame, correctChecksum);
 				}
 
 				// send spectator desyncs as private messages to reduce spam
@@ -758,6 +762,7 @@ void CGameServer::CheckSync()
 					Message(spring::format(SyncError, players[p.first].name.c_str(), outstandingSyncFrame, p.second, correctChecksum));
 
 					PrivateMessage(p.first, spring::format(SyncError, players[p.first].name.c_str(), outstandingSyncFrame, p.second, correctChecksum));
+					ReportDesyncSection(p.first, players[p.first].name, outstandingSyncFrame, correctChecksum);
 				}
 			}
 		}
@@ -765,8 +770,10 @@ void CGameServer::CheckSync()
 		// Remove complete sets (for which all player's checksums have been received).
 		if (completeResponseSet) {
 			for (GameParticipant& p: players) {
-				if (p.myState < GameParticipant::DISCONNECTING)
+				if (p.myState < GameParticipant::DISCONNECTING) {
 					p.syncResponse.erase(outstandingSyncFrame);
+					p.syncSections.erase(outstandingSyncFrame);
+				}
 			}
 
 			outstandingSyncFrameIt = outstandingSyncFrames.erase(outstandingSyncFrameIt);
@@ -786,6 +793,57 @@ void CGameServer::CheckSync()
 #endif
 }
 
+#ifdef SYNCCHECK
+void CGameServer::ReportDesyncSection(int desyncPlayerNum, const std::string& playerNames, int frameNum, unsigned correctChecksum)
+{
+	const auto desyncIt = players[desyncPlayerNum].syncSections.find(frameNum);
+
+	if (desyncIt == players[desyncPlayerNum].syncSections.end())
+		return;
+
+	// find a player that agreed on the correct checksum and also sent section checksums
+	const std::vector<unsigned int>* correctSections = nullptr;
+
+	for (const GameParticipant& p: players) {
+		if (p.clientLink == nullptr || p.desynced)
+			continue;
+
+		const auto checksumIt = p.syncResponse.find(frameNum);
+		const auto sectionsIt = p.syncSections.find(frameNum);
+
+		if (checksumIt == p.syncResponse.end() || checksumIt->second != correctChecksum)
+			continue;
+		if (sectionsIt == p.syncSections.end() || sectionsIt->second.size() != desyncIt->second.size())
+			continue;
+
+		correctSections = &sectionsIt->second;
+		break;
+	}
+
+	if (correctSections == nullptr)
+		return;
+
+	// SimFrame enters most sections several times and code running between
+	// frames is charged to whichever section was active last, so which of
+	// them diverged first can not be told; list all of them instead
+	std::string sectionList;
+
+	for (size_t i = 0, n = correctSections->size(); i < n; i++) {
+		if ((*correctSections)[i] == desyncIt->second[i])
+			continue;
+
+		if (!sectionList.empty())
+			sectionList += ", ";
+
+		sectionList += spring::format("\"%s\" (got %x, correct is %x)", CSyncChecker::GetSectionName(i), desyncIt->second[i], (*correctSections)[i]);
+	}
+
+	if (sectionList.empty())
+		return;
+
+	Message(spring::format(SyncErrorSection, playerNames.c_str(), frameNum, sectionList.c_str()));
+}
+#endif
 
 float CGameServer::GetDemoTime() const {
 	if (!gameHasStarted) return gameTime;
@@ -804,8 +862,10 @@ void CGameServer::Update()
 		// if we are not playing a demo, or have no local client, or the
 		// local client is less than <GAME_SPEED> frames behind, advance
 		// <modGameTime>
+		// when benchmarking, hand out a second of demo-time per update
+		// whenever the client has caught up instead of pacing by speed
 		if (demoReader == nullptr || !HasLocalClient() || (serverFrameNum - players[localClientNumber].lastFrameResponse) < GAME_SPEED)
-			modGameTime += (tdif * internalSpeed);
+			modGameTime += ((demoReader != nullptr && CGameSetup::unpacedDemoPlayback)? 1.0f: (tdif * internalSpeed));
 	}
 
 	if (lastPlayerInfo < (spring_gettime() - playerInfoTime)) {
@@ -1378,6 +1438,34 @@ void CGameServer::ProcessPacket(const unsigned playerNum, std::shared_ptr<const
 #endif
 		} break;
 
+		case NETMSG_SYNCSECTIONS: {
+#ifdef SYNCCHECK
+			try {
+				netcode::UnpackPacket pckt(packet, 1);
+
+				uint16_t packetSize; pckt >> packetSize;
+				uint8_t   playerNum; pckt >> playerNum;
+				int32_t    frameNum; pckt >> frameNum;
+
+				if (playerNum != a) {
+					Message(spring::format(WrongPlayer, msgCode, a, playerNum));
+					break;
+				}
+
+				const size_t headerSize = sizeof(uint8_t) + sizeof(packetSize) + sizeof(playerNum) + sizeof(frameNum);
+				std::vector<unsigned int> sectionChecksums((packetSize - std::min<size_t>(packetSize, headerSize)) / sizeof(uint32_t));
+
+				pckt >> sectionChecksums;
+
+				// only consulted by CheckSync to localize a desync
+				if (outstandingSyncFrames.find(frameNum) != outstandingSyncFrames.end())
+					players[a].syncSections[frameNum] = std::move(sectionChecksums);
+			} catch (const netcode::UnpackPacketException& ex) {
+				Message(spring::format("[GameServer::%s][NETMSG_SYNCSECTIONS] exception \"%s\" from player \"%s\"", __func__, ex.what(), players[a].name.c_str()));
+			}
+#endif
+		} break;
+
 		case NETMSG_SHARE:
 			if (inbuf[1] != a) {
 				Message(spring::format(WrongPlayer, msgCode, a, (unsigned)inbuf[1]));
@@ -161,6 +161,9 @@ private:
 	void Update();
 	void ProcessPacket(const unsigned playerNum, std::shared_ptr<const netcode::RawPacket> packet);
 	void CheckSync();
+#ifdef SYNCCHECK
+	void ReportDesyncSection(int desyncPlayerNum, const std::string& playerNames, int frameNum, unsigned correctChecksum);
+#endif
 	void HandleConnectionAttempts();
 	void ServerReadNet();
 
@@ -623,6 +623,11 @@ void CGame::ClientReadNet()
 				ASSERT_SYNCED(CSyncChecker::GetChecksum());
 				clientNet->Send(CBaseNetProtocol::Get().SendSyncResponse(gu->myPlayerNum, gs->frameNum, CSyncChecker::GetChecksum()));
 
+				if (CSyncChecker::SectionsEnabled()) {
+					const auto& sectionChecksums = CSyncChecker::GetSectionChecksums();
+					clientNet->Send(CBaseNetProtocol::Get().SendSyncSections(gu->myPlayerNum, gs->frameNum, {sectionChecksums.begin(), sectionChecksums.end()}));
+				}
+
 				// buffer all checksums, so we can check sync later between demo & local
 				if (haveServerDemo)
 					localSyncChecksums[gs->frameNum] = CSyncChecker::GetChecksum();
@@ -874,9 +879,7 @@ void CGame::ClientReadNet()
 						}
 					} else {
 						for (int16_t c = 0; c < commandCount; c++) {
-							for (int16_t u = 0; u < unitCount; u++) {
-								selectedUnitsHandler.AINetOrder(unitIDs[u], aiInstID, playerID, commands[c]);
-							}
+							selectedUnitsHandler.AINetOrder(unitIDs, aiInstID, playerID, commands[c]);
 						}
 					}
 					AddTraffic(playerID, packetCode, dataLength);
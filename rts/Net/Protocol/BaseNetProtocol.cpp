@@ -383,6 +383,17 @@ PacketType CBaseNetProtocol::SendSyncResponse(uint8_t playerNum, int32_t frameNu
 	return PacketType(packet);
 }
 
+PacketType CBaseNetProtocol::SendSyncSections(uint8_t playerNum, int32_t frameNum, const std::vector<uint32_t>& sectionChecksums)
+{
+	const uint32_t payloadSize = sizeof(playerNum) + sizeof(frameNum) + (sectionChecksums.size() * sizeof(uint32_t));
+	const uint32_t headerSize = sizeof(uint8_t) + sizeof(uint16_t);
+	const uint32_t packetSize = headerSize + payloadSize;
+
+	PackPacket* packet = new PackPacket(packetSize, NETMSG_SYNCSECTIONS);
+	*packet << static_cast<uint16_t>(packetSize) << playerNum << frameNum << sectionChecksums;
+	return PacketType(packet);
+}
+
 PacketType CBaseNetProtocol::SendSystemMessage(uint8_t playerNum, std::string message)
 {
 	if (message.size() > 65000) {
@@ -652,6 +663,7 @@ CBaseNetProtocol::CBaseNetProtocol()
 	proto->AddType(NETMSG_GAMEOVER, -1);
 	proto->AddType(NETMSG_MAPDRAW, -1);
 	proto->AddType(NETMSG_SYNCRESPONSE, 10);
+	proto->AddType(NETMSG_SYNCSECTIONS, -2);
 	proto->AddType(NETMSG_SYSTEMMSG, -2);
 	proto->AddType(NETMSG_STARTPOS, 16);
 	proto->AddType(NETMSG_PLAYERINFO, 10);
@@ -74,6 +74,7 @@ public:
 	PacketType SendMapDrawLine(uint8_t playerNum, uint32_t x1, uint32_t z1, uint32_t x2, uint32_t z2, bool);
 	PacketType SendMapDrawPoint(uint8_t playerNum, uint32_t x, uint32_t z, const std::string& label, bool);
 	PacketType SendSyncResponse(uint8_t playerNum, int32_t frameNum, uint32_t checksum);
+	PacketType SendSyncSections(uint8_t playerNum, int32_t frameNum, const std::vector<uint32_t>& sectionChecksums);
 	PacketType SendSystemMessage(uint8_t playerNum, std::string message);
 	PacketType SendStartPos(uint8_t playerNum, uint8_t teamNum, uint8_t readyState, float x, float y, float z);
 	PacketType SendPlayerInfo(uint8_t playerNum, float cpuUsage, int32_t ping);
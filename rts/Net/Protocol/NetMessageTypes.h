@@ -54,6 +54,7 @@ enum NETMSG {
 	                              // uint8_t messageSize = 21, playerNum, command = MapDrawAction::NET_LINE; int32_t x1, z1, x2, z2, uint8_t fromLua;
 	                              // /*messageSize*/   uint8_t playerNum, command = MapDrawAction::NET_POINT; int32_t x, z; uint8_t fromLua, std::string label;
 	NETMSG_SYNCRESPONSE     = 33, // uint8_t playerNum; int32_t frameNum; uint32_t checksum;
+	NETMSG_SYNCSECTIONS     = 34, // /* uint16_t messageSize */, uint8_t playerNum; int32_t frameNum; std::vector<uint32_t> sectionChecksums;
 	NETMSG_SYSTEMMSG        = 35, // uint8_t playerNum, std::string message;
 	NETMSG_STARTPOS         = 36, // uint8_t playerNum, uint8_t myTeam, ready /*0: not ready, 1: ready, 2: don't update readiness*/; float x, y, z;
 	NETMSG_PLAYERINFO       = 38, // uint8_t playerNum; float cpuUsage; int32_t ping /*in milliseconds*/;
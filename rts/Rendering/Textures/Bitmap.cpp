@@ -5,6 +5,7 @@
 #include <utility>
 #include <cstring>
 #include <memory>
+#include <span>
 
 #include <IL/il.h>
 #include <SDL_video.h>
@@ -1284,6 +1285,7 @@ bool CBitmap::Load(std::string const& filename, float defaultAlpha, uint32_t req
 
 	CFileHandler file(filename);
 	std::vector<uint8_t> buffer;
+	std::span<const uint8_t> fileData;
 
 	if (!file.FileExists()) {
 		AllocDummy();
@@ -1293,9 +1295,10 @@ bool CBitmap::Load(std::string const& filename, float defaultAlpha, uint32_t req
 	if (!file.IsBuffered()) {
 		buffer.resize(file.FileSize(), 0);
 		file.Read(buffer.data(), buffer.size());
+		fileData = buffer;
 	} else {
-		// steal if file was loaded from VFS
-		buffer = std::move(file.GetBuffer());
+		// decode straight from the VFS data (mapped or cached), no copy
+		fileData = file.GetSpan();
 	}
 
 
@@ -1316,7 +1319,7 @@ bool CBitmap::Load(std::string const& filename, float defaultAlpha, uint32_t req
 			// do not signal floating point exceptions in devil library
 			ScopedDisableFpuExceptions fe;
 
-			isLoaded = !!ilLoadL(IL_TYPE_UNKNOWN, buffer.data(), static_cast<ILuint>(buffer.size()));
+			isLoaded = !!ilLoadL(IL_TYPE_UNKNOWN, fileData.data(), static_cast<ILuint>(fileData.size()));
 			currFormat = ilGetInteger(IL_IMAGE_FORMAT);
 			isValid = (isLoaded && IsValidImageFormat(currFormat));
 			dataType = ilGetInteger(IL_IMAGE_TYPE);
@@ -1438,13 +1441,15 @@ bool CBitmap::LoadGrayscale(const std::string& filename)
 		return false;
 
 	std::vector<uint8_t> buffer;
+	std::span<const uint8_t> fileData;
 
 	if (!file.IsBuffered()) {
 		buffer.resize(file.FileSize() + 1, 0);
 		file.Read(buffer.data(), file.FileSize());
+		fileData = buffer;
 	} else {
-		// steal if file was loaded from VFS
-		buffer = std::move(file.GetBuffer());
+		// decode straight from the VFS data (mapped or cached), no copy
+		fileData = file.GetSpan();
 	}
 
 	{
@@ -1457,7 +1462,7 @@ bool CBitmap::LoadGrayscale(const std::string& filename)
 		ilGenImages(1, &imageID);
 		ilBindImage(imageID);
 
-		const bool success = !!ilLoadL(IL_TYPE_UNKNOWN, buffer.data(), buffer.size());
+		const bool success = !!ilLoadL(IL_TYPE_UNKNOWN, fileData.data(), fileData.size());
 		ilDisable(IL_ORIGIN_SET);
 
 		if (!success)
@@ -519,6 +519,18 @@ void CFeature::ForcedSpin(const float3& newFrontDir, const float3& newRightDir)
 }
 
 
+void CFeature::UpdateTransform(const float3& p, bool synced)
+{
+	transMatrix[synced] = std::move(ComposeMatrix(p));
+
+	if (!synced)
+		return;
+
+	// the interpolated (pre-frame) transform has to follow next frame
+	prevFrameNeedsUpdate = true;
+	featureHandler.SetFeatureTransformDirty(this);
+}
+
 void CFeature::UpdateTransformAndPhysState()
 {
 	RECOIL_DETAILED_TRACY_ZONE;
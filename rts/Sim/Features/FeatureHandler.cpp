@@ -25,7 +25,8 @@ CR_REG_METADATA(CFeatureHandler, (
 	CR_MEMBER(activeFeatureIDs),
 	CR_MEMBER(features),
 	CR_MEMBER(updateFeatures),
-	CR_MEMBER(featuresJustAdded)
+	CR_MEMBER(featuresJustAdded),
+	CR_MEMBER(dirtyTransformFeatureIDs)
 ))
 
 /******************************************************************************/
@@ -57,6 +58,7 @@ void CFeatureHandler::Kill() {
 
 	activeFeatureIDs.clear();
 	featuresJustAdded.clear();
+	dirtyTransformFeatureIDs.clear();
 	deletedFeatureIDs.clear();
 	features.clear();
 	updateFeatures.clear();
@@ -76,8 +78,18 @@ void CFeatureHandler::LoadFeaturesFromMap()
 	mfi.resize(numFeatures);
 	readMap->GetFeatureInfo(&mfi[0]);
 
+	// forest maps place thousands of instances of a handful of types;
+	// resolve (and complain about) each type's def only once
+	std::vector<const FeatureDef*> typeDefs(readMap->GetNumFeatureTypes(), nullptr);
+
+	for (size_t i = 0; i < typeDefs.size(); ++i) {
+		typeDefs[i] = featureDefHandler->GetFeatureDef(readMap->GetFeatureTypeName(i), true);
+	}
+
 	for (int a = 0; a < numFeatures; ++a) {
-		const FeatureDef* def = featureDefHandler->GetFeatureDef(readMap->GetFeatureTypeName(mfi[a].featureType), true);
+		assert(mfi[a].featureType >= 0 && mfi[a].featureType < typeDefs.size());
+
+		const FeatureDef* def = typeDefs[mfi[a].featureType];
 
 		if (def == nullptr)
 			continue;
@@ -192,12 +204,17 @@ void CFeatureHandler::UpdatePreFrame()
 {
 	SCOPED_TIMER("Sim::Features::UpdatePreFrame");
 
-	for (auto* feature : features) {
-		if (!feature) // sucks, but w/e
+	for (const int featureID: dirtyTransformFeatureIDs) {
+		CFeature* feature = features[featureID];
+
+		// deleted since it was marked (or the ID was recycled, which is harmless)
+		if (feature == nullptr)
 			continue;
 
 		feature->UpdatePrevFrameTransform();
 	}
+
+	dirtyTransformFeatureIDs.clear();
 }
 
 void CFeatureHandler::UpdatePostFrame()
@@ -294,6 +311,17 @@ void CFeatureHandler::SetFeatureUpdateable(CFeature* feature)
 }
 
 
+void CFeatureHandler::SetFeatureTransformDirty(const CFeature* feature)
+{
+	// not yet added, UpdatePostFrame takes care of new features
+	if (feature->id < 0 || feature->id >= features.size() || features[feature->id] != feature)
+		return;
+
+	// duplicates are cheap, UpdatePrevFrameTransform only runs once per change
+	dirtyTransformFeatureIDs.push_back(feature->id);
+}
+
+
 void CFeatureHandler::TerrainChanged(int x1, int y1, int x2, int y2)
 {
 	RECOIL_DETAILED_TRACY_ZONE;
@@ -65,6 +65,7 @@ public:
 	void LoadFeaturesFromMap();
 
 	void SetFeatureUpdateable(CFeature* feature);
+	void SetFeatureTransformDirty(const CFeature* feature);
 	void TerrainChanged(int x1, int y1, int x2, int y2);
 
 	const spring::unordered_set<int>& GetActiveFeatureIDs() const { return activeFeatureIDs; }
@@ -91,6 +92,10 @@ private:
 	std::vector<CFeature*> features;
 	std::vector<CFeature*> updateFeatures;
 	std::vector<CFeature*> featuresJustAdded;
+
+	// features whose synced transform changed since the last UpdatePreFrame;
+	// map features that never move stay out of it and cost nothing per frame
+	std::vector<int> dirtyTransformFeatureIDs;
 };
 
 extern CFeatureHandler featureHandler;
@@ -28,7 +28,8 @@ CR_BIND(CGroundBlockingObjectMap, )
 CR_REG_METADATA(CGroundBlockingObjectMap, (
 	CR_MEMBER(arrCells),
 	CR_MEMBER(vecCells),
-	CR_MEMBER(vecIndcs)
+	CR_MEMBER(vecIndcs),
+	CR_MEMBER(cellMasks)
 ))
 
 
@@ -180,20 +181,19 @@ bool CGroundBlockingObjectMap::GroundBlocked(int x, int z, const CSolidObject* i
 	if (static_cast<unsigned int>(x) >= mapDims.mapx || static_cast<unsigned int>(z) >= mapDims.mapy)
 		return false;
 
-	const BlockingMapCell& cell = GetCellUnsafeConst(z * mapDims.mapx + x);
+	const unsigned int sqr = z * mapDims.mapx + x;
+	const uint8_t mask = GetCellMaskUnsafe(sqr);
 
-	if (cell.empty())
+	if ((mask & CELL_MASK_BLOCKED) == 0)
 		return false;
 
-	// check if the first object in <cell> is NOT the ignoree
-	// if so the ground is definitely blocked at this location
-	if (cell[0] != ignoreObj)
+	// the ground is considered blocked if there is at least one
+	// other object in the cell together with the ignoree, or if
+	// the only object is NOT the ignoree
+	if ((mask & CELL_MASK_MULTIPLE) != 0)
 		return true;
 
-	// otherwise the ground is considered blocked only if there
-	// is at least one other object in <cell> together with the
-	// ignoree
-	return (cell.size() >= 2);
+	return (GetArrCell(sqr)[0] != ignoreObj);
 }
 
 
@@ -271,8 +271,8 @@ unsigned int CGroundBlockingObjectMap::CalcChecksum() const
 	RECOIL_DETAILED_TRACY_ZONE;
 	unsigned int checksum = 666;
 
-	for (unsigned int i = 0; i < arrCells.size(); ++i) {
-		if (!arrCells[i].Empty())
+	for (unsigned int i = 0; i < cellMasks.size(); ++i) {
+		if (CellBlockedUnsafe(i))
 			checksum = spring::LiteHash(&i, sizeof(i), checksum);
 	}
 
@@ -281,6 +281,22 @@ unsigned int CGroundBlockingObjectMap::CalcChecksum() const
 
 
 
+void CGroundBlockingObjectMap::UpdateCellMask(unsigned int sqr) {
+	const BlockingMapCell& cell = GetCellUnsafeConst(sqr);
+	const size_t numObjs = cell.size();
+
+	uint8_t mask = 0;
+
+	mask |= (CELL_MASK_BLOCKED  * (numObjs >= 1));
+	mask |= (CELL_MASK_MULTIPLE * (numObjs >= 2));
+
+	for (size_t i = 0; i < numObjs; i++) {
+		mask |= ((cell[i]->immobile)? CELL_MASK_IMMOBILE: CELL_MASK_MOBILE);
+	}
+
+	cellMasks[sqr] = mask;
+}
+
 bool CGroundBlockingObjectMap::CellInsertUnique(unsigned int sqr, CSolidObject* o) {
 	RECOIL_DETAILED_TRACY_ZONE;
 	ArrCell& ac = GetArrCell(sqr);
@@ -288,8 +304,10 @@ bool CGroundBlockingObjectMap::CellInsertUnique(unsigned int sqr, CSolidObject*
 
 	if (ac.Contains(o))
 		return false;
-	if (ac.Insert(o))
+	if (ac.Insert(o)) {
+		UpdateCellMask(sqr);
 		return true;
+	}
 
 	// array-cell is full, spill over
 	if ((vc = &GetVecCell(sqr)) == &vecCells[0]) {
@@ -303,7 +321,11 @@ bool CGroundBlockingObjectMap::CellInsertUnique(unsigned int sqr, CSolidObject*
 		}
 	}
 
-	return (spring::VectorInsertUnique(*vc, o, true));
+	if (!spring::VectorInsertUnique(*vc, o, true))
+		return false;
+
+	UpdateCellMask(sqr);
+	return true;
 }
 
 bool CGroundBlockingObjectMap::CellErase(unsigned int sqr, CSolidObject* o) {
@@ -312,8 +334,10 @@ bool CGroundBlockingObjectMap::CellErase(unsigned int sqr, CSolidObject* o) {
 	VecCell* vc = nullptr;
 
 	if (ac.Erase(o)) {
-		if (ac.GetVecIndx() == 0)
+		if (ac.GetVecIndx() == 0) {
+			UpdateCellMask(sqr);
 			return true;
+		}
 
 		// never allow a hole between array and vector parts
 		assert(!vecCells[ac.GetVecIndx()].empty());
@@ -342,6 +366,7 @@ CommonExit:
 		ac.SetVecIndx(0);
 	}
 
+	UpdateCellMask(sqr);
 	return true;
 }
 
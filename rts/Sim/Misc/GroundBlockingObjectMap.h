@@ -3,6 +3,7 @@
 #ifndef GROUNDBLOCKINGOBJECTMAP_H
 #define GROUNDBLOCKINGOBJECTMAP_H
 
+#include <algorithm>
 #include <array>
 #include <vector>
 
@@ -73,6 +74,15 @@ private:
 	typedef std::vector<CSolidObject*> VecCell;
 
 public:
+	// per-square summary of the cell contents, kept in a dense array of its
+	// own so that queries over (mostly) empty squares need not touch cells
+	enum CellMaskBits: uint8_t {
+		CELL_MASK_BLOCKED  = 1 << 0, ///< at least one object
+		CELL_MASK_MULTIPLE = 1 << 1, ///< at least two objects
+		CELL_MASK_MOBILE   = 1 << 2, ///< at least one mobile object
+		CELL_MASK_IMMOBILE = 1 << 3, ///< at least one immobile object (building or feature)
+	};
+
 	struct BlockingMapCell {
 	public:
 		BlockingMapCell() = delete;
@@ -99,6 +109,7 @@ public:
 
 	void Init(unsigned int numSquares) {
 		arrCells.resize(numSquares);
+		cellMasks.resize(numSquares, 0);
 		vecCells.reserve(32);
 		vecIndcs.reserve(32);
 
@@ -116,6 +127,8 @@ public:
 			v.clear();
 		}
 
+		std::fill(cellMasks.begin(), cellMasks.end(), 0);
+
 		vecIndcs.clear();
 	}
 
@@ -138,14 +151,17 @@ public:
 
 	// same as GroundBlocked(), but does not bounds-check mapSquare
 	CSolidObject* GroundBlockedUnsafe(unsigned int mapSquare) const {
-		const BlockingMapCell& cell = GetCellUnsafeConst(mapSquare);
-
-		if (cell.empty())
+		if (!CellBlockedUnsafe(mapSquare))
 			return nullptr;
 
-		return cell[0];
+		return (GetArrCell(mapSquare)[0]);
 	}
 
+	// CELL_MASK_* bits for mapSquare, no bounds-check
+	uint8_t GetCellMaskUnsafe(unsigned int mapSquare) const { return cellMasks[mapSquare]; }
+
+	bool CellBlockedUnsafe(unsigned int mapSquare) const { return ((cellMasks[mapSquare] & CELL_MASK_BLOCKED) != 0); }
+
 
 	bool GroundBlocked(int x, int z, const CSolidObject* ignoreObj) const;
 	bool GroundBlocked(const float3& pos, const CSolidObject* ignoreObj) const;
@@ -153,6 +169,8 @@ public:
 	bool ObjectInCell(unsigned int mapSquare, const CSolidObject* obj) const {
 		if (mapSquare >= arrCells.size())
 			return false;
+		if (!CellBlockedUnsafe(mapSquare))
+			return false;
 
 		const ArrCell& ac = GetArrCell(mapSquare);
 		const VecCell* vc = nullptr;
@@ -182,10 +200,14 @@ private:
 	bool CellInsertUnique(unsigned int sqr, CSolidObject* o);
 	bool CellErase(unsigned int sqr, CSolidObject* o);
 
+	void UpdateCellMask(unsigned int sqr);
+
 private:
 	std::vector<ArrCell> arrCells;
 	std::vector<VecCell> vecCells;
 	std::vector<uint32_t> vecIndcs;
+
+	std::vector<uint8_t> cellMasks;
 };
 
 extern CGroundBlockingObjectMap groundBlockingObjectMap;
@@ -136,6 +136,8 @@ void CModInfo::ResetState()
 		qtMaxNodesSearched = 8192;
 		qtRefreshPathMinDist = 512.f;
 		qtMaxNodesSearchedRelativeToMapOpenNodes = 0.25;
+		qtBidirectionalOptimalMeet = false;
+		qtPruneUniformCostNeighbours = false;
 
 		enableSmoothMesh = true;
 		smoothMeshResDivider = 2;
@@ -197,6 +199,8 @@ void CModInfo::Init(const std::string& modFileName)
 		qtMaxNodesSearched = system.GetInt("qtMaxNodesSearched", qtMaxNodesSearched);
 		qtRefreshPathMinDist = system.GetFloat("qtRefreshPathMinDist", qtRefreshPathMinDist);
 		qtMaxNodesSearchedRelativeToMapOpenNodes = system.GetFloat("qtMaxNodesSearchedRelativeToMapOpenNodes", qtMaxNodesSearchedRelativeToMapOpenNodes);
+		qtBidirectionalOptimalMeet = system.GetBool("qtBidirectionalOptimalMeet", qtBidirectionalOptimalMeet);
+		qtPruneUniformCostNeighbours = system.GetBool("qtPruneUniformCostNeighbours", qtPruneUniformCostNeighbours);
 
 		enableSmoothMesh = system.GetBool("enableSmoothMesh", enableSmoothMesh);
 		smoothMeshResDivider = system.GetInt("smoothMeshResDivider", smoothMeshResDivider);
@@ -228,6 +228,16 @@ public:
 	/// would bring the unit nearer to the goal.
 	float qtRefreshPathMinDist;
 
+	/// Keep both QTPFS search directions running after they first touch, until no cheaper
+	/// meeting point can exist (meet-in-the-middle termination). Produces better paths at the
+	/// cost of more nodes searched. Partial-share and repair searches are not affected.
+	bool qtBidirectionalOptimalMeet;
+
+	/// Skip neighbours that the parent of the expanded QTPFS node has already reached, when both
+	/// nodes have the same move cost (jump-point style pruning over uniform terrain). Reduces node
+	/// expansions, but paths may be slightly less direct.
+	bool qtPruneUniformCostNeighbours;
+
 	float pfRawDistMult;
 	float pfUpdateRateScale;
 
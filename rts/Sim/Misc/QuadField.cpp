@@ -987,4 +987,54 @@ void CQuadField::GetUnitsAndFeaturesColVol(
 		}
 	}
 }
+
+void CQuadField::GetUnitsAndFeaturesColVolMT(
+	const float3& pos,
+	const float radius,
+	std::vector<CUnit*>& units,
+	std::vector<CFeature*>& features,
+	int curThread
+) {
+	RECOIL_DETAILED_TRACY_ZONE;
+	const int tempNum = gs->GetMtTempNum(curThread);
+
+	QuadFieldQuery qfQuery;
+	qfQuery.threadOwner = curThread;
+	GetQuads(qfQuery, pos, radius);
+
+	// same visiting order as GetUnitsAndFeaturesColVol
+	for (const int qi: *qfQuery.quads) {
+		const Quad& quad = baseQuads[qi];
+
+		for (CUnit* u: quad.units) {
+			if (u->mtTempNum[curThread] == tempNum)
+				continue;
+
+			u->mtTempNum[curThread] = tempNum;
+
+			const auto* colvol = &u->collisionVolume;
+			const float totRad = radius + colvol->GetBoundingRadius();
+
+			if (pos.SqDistance(colvol->GetWorldSpacePos(u)) >= (totRad * totRad))
+				continue;
+
+			units.push_back(u);
+		}
+
+		for (CFeature* f: quad.features) {
+			if (f->mtTempNum[curThread] == tempNum)
+				continue;
+
+			f->mtTempNum[curThread] = tempNum;
+
+			const auto* colvol = &f->collisionVolume;
+			const float totRad = radius + colvol->GetBoundingRadius();
+
+			if (pos.SqDistance(colvol->GetWorldSpacePos(f)) >= (totRad * totRad))
+				continue;
+
+			features.push_back(f);
+		}
+	}
+}
 #endif // UNIT_TEST
@@ -97,6 +97,14 @@ public:
 		std::vector<CFeature*>& features,
 		std::vector<CPlasmaRepulser*>* repulsers = nullptr
 	);
+	/// thread-safe variant of the above for use inside for_mt
+	void GetUnitsAndFeaturesColVolMT(
+		const float3& pos,
+		const float radius,
+		std::vector<CUnit*>& units,
+		std::vector<CFeature*>& features,
+		int curThread
+	);
 
 	/**
 	 * Returns all units within @c radius of @c pos,
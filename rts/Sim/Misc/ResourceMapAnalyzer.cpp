@@ -1,5 +1,7 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
+#include <algorithm>
+#include <functional>
 #include <string>
 #include <nowide/cstdio.hpp>
 
@@ -17,6 +19,7 @@
 #include "System/FileSystem/FileQueryFlags.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/Log/ILog.h"
+#include "System/Threading/ThreadPool.h"
 
 #include <stdexcept>
 
@@ -32,19 +35,13 @@ CResourceMapAnalyzer::CResourceMapAnalyzer(int resourceId)
 	, extractorRadius(-1.0f)
 	, averageIncome(0.0f)
 
-	, stopMe(false)
-
 	, maxSpots(10000)
 	, mapHeight(0)
 	, mapWidth(0)
 	, totalCells(0)
 	, squareRadius(0)
 	, doubleSquareRadius(0)
-	, totalResources(0)
 	, maxResource(0)
-	, tempResources(0)
-	, coordX(0)
-	, coordZ(0)
 	, minIncomeForSpot(50)
 	, xtractorRadius(0)
 	, doubleRadius(0)
@@ -71,40 +68,68 @@ float3 CResourceMapAnalyzer::GetNearestSpot(int builderUnitId, const UnitDef* ex
 float3 CResourceMapAnalyzer::GetNearestSpot(float3 fromPos, int team, const UnitDef* extractor) const {
 	RECOIL_DETAILED_TRACY_ZONE;
 
-	float tempScore = 0.0f;
-	float maxDivergence = 16.0f;
-	float3 spotCoords = ERRORVECTOR;
+	constexpr float maxDivergence = 16.0f;
+
+	float bestScore = 0.0f;
 	float3 bestSpot = ERRORVECTOR;
 
-	for (size_t i = 0; i < vectoredSpots.size(); ++i) {
-		if (extractor != nullptr) {
-			spotCoords = CGameHelper::ClosestBuildPos(team, extractor, vectoredSpots[i], maxDivergence, 2);
-		} else {
-			spotCoords = vectoredSpots[i];
-		}
+	if (extractor == nullptr) {
+		for (const float3& spot: vectoredSpots) {
+			const float spotScore = spot.y / (spot.distance2D(fromPos) + 150);
 
-		if (spotCoords.x >= 0.0f) {
-			float distance = spotCoords.distance2D(fromPos) + 150;
-			//float myThreat = ai->tm->ThreatAtThisPoint(vectoredSpots[i]);
-			float spotScore = vectoredSpots[i].y / distance/* / (myThreat + 10)*/;
-			//int numEnemies = ai->cheat->GetEnemyUnits(&ai->unitIDs[0], vectoredSpots[i], xtractorRadius * 2);
-
-			// NOTE: threat at vectoredSpots[i] is determined
-			// by presence of ARMED enemy units or buildings
-			bool b1 = (tempScore < spotScore);
-// 			bool b2 = (numEnemies == 0);
-// 			bool b3 = (myThreat <= (ai->tm->GetAverageThreat() * 1.5));
-// 			bool b4 = (ai->unitHandler.TaskPlanExist(spotCoords, extractor));
-
-			if (b1/* && b2 && b3 && !b4*/) {
-				tempScore = spotScore;
-				bestSpot = spotCoords;
-				bestSpot.y = vectoredSpots[i].y;
+			if (bestScore < spotScore) {
+				bestScore = spotScore;
+				bestSpot = spot;
 			}
 		}
+
+		// no spot found if bestScore is zero
+		return bestSpot;
+	}
+
+	// ClosestBuildPos is by far the most expensive part, so only ask it
+	// for spots that can still beat the best one found so far; the build
+	// position never drifts further than slack from the spot, so the score
+	// at the spot's own position (minus slack) is an upper bound for it
+	constexpr float slack = maxDivergence * 2.0f + BUILD_SQUARE_SIZE * 2.0f;
+
+	std::vector<std::pair<float, int>> candidates;
+	candidates.reserve(vectoredSpots.size());
+
+	for (size_t i = 0; i < vectoredSpots.size(); ++i) {
+		const float minDist = std::max(vectoredSpots[i].distance2D(fromPos) - slack, 0.0f);
+		candidates.emplace_back(vectoredSpots[i].y / (minDist + 150), static_cast<int>(i));
+	}
+
+	std::make_heap(candidates.begin(), candidates.end());
+
+	int bestIndex = -1;
+
+	while (!candidates.empty()) {
+		std::pop_heap(candidates.begin(), candidates.end());
+		const auto [bound, i] = candidates.back();
+		candidates.pop_back();
+
+		if (bound < bestScore)
+			break;
+
+		const float3 spotCoords = CGameHelper::ClosestBuildPos(team, extractor, vectoredSpots[i], maxDivergence, 2);
+
+		if (spotCoords.x < 0.0f)
+			continue;
+
+		const float spotScore = vectoredSpots[i].y / (spotCoords.distance2D(fromPos) + 150);
+
+		// on equal scores the lowest index wins, as with a plain scan
+		if (bestScore < spotScore || (bestScore == spotScore && bestIndex >= 0 && i < bestIndex)) {
+			bestScore = spotScore;
+			bestIndex = i;
+			bestSpot = spotCoords;
+			bestSpot.y = vectoredSpots[i].y;
+		}
 	}
 
-	// no spot found if tempScore is zero
+	// no spot found if bestScore is zero
 	return bestSpot;
 }
 
@@ -125,8 +150,6 @@ void CResourceMapAnalyzer::Init() {
 
 	rexArrayA.resize(totalCells);
 	rexArrayB.resize(totalCells);
-	// used for drawing the TGA, not really needed with a couple of changes
-	rexArrayC.resize(totalCells);
 
 	tempAverage.resize(totalCells);
 
@@ -143,6 +166,78 @@ float CResourceMapAnalyzer::GetAverageIncome() const {
 }
 
 
+int CResourceMapAnalyzer::CalcSpotResources(int x, int y, const std::vector<int>& xend) const {
+	int resources = 0;
+
+	if (x > 0) {
+		// slide the left neighbour's extractor circle one cell to the right
+		resources = tempAverage[y * mapWidth + x - 1];
+
+		for (int sy = y - xtractorRadius, a = 0;  sy <= y + xtractorRadius;  sy++, a++) {
+			if (sy < 0 || sy >= mapHeight)
+				continue;
+
+			const int addX = x + xend[a];
+			const int remX = x - xend[a] - 1;
+
+			if (addX < mapWidth) {
+				resources += rexArrayA[sy * mapWidth + addX];
+			}
+			if (remX >= 0) {
+				resources -= rexArrayA[sy * mapWidth + remX];
+			}
+		}
+
+		return resources;
+	}
+
+	if (y > 0) {
+		// x == 0 here, derive from the cell above
+		// NOTE: this only roughly follows the circle, but changing it would
+		// invalidate every cached resource-map out there
+		resources = tempAverage[(y - 1) * mapWidth];
+
+		// remove the top half
+		for (int sx = 0, a = xtractorRadius;  sx <= xtractorRadius;  sx++, a++) {
+			if (sx < mapWidth) {
+				const int remY = y - xend[a] - 1;
+
+				if (remY >= 0) {
+					resources -= rexArrayA[remY * mapWidth + sx];
+				}
+			}
+		}
+
+		// add the bottom half
+		for (int sx = 0, a = xtractorRadius;  sx <= xtractorRadius;  sx++, a++) {
+			if (sx < mapWidth) {
+				const int addY = y + xend[a];
+
+				if (addY < mapHeight) {
+					resources += rexArrayA[addY * mapWidth + sx];
+				}
+			}
+		}
+
+		return resources;
+	}
+
+	// first spot needs full calculation
+	for (int sy = y - xtractorRadius, a = 0;  sy <= y + xtractorRadius;  sy++, a++) {
+		if (sy < 0 || sy >= mapHeight)
+			continue;
+
+		for (int sx = x - xend[a]; sx <= x + xend[a]; sx++) {
+			if (sx >= 0 && sx < mapWidth) {
+				// get the resources from all pixels around the extractor radius
+				resources += rexArrayA[sy * mapWidth + sx];
+			}
+		}
+	}
+
+	return resources;
+}
+
 void CResourceMapAnalyzer::GetResourcePoints() {
 	RECOIL_DETAILED_TRACY_ZONE;
 	std::vector<int> xend(doubleRadius + 1);
@@ -171,329 +266,99 @@ void CResourceMapAnalyzer::GetResourcePoints() {
 	if (totalResourcesDouble < 0.9)
 		return;
 
-	// Now work out how much resources each spot can make
-	// by adding up the resources from nearby spots
+	// Now work out how much resources each spot can make by adding up the
+	// resources from nearby spots; every row only depends on its first cell,
+	// so once the first column is known the rows can be summed in parallel
 	for (int y = 0; y < mapHeight; y++) {
-		for (int x = 0; x < mapWidth; x++) {
-			totalResources = 0;
-
-			// first spot needs full calculation
-			if (x == 0 && y == 0)
-				for (int sy = y - xtractorRadius, a = 0;  sy <= y + xtractorRadius;  sy++, a++) {
-					if (sy >= 0 && sy < mapHeight){
-						for (int sx = x - xend[a]; sx <= x + xend[a]; sx++) {
-							if (sx >= 0 && sx < mapWidth) {
-								// get the resources from all pixels around the extractor radius
-								totalResources += rexArrayA[sy * mapWidth + sx];
-							}
-						}
-					}
-				}
-
-			// quick calc test
-			if (x > 0) {
-				totalResources = tempAverage[y * mapWidth + x - 1];
-				for (int sy = y - xtractorRadius, a = 0;  sy <= y + xtractorRadius;  sy++, a++) {
-					if (sy >= 0 && sy < mapHeight) {
-						const int addX = x + xend[a];
-						const int remX = x - xend[a] - 1;
-
-						if (addX < mapWidth) {
-							totalResources += rexArrayA[sy * mapWidth + addX];
-						}
-						if (remX >= 0) {
-							totalResources -= rexArrayA[sy * mapWidth + remX];
-						}
-					}
-				}
-			} else if (y > 0) {
-				// x == 0 here
-				totalResources = tempAverage[(y - 1) * mapWidth];
-				// remove the top half
-				int a = xtractorRadius;
-
-				for (int sx = 0; sx <= xtractorRadius;  sx++, a++) {
-					if (sx < mapWidth) {
-						const int remY = y - xend[a] - 1;
-
-						if (remY >= 0) {
-							totalResources -= rexArrayA[remY * mapWidth + sx];
-						}
-					}
-				}
-
-				// add the bottom half
-				a = xtractorRadius;
+		tempAverage[y * mapWidth] = CalcSpotResources(0, y, xend);
+	}
 
-				for (int sx = 0; sx <= xtractorRadius;  sx++, a++) {
-					if (sx < mapWidth) {
-						const int addY = y + xend[a];
+	for_mt(0, mapHeight, [&](const int y) {
+		for (int x = 1; x < mapWidth; x++) {
+			tempAverage[y * mapWidth + x] = CalcSpotResources(x, y, xend);
+		}
+	});
 
-						if (addY < mapHeight) {
-							totalResources += rexArrayA[addY * mapWidth + sx];
-						}
-					}
-				}
-			}
+	// find the spot with the highest resource value to set as the map's max
+	maxResource = std::max(maxResource, *std::max_element(tempAverage.begin(), tempAverage.end()));
 
-			// set that spot's resource making ability
-			// (divide by cells to values are small)
-			tempAverage[y * mapWidth + x] = totalResources;
+	// min-heap on (-value, index): pops the highest value first and the lowest
+	// index among equal values, which is the order the spots were picked in
+	// by the old repeated full-map scans (values never increase, so an entry
+	// is stale iff its value no longer matches rexArrayB)
+	typedef std::pair<int, int> SpotEntry;
+	std::vector<SpotEntry> spotHeap;
 
-			if (maxResource < totalResources) {
-				// find the spot with the highest resource value to set as the map's max
-				maxResource = totalResources;
-			}
-		}
-	}
+	const auto PushSpot = [&](int index) {
+		if (rexArrayB[index] < minIncomeForSpot)
+			return;
 
-	// make a list for the distribution of values
-	std::vector<int> valueDist(256, 0);
+		spotHeap.emplace_back(-rexArrayB[index], index);
+		std::push_heap(spotHeap.begin(), spotHeap.end(), std::greater<SpotEntry>());
+	};
 
-	// this will get the total resources a rex placed at each spot would make
 	for (int i = 0; i < totalCells; i++) {
 		// scale the resources so any map will have values 0-255,
 		// no matter how much resources it has
 		rexArrayB[i] = tempAverage[i] * 255 / maxResource;
-		// clear out the array since it has never been used
-		rexArrayC[i] = 0;
 
-		int value = rexArrayB[i];
-		valueDist[value]++;
+		if (rexArrayB[i] >= minIncomeForSpot)
+			spotHeap.emplace_back(-rexArrayB[i], i);
 	}
 
-	// find the current best value
-	int bestValue = 0;
-	int numberOfValues = 0;
-	int usedSpots = 0;
+	std::make_heap(spotHeap.begin(), spotHeap.end(), std::greater<SpotEntry>());
 
-	for (int i = 255; i >= 0; i--) {
-		if (valueDist[i] != 0) {
-			bestValue = i;
-			numberOfValues = valueDist[i];
-			break;
-		}
-	}
+	const CResourceDescription* resource = resourceHandler->GetResource(resourceId);
 
-	// make a list of the indexes of the best spots
-	// (make sure that the list wont be too big)
-	if (numberOfValues > 256) {
-		numberOfValues = 256;
-	}
+	while (!spotHeap.empty() && numSpotsFound < maxSpots) {
+		std::pop_heap(spotHeap.begin(), spotHeap.end(), std::greater<SpotEntry>());
 
-	std::vector<int> bestSpotList(numberOfValues);
+		const auto [negValue, spotIndex] = spotHeap.back();
+		spotHeap.pop_back();
 
-	for (int i = 0; i < totalCells; i++) {
-		if (rexArrayB[i] == bestValue) {
-			// add the index of this spot to the list
-			bestSpotList[usedSpots] = i;
-			usedSpots++;
-
-			if (usedSpots == numberOfValues) {
-				// the list is filled, stop the loop
-				usedSpots = 0;
-				break;
-			}
-		}
-	}
+		if (rexArrayB[spotIndex] != -negValue)
+			continue;
 
-	for (int a = 0; a < maxSpots; a++) {
-		if (!stopMe) {
-			// reset temporary resources so it can find new spots
-			tempResources = 0;
-			// take the first spot
-			int speedTempResources_x = 0;
-			int speedTempResources_y = 0;
-			int speedTempResources = 0;
-			bool found = false;
-
-			while (!found) {
-				if (usedSpots == numberOfValues) {
-					// the list is empty now, refill it
-
-					// make a list of all the best spots
-					for (int i = 0; i < 256; i++) {
-						// clear the array
-						valueDist[i] = 0;
-					}
-
-					// find the resource distribution
-					for (int i = 0; i < totalCells; i++) {
-						int value = rexArrayB[i];
-						valueDist[value]++;
-					}
-
-					// find the current best value
-					bestValue = 0;
-					numberOfValues = 0;
-					usedSpots = 0;
-
-					for (int i = 255; i >= 0; i--) {
-						if (valueDist[i] != 0) {
-							bestValue = i;
-							numberOfValues = valueDist[i];
-							break;
-						}
-					}
-
-					// make a list of the indexes of the best spots
-					// (make sure that the list wont be too big)
-					if (numberOfValues > 256) {
-						numberOfValues = 256;
-					}
-
-					bestSpotList.clear();
-					bestSpotList.resize(numberOfValues);
-
-					for (int i = 0; i < totalCells; i++) {
-						if (rexArrayB[i] == bestValue) {
-							// add the index of this spot to the list
-							bestSpotList[usedSpots] = i;
-							usedSpots++;
-
-							if (usedSpots == numberOfValues) {
-								// the list is filled, stop the loop
-								usedSpots = 0;
-								break;
-							}
-						}
-					}
-				}
+		const int spotResources = -negValue;
+		const int coordX = spotIndex % mapWidth;
+		const int coordZ = spotIndex / mapWidth;
 
-				// The list is not empty now.
-				int spotIndex = bestSpotList[usedSpots];
+		// format resource coords to game-coords
+		float3 spot;
+		spot.x = coordX * (SQUARE_SIZE * 2) + SQUARE_SIZE;
+		spot.z = coordZ * (SQUARE_SIZE * 2) + SQUARE_SIZE;
+		// gets the actual amount of resource an extractor can make
+		spot.y = spotResources * (resource->maxWorth) * maxResource / 255;
 
-				if (rexArrayB[spotIndex] == bestValue) {
-					// the spot is still valid, so use it
-					speedTempResources_x = spotIndex % mapWidth;
-					speedTempResources_y = spotIndex / mapWidth;
-					speedTempResources = bestValue;
-					found = true;
-				}
+		vectoredSpots.push_back(spot);
+		numSpotsFound += 1;
 
-				// update the bestSpotList index
-				usedSpots++;
-			}
+		// wipes the resources around the spot so it is not counted twice
+		for (int sy = coordZ - xtractorRadius, a = 0;  sy <= coordZ + xtractorRadius;  sy++, a++) {
+			if (sy < 0 || sy >= mapHeight)
+				continue;
 
-			coordX = speedTempResources_x;
-			coordZ = speedTempResources_y;
-			tempResources = speedTempResources;
-		}
+			const int clearXStart = std::max(coordX - xend[a], 0);
+			const int clearXEnd = std::min(coordX + xend[a], mapWidth - 1);
 
-		if (tempResources < minIncomeForSpot) {
-			// if the spots get too crappy it will stop running the loops to speed it all up
-			stopMe = true;
+			for (int xClear = clearXStart; xClear <= clearXEnd; xClear++) {
+				rexArrayA[sy * mapWidth + xClear] = 0;
+				rexArrayB[sy * mapWidth + xClear] = 0;
+				tempAverage[sy * mapWidth + xClear] = 0;
+			}
 		}
 
-		if (!stopMe) {
-			// format resource coords to game-coords
-			bufferSpot.x = coordX * (SQUARE_SIZE * 2) + SQUARE_SIZE;
-			bufferSpot.z = coordZ * (SQUARE_SIZE * 2) + SQUARE_SIZE;
-			// gets the actual amount of resource an extractor can make
-			const CResourceDescription* resource = resourceHandler->GetResource(resourceId);
-			bufferSpot.y = tempResources * (resource->maxWorth) * maxResource / 255;
-			vectoredSpots.push_back(bufferSpot);
-
-			// plot TGA array (not necessary) for debug
-			rexArrayC[coordZ * mapWidth + coordX] = tempResources;
-			numSpotsFound += 1;
-
-			// small speedup of "wipes the resources around the spot so it is not counted twice"
-			for (int sy = coordZ - xtractorRadius, a = 0;  sy <= coordZ + xtractorRadius;  sy++, a++) {
-				if (sy >= 0 && sy < mapHeight) {
-					int clearXStart = coordX - xend[a];
-					int clearXEnd = coordX + xend[a];
-
-					if (clearXStart < 0) {
-						clearXStart = 0;
-					}
-					if (clearXEnd >= mapWidth) {
-						clearXEnd = mapWidth - 1;
-					}
-
-					for (int xClear = clearXStart; xClear <= clearXEnd; xClear++) {
-						// wipes the resources around the spot so it is not counted twice
-						rexArrayA[sy * mapWidth + xClear] = 0;
-						rexArrayB[sy * mapWidth + xClear] = 0;
-						tempAverage[sy * mapWidth + xClear] = 0;
-					}
-				}
-			}
+		// redo the whole averaging process around the picked spot so other spots can be found around it
+		for (int y = std::max(coordZ - doubleRadius, 0); y <= std::min(coordZ + doubleRadius, mapHeight - 1); y++) {
+			for (int x = std::max(coordX - doubleRadius, 0); x <= std::min(coordX + doubleRadius, mapWidth - 1); x++) {
+				const int index = y * mapWidth + x;
+				const int value = (tempAverage[index] = CalcSpotResources(x, y, xend)) * 255 / maxResource;
 
-			// redo the whole averaging process around the picked spot so other spots can be found around it
-			for (int y = coordZ - doubleRadius; y <= coordZ + doubleRadius; y++) {
-				if (y >=0 && y < mapHeight) {
-					for (int x = coordX - doubleRadius; x <= coordX + doubleRadius; x++) {
-						if (x >=0 && x < mapWidth) {
-							totalResources = 0;
-
-							// comment out for debug
-							if (x == 0 && y == 0) {
-								for (int sy = y - xtractorRadius, a = 0;  sy <= y + xtractorRadius;  sy++, a++) {
-									if (sy >= 0 && sy < mapHeight) {
-										for (int sx = x - xend[a]; sx <= x + xend[a]; sx++) {
-											if (sx >= 0 && sx < mapWidth) {
-												// get the resources from all pixels around the extractor radius
-												totalResources += rexArrayA[sy * mapWidth + sx];
-											}
-										}
-									}
-								}
-							}
-
-							// quick calc test
-							if (x > 0) {
-								totalResources = tempAverage[y * mapWidth + x - 1];
-
-								for (int sy = y - xtractorRadius, a = 0;  sy <= y + xtractorRadius;  sy++, a++) {
-									if (sy >= 0 && sy < mapHeight) {
-										int addX = x + xend[a];
-										int remX = x - xend[a] - 1;
-
-										if (addX < mapWidth) {
-											totalResources += rexArrayA[sy * mapWidth + addX];
-										}
-										if (remX >= 0) {
-											totalResources -= rexArrayA[sy * mapWidth + remX];
-										}
-									}
-								}
-							} else if (y > 0) {
-								// x == 0 here
-								totalResources = tempAverage[(y - 1) * mapWidth];
-								// remove the top half
-								int a = xtractorRadius;
-
-								for (int sx = 0; sx <= xtractorRadius;  sx++, a++) {
-									if (sx < mapWidth) {
-										int remY = y - xend[a] - 1;
-
-										if (remY >= 0) {
-											totalResources -= rexArrayA[remY * mapWidth + sx];
-										}
-									}
-								}
-
-								// add the bottom half
-								a = xtractorRadius;
-
-								for (int sx = 0; sx <= xtractorRadius;  sx++, a++) {
-									if (sx < mapWidth) {
-										int addY = y + xend[a];
-
-										if (addY < mapHeight) {
-											totalResources += rexArrayA[addY * mapWidth + sx];
-										}
-									}
-								}
-							}
-
-							tempAverage[y * mapWidth + x] = totalResources;
-							// set that spot's resource amount
-							rexArrayB[y * mapWidth + x] = totalResources * 255 / maxResource;
-						}
-					}
-				}
+				if (value == rexArrayB[index])
+					continue;
+
+				rexArrayB[index] = value;
+				PushSpot(index);
 			}
 		}
 	}
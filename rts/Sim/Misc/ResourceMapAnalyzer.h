@@ -34,6 +34,7 @@ public:
 
 private:
 	void GetResourcePoints();
+	int CalcSpotResources(int x, int y, const std::vector<int>& xend) const;
 	void SaveResourceMap();
 	bool LoadResourceMap();
 
@@ -45,8 +46,6 @@ private:
 	float extractorRadius;
 	float averageIncome;
 
-	bool stopMe;
-
 	// if more spots than this are found the map is considered a resource-map (eg. speed-metal), tweak as needed
 	int maxSpots;
 	int mapHeight;
@@ -54,11 +53,7 @@ private:
 	int totalCells;
 	int squareRadius;
 	int doubleSquareRadius;
-	int totalResources;
 	int maxResource;
-	int tempResources;
-	int coordX;
-	int coordZ;
 	// from 0-255, the minimum percentage of resources a spot needs to have from
 	// the maximum to be saved, prevents crappier spots in between taken spaces
 	// (they are still perfectly valid and will generate resources mind you!)
@@ -66,11 +61,8 @@ private:
 	int xtractorRadius;
 	int doubleRadius;
 
-	float3 bufferSpot;
-
 	std::vector<unsigned char> rexArrayA;
 	std::vector<unsigned char> rexArrayB;
-	std::vector<unsigned char> rexArrayC;
 	std::vector<int> tempAverage;
 
 	std::vector<float3> vectoredSpots;
@@ -74,8 +74,6 @@ CTeam::CTeam():
 	nextHistoryEntry(0),
 	highlight(0.0f)
 {
-	statHistory.reserve(1024);
-	statHistory.push_back(TeamStatistics());
 }
 
 void CTeam::SetDefaultStartPos()
@@ -415,7 +413,7 @@ void CTeam::SlowUpdate()
 
 	if (nextHistoryEntry <= gs->frameNum) {
 		currentStats.frame = gs->frameNum;
-		statHistory.push_back(currentStats);
+		statHistory.Commit();
 
 		nextHistoryEntry = gs->frameNum + (TeamStatistics::statsPeriod * GAME_SPEED);
 		GetCurrentStats().frame = nextHistoryEntry;
@@ -94,7 +94,7 @@ public:
 	SResourcePack resPrevExcess;
 
 	int nextHistoryEntry;
-	std::vector<TeamStatistics> statHistory;
+	CTeamStatisticsHistory statHistory;
 
 	/// mod controlled parameters
 	LuaRulesParams::Params  modParams;
@@ -5,6 +5,10 @@
 #include "System/Platform/byteorder.h"
 
 
+static constexpr size_t NUM_ENTRY_WORDS = sizeof(TeamStatistics) / sizeof(uint32_t);
+static_assert((NUM_ENTRY_WORDS * sizeof(uint32_t)) == sizeof(TeamStatistics));
+
+
 CR_BIND(TeamStatistics, )
 CR_REG_METADATA(TeamStatistics, (
 	CR_MEMBER(frame),
@@ -81,3 +85,78 @@ void TeamStatistics::swab()
 	swabDWordInPlace(unitsKilled);
 }
 
+
+
+
+CR_BIND(CTeamStatisticsHistory, )
+CR_REG_METADATA(CTeamStatisticsHistory, (
+	CR_MEMBER(current),
+	CR_MEMBER(lastCommitted),
+	CR_MEMBER(encodedEntries),
+	CR_MEMBER(keyEntryOffsets),
+	CR_MEMBER(numEntries)
+))
+
+void CTeamStatisticsHistory::Commit()
+{
+	if ((numEntries % KEY_ENTRY_INTERVAL) == 0) {
+		keyEntryOffsets.push_back(static_cast<uint32_t>(encodedEntries.size()));
+		lastCommitted = TeamStatistics();
+	}
+
+	uint32_t curWords[NUM_ENTRY_WORDS];
+	uint32_t refWords[NUM_ENTRY_WORDS];
+
+	// floats are delta'ed as raw bits, which keeps the encoding lossless
+	std::memcpy(curWords, &current, sizeof(current));
+	std::memcpy(refWords, &lastCommitted, sizeof(lastCommitted));
+
+	for (size_t i = 0; i < NUM_ENTRY_WORDS; i++) {
+		const uint32_t delta = curWords[i] - refWords[i];
+
+		// zigzag, so small negative deltas also take few bytes
+		uint32_t value = (delta << 1) ^ static_cast<uint32_t>(static_cast<int32_t>(delta) >> 31);
+
+		do {
+			const uint8_t byte = value & 0x7F;
+			value >>= 7;
+			encodedEntries.push_back(byte | ((value != 0) << 7));
+		} while (value != 0);
+	}
+
+	lastCommitted = current;
+	numEntries++;
+}
+
+size_t CTeamStatisticsHistory::DecodeEntry(size_t index, size_t offset, TeamStatistics& entry) const
+{
+	if ((index % KEY_ENTRY_INTERVAL) == 0)
+		entry = TeamStatistics();
+
+	uint32_t words[NUM_ENTRY_WORDS];
+	std::memcpy(words, &entry, sizeof(entry));
+
+	for (size_t i = 0; i < NUM_ENTRY_WORDS; i++) {
+		uint32_t value = 0;
+
+		for (uint32_t shift = 0; ; shift += 7) {
+			const uint8_t byte = encodedEntries[offset++];
+			value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+
+			if ((byte & 0x80) == 0)
+				break;
+		}
+
+		words[i] += (value >> 1) ^ (0u - (value & 1));
+	}
+
+	std::memcpy(&entry, words, sizeof(entry));
+	return offset;
+}
+
+TeamStatistics CTeamStatisticsHistory::Get(size_t index) const
+{
+	TeamStatistics entry;
+	ForEach(index, index + 1, [&](size_t, const TeamStatistics& stats) { entry = stats; });
+	return entry;
+}
@@ -6,7 +6,10 @@
 #include "System/creg/creg_cond.h"
 #include "System/Platform/byteorder.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <cstring>
+#include <vector>
 
 #pragma pack(push, 1)
 
@@ -46,4 +49,76 @@ struct TeamStatistics
 
 #pragma pack(pop)
 
+
+/**
+ * Statistics history of a team: one finished entry per statsPeriod, plus
+ * the entry that is still being accumulated (back()).
+ *
+ * Finished entries are kept losslessly as zigzag-varint encoded per-field
+ * deltas to their predecessor; most fields grow slowly or not at all from
+ * one entry to the next, so an entry usually takes a fraction of the raw
+ * struct. Every KEY_ENTRY_INTERVAL'th entry is encoded against zero, which
+ * lets ForEach start decoding close to the first requested entry.
+ */
+class CTeamStatisticsHistory
+{
+	CR_DECLARE_STRUCT(CTeamStatisticsHistory)
+
+public:
+	static constexpr size_t KEY_ENTRY_INTERVAL = 64;
+
+	/// number of entries, including the one being accumulated
+	size_t size() const { return (numEntries + 1); }
+
+	const TeamStatistics& back() const { return current; }
+	      TeamStatistics& back()       { return current; }
+
+	/// appends a copy of back() to the finished entries, back() keeps accumulating
+	void Commit();
+
+	TeamStatistics Get(size_t index) const;
+
+	/// calls func(index, entry) for every entry in [begin, end) without decoding the whole history
+	template<typename F>
+	void ForEach(size_t begin, size_t end, F&& func) const {
+		end = std::min(end, size());
+
+		if (begin >= end)
+			return;
+
+		if (begin < numEntries) {
+			TeamStatistics entry;
+
+			size_t index = begin - (begin % KEY_ENTRY_INTERVAL);
+			size_t offset = keyEntryOffsets[index / KEY_ENTRY_INTERVAL];
+
+			for (const size_t last = std::min<size_t>(end, numEntries); index < last; index++) {
+				offset = DecodeEntry(index, offset, entry);
+
+				if (index >= begin)
+					func(index, static_cast<const TeamStatistics&>(entry));
+			}
+		}
+
+		if (end > numEntries)
+			func(static_cast<size_t>(numEntries), current);
+	}
+
+	/// bytes taken by the finished entries
+	size_t GetEncodedSize() const { return encodedEntries.size(); }
+
+private:
+	size_t DecodeEntry(size_t index, size_t offset, TeamStatistics& entry) const;
+
+private:
+	TeamStatistics current;
+	/// reference for encoding the next finished entry
+	TeamStatistics lastCommitted;
+
+	std::vector<uint8_t> encodedEntries;
+	std::vector<uint32_t> keyEntryOffsets;
+
+	uint32_t numEntries = 0;
+};
+
 #endif
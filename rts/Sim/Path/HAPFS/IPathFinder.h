@@ -3,6 +3,7 @@
 #ifndef HAPFS_IPATH_FINDER_H
 #define HAPFS_IPATH_FINDER_H
 
+#include <cstdint>
 #include <cstdlib>
 
 #include "IPath.h"
@@ -148,6 +149,9 @@ public:
 	unsigned int maxBlocksToBeSearched = 0;
 	unsigned int testedBlocks = 0;
 
+	// blocks taken off the open queue over all searches, never reset
+	std::uint64_t searchedBlocks = 0;
+
 	unsigned int instanceIndex = 0;
 
 	PathNodeBuffer openBlockBuffer;
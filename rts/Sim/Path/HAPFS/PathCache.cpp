@@ -119,6 +119,21 @@ const CPathCache::CacheItem& CPathCache::GetCachedPath(
 	return dummyCacheItem;
 }
 
+size_t CPathCache::GetMemFootPrint() const
+{
+	size_t memFootPrint = sizeof(CPathCache);
+
+	memFootPrint += cacheQue.size() * sizeof(decltype(cacheQue)::value_type);
+	memFootPrint += cachedPaths.size() * sizeof(decltype(cachedPaths)::value_type);
+
+	for (const auto& item: cachedPaths) {
+		memFootPrint += item.second.path.path.size() * sizeof(float3);
+		memFootPrint += item.second.path.squares.size() * sizeof(int2);
+	}
+
+	return memFootPrint;
+}
+
 void CPathCache::Update()
 {
 	RECOIL_DETAILED_TRACY_ZONE;
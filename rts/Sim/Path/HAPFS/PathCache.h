@@ -44,6 +44,8 @@ public:
 		int pathType
 	);
 
+	size_t GetMemFootPrint() const;
+
 private:
 	void RemoveFrontQueItem();
 
@@ -276,6 +276,7 @@ IPath::SearchResult CPathEstimator::DoSearch(const MoveDef& moveDef, const CPath
 		// get the open block with lowest cost
 		const PathNode* ob = openBlocks.top();
 		openBlocks.pop();
+		searchedBlocks++;
 
 		// check if the block has been marked as unaccessible during its time in the queue
 		if (blockStates.nodeMask[ob->nodeNum] & (PATHOPT_BLOCKED | PATHOPT_CLOSED))
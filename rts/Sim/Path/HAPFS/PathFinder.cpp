@@ -173,6 +173,7 @@ IPath::SearchResult CPathFinder::DoSearch(
 		// get the open square with lowest expected path-cost
 		const PathNode* openSquare = openBlocks.top();
 		openBlocks.pop();
+		searchedBlocks++;
 
 		// if (TEST_ACTIVE){
 		// 	LOG("TK CPathFinder::DoSearch - iterate (%d, %d : %f) (nCount %d) "
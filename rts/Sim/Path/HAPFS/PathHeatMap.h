@@ -44,6 +44,10 @@ public:
 
 	float GetHeatCost(unsigned int x, unsigned int z, const MoveDef&, unsigned int ownerID) const;
 
+	size_t GetMemFootPrint() const {
+		return (heatMap.size() * sizeof(HeatCell) + pathSquares.size() * sizeof(int2));
+	}
+
 private:
 	struct HeatCell {
 		unsigned int value = 0;
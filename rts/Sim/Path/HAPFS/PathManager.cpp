@@ -17,6 +17,7 @@
 #include "Sim/Misc/ModInfo.h"
 #include "Sim/Objects/SolidObject.h"
 #include "Sim/MoveTypes/MoveDefHandler.h"
+#include "Sim/Path/PathTrace.h"
 #include "System/Log/ILog.h"
 #include "System/TimeProfiler.h"
 #include "System/Threading/ThreadPool.h"
@@ -405,6 +406,9 @@ IPath::SearchResult CPathManager::ArrangePath(
 void CPathManager::DeletePath(unsigned int pathID, bool /* force ignored*/) {
 	if (pathID == 0)
 		return;
+
+	if (pathTraceRecorder.IsEnabled())
+		pathTraceRecorder.DeletePath(pathID);
 	{
 		RECOIL_DETAILED_TRACY_ZONE;
 		const std::lock_guard<std::mutex> lock(pathMapUpdate); // TODO: remove this? not called in MT sections anymore?
@@ -475,6 +479,9 @@ unsigned int CPathManager::RequestPath(
 		pathId = Store(newPath);
 	}
 
+	if (pathTraceRecorder.IsEnabled())
+		pathTraceRecorder.RequestPath(pathId, moveDef->pathType, startPos, goalPos, goalRadius, synced, immediateResult);
+
 	return pathId;
 }
 
@@ -595,6 +602,10 @@ float3 CPathManager::NextWayPoint(
 	if (pathID == 0)
 		return noPathPoint;
 
+	// retries are internal and will be redone during replay
+	if (pathTraceRecorder.IsEnabled() && numRetries == 0)
+		pathTraceRecorder.NextWayPoint(pathID, callerPos, radius, synced);
+
 	// find corresponding multipath entry
 	MultiPath localMultiPath = GetMultiPathMT(pathID);
 
@@ -762,10 +773,13 @@ CPathManager::MultiPath CPathManager::ExpandCurrentPath(
 
 
 // Tells estimators about changes in or on the map.
-void CPathManager::TerrainChange(unsigned int x1, unsigned int z1, unsigned int x2, unsigned int z2, unsigned int /*type*/) {
+void CPathManager::TerrainChange(unsigned int x1, unsigned int z1, unsigned int x2, unsigned int z2, unsigned int type) {
 	RECOIL_DETAILED_TRACY_ZONE;
 	if (!IsFinalized())
 		return;
+
+	if (pathTraceRecorder.IsEnabled())
+		pathTraceRecorder.TerrainChange(x1, z1, x2, z2, type);
 		
 	auto medResPE = &pathingStates[PATH_MED_RES];
 	auto lowResPE = &pathingStates[PATH_LOW_RES];
@@ -1061,6 +1075,41 @@ const float* CPathManager::GetNodeExtraCosts(bool synced) const {
 	return costs;
 }
 
+std::uint64_t CPathManager::GetMemFootPrint() const {
+	RECOIL_DETAILED_TRACY_ZONE;
+	std::uint64_t memFootPrint = sizeof(CPathManager);
+
+	memFootPrint += pathFinders.size() * sizeof(decltype(pathFinders)::value_type);
+	memFootPrint += pathMap.size() * sizeof(decltype(pathMap)::value_type);
+
+	// the per-thread estimators and finders, their states are not shared
+	for (const IPathFinder* pf: pathFinders) {
+		memFootPrint += pf->GetMemFootPrint();
+	}
+
+	if (IsFinalized()) {
+		for (const PathingState& ps: pathingStates) {
+			memFootPrint += ps.GetMemFootPrint();
+		}
+	}
+
+	memFootPrint += pathHeatMap->GetMemFootPrint();
+
+	// convert to megabytes
+	return (memFootPrint / (1024 * 1024));
+}
+
+std::uint64_t CPathManager::GetNumNodesSearched() const {
+	std::uint64_t numNodesSearched = 0;
+
+	// only read outside of MT sections, no search is writing to these
+	for (const IPathFinder* pf: pathFinders) {
+		numNodesSearched += pf->searchedBlocks;
+	}
+
+	return numNodesSearched;
+}
+
 int2 CPathManager::GetNumQueuedUpdates() const {
 	RECOIL_DETAILED_TRACY_ZONE;
 	int2 data;
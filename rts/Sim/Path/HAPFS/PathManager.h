@@ -178,6 +178,9 @@ public:
 
 	int2 GetNumQueuedUpdates() const override;
 
+	std::uint64_t GetMemFootPrint() const override;
+	std::uint64_t GetNumNodesSearched() const override;
+
 	const CPathFinder* GetMaxResPF() const;
 	const CPathEstimator* GetMedResPE() const;
 	const CPathEstimator* GetLowResPE() const;
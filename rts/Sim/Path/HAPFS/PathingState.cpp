@@ -26,6 +26,7 @@
 #include "System/FileSystem/DataDirsAccess.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/FileSystem/FileQueryFlags.h"
+#include "System/MathConstants.h"
 #include "System/Platform/Threading.h"
 #include "System/StringUtil.h"
 #include "System/Threading/ThreadPool.h" // for_mt
@@ -97,6 +98,7 @@ void PathingState::Init(std::vector<IPathFinder*> pathFinderlist, PathingState*
 	{
 		RECOIL_DETAILED_TRACY_ZONE;
 		pathFinders = pathFinderlist;
+		useVertexSweep = (!pathFinders.empty() && pathFinders[0]->GetBlockSize() == 1);
 		BLOCKS_TO_UPDATE = (SQUARES_TO_UPDATE) / (BLOCK_SIZE * BLOCK_SIZE) + 1;
 
 		blockUpdatePenalty = 0;
@@ -117,6 +119,9 @@ void PathingState::Init(std::vector<IPathFinder*> pathFinderlist, PathingState*
 		updatedBlocks.clear();
 		consumedBlocks.clear();
 		offsetBlocksSortedByCost.clear();
+
+		sweepBuffers.clear();
+		sweepBuffers.resize(pathFinders.size());
 	}
 
 	PathingState*  childPE = this;
@@ -397,6 +402,13 @@ void PathingState::CalcVertexPathCosts(const MoveDef& moveDef, int2 block, unsig
 	const uint8_t nodeLinksObsoleteFlags = blockStates.nodeLinksObsoleteFlags[idx]
 								  		 & (moveDef.allowDirectionalPathing) ? PATH_DIRECTIONS_MASK : PATH_DIRECTIONS_HALF_MASK;
 
+	// directional speedmods make costs depend on the direction squares are
+	// entered from, which the sweep does not model; use per-edge searches
+	if (useVertexSweep && !moveDef.allowDirectionalPathing) {
+		CalcVertexPathCostsSweep(moveDef, block, nodeLinksObsoleteFlags, threadNum);
+		return;
+	}
+
 	int pathdir = 0;
 	for (int checkBit = 1; checkBit <= PATHDIR_LEFT_DOWN_MASK; checkBit <<= 1, ++pathdir) {
 		if (nodeLinksObsoleteFlags & checkBit)
@@ -489,6 +501,210 @@ void PathingState::CalcVertexPathCost(
 }
 
 
+/**
+ * Batched CalcVertexPathCost for estimators whose helpers are max-res PF's.
+ *
+ * Instead of one constrained A* search per (parent, child) edge, this runs a
+ * single Dijkstra sweep from the parent's offset square over the parent and
+ * its eight neighbour blocks, then reads the cost of every requested vertex
+ * off the result. Each square's passability, speedmod and extra cost is only
+ * evaluated once per sweep rather than once per search that touches it.
+ *
+ * Uses the PF's cost model (node spacing, positional speedmods, extra costs,
+ * exit-only squares, no diagonal moves past impassable squares) and returns
+ * the same g+h the PF reports on reaching the goal radius. Paths are however
+ * no longer confined to the two blocks an edge connects, so costs can differ
+ * from CalcVertexPathCost (see PATHESTIMATOR_VERSION).
+ */
+void PathingState::CalcVertexPathCostsSweep(
+	const MoveDef& moveDef,
+	int2 parentBlockPos,
+	unsigned int pathDirMask,
+	unsigned int threadNum
+) {
+	RECOIL_DETAILED_TRACY_ZONE;
+	enum {
+		SWEEP_NODE_KNOWN    = 1 << 0,
+		SWEEP_NODE_PASSABLE = 1 << 1,
+		SWEEP_NODE_EXITONLY = 1 << 2,
+		SWEEP_NODE_CLOSED   = 1 << 3,
+	};
+
+	struct SweepGoal {
+		int2 square;
+		unsigned int pathDir;
+		float cost;
+	};
+
+	const unsigned int parentBlockIdx = BlockPosToIdx(parentBlockPos);
+	const unsigned int vertexCostIdx =
+		moveDef.pathType * mapBlockCount * PATH_DIRECTION_VERTICES +
+		parentBlockIdx * PATH_DIRECTION_VERTICES;
+
+	const int2 parentSquare = blockStates.peNodeOffsets[moveDef.pathType][parentBlockIdx];
+
+	// same early-outs as CalcVertexPathCost; blocked starts and goals are never searched
+	const bool strtBlocked = ((CMoveMath::IsBlocked(moveDef, SquareToFloat3(parentSquare.x, parentSquare.y), nullptr, threadNum) & CMoveMath::BLOCK_STRUCTURE) != 0);
+
+	std::array<SweepGoal, PATH_DIRECTIONS> goals;
+	size_t numGoals = 0;
+
+	for (unsigned int pathDir = 0; pathDir < PATH_DIRECTIONS; pathDir++) {
+		if ((pathDirMask & (1 << pathDir)) == 0)
+			continue;
+
+		vertexCosts[vertexCostIdx + pathDir] = PATHCOST_INFINITY;
+
+		const int2 childBlockPos = parentBlockPos + PE_DIRECTION_VECTORS[pathDir];
+
+		if ((unsigned)childBlockPos.x >= mapDimensionsInBlocks.x || (unsigned)childBlockPos.y >= mapDimensionsInBlocks.y)
+			continue;
+		if (strtBlocked)
+			continue;
+
+		const int2 childSquare = blockStates.peNodeOffsets[moveDef.pathType][BlockPosToIdx(childBlockPos)];
+
+		if ((CMoveMath::IsBlocked(moveDef, SquareToFloat3(childSquare.x, childSquare.y), nullptr, threadNum) & CMoveMath::BLOCK_STRUCTURE) != 0)
+			continue;
+
+		goals[numGoals++] = {childSquare, pathDir, PATHCOST_INFINITY};
+	}
+
+	if (numGoals == 0)
+		return;
+
+	// squares within the parent and neighbour blocks are expanded; those in
+	// the margin around them can only be reached, like the squares outside
+	// of a PF's search constraint
+	const int2 innerMin = {int((parentBlockPos.x - 1) * BLOCK_SIZE), int((parentBlockPos.y - 1) * BLOCK_SIZE)};
+	const int2 innerMax = {int((parentBlockPos.x + 2) * BLOCK_SIZE), int((parentBlockPos.y + 2) * BLOCK_SIZE)};
+	const int2 sweepMin = {std::max(innerMin.x - int(PATH_NODE_SPACING), 0), std::max(innerMin.y - int(PATH_NODE_SPACING), 0)};
+	const int2 sweepMax = {std::min(innerMax.x + int(PATH_NODE_SPACING), mapDims.mapx), std::min(innerMax.y + int(PATH_NODE_SPACING), mapDims.mapy)};
+	const int2 sweepDims = sweepMax - sweepMin;
+
+	SVertexSweepBuffer& sb = sweepBuffers[threadNum];
+	sb.Reset(sweepDims.x * sweepDims.y);
+
+	const PathNodeStateBuffer& pfBlockStates = pathFinders[threadNum]->GetNodeStateBuffer();
+
+	const auto SquareIdx = [&](int2 sqr) { return ((sqr.y - sweepMin.y) * sweepDims.x + (sqr.x - sweepMin.x)); };
+	const auto InSweep = [&](int2 sqr) { return (sqr.x >= sweepMin.x && sqr.x < sweepMax.x && sqr.y >= sweepMin.y && sqr.y < sweepMax.y); };
+	const auto InInner = [&](int2 sqr) { return (sqr.x >= innerMin.x && sqr.x < innerMax.x && sqr.y >= innerMin.y && sqr.y < innerMax.y); };
+	const auto OpenCmp = [](const std::pair<float, unsigned int>& a, const std::pair<float, unsigned int>& b) { return (a.first > b.first); };
+
+	// evaluated on first contact; most sweeps stop before covering all squares
+	const auto GetSquareFlags = [&](int2 sqr) -> std::uint8_t {
+		const unsigned int sqrIdx = SquareIdx(sqr);
+
+		if ((sb.nodeFlags[sqrIdx] & SWEEP_NODE_KNOWN) != 0)
+			return sb.nodeFlags[sqrIdx];
+
+		std::uint8_t flags = SWEEP_NODE_KNOWN;
+
+		if (!CMoveMath::IsBlockedStructure(moveDef, sqr.x, sqr.y, nullptr, threadNum)) {
+			if ((sb.speedMods[sqrIdx] = CMoveMath::GetPosSpeedMod(moveDef, sqr.x, sqr.y)) != 0.0f) {
+				sb.extraCosts[sqrIdx] = pfBlockStates.GetNodeExtraCost(sqr.x, sqr.y, true);
+				flags |= SWEEP_NODE_PASSABLE;
+			}
+		}
+
+		if (moveDef.IsInExitOnly(sqr.x, sqr.y))
+			flags |= SWEEP_NODE_EXITONLY;
+
+		return (sb.nodeFlags[sqrIdx] = flags);
+	};
+
+	// octile distance in nodes, as CPathFinderDef::Heuristic
+	const auto Heuristic = [](int2 src, int2 tgt) {
+		constexpr float C1 = (1.0f    / PATH_NODE_SPACING);
+		constexpr float C2 = (1.4142f / PATH_NODE_SPACING) - (2.0f * C1);
+
+		const float dx = std::abs(src.x - tgt.x);
+		const float dz = std::abs(src.y - tgt.y);
+
+		return ((dx + dz) * C1 + std::min(dx, dz) * C2);
+	};
+
+	GetSquareFlags(parentSquare);
+
+	sb.gCosts[SquareIdx(parentSquare)] = 0.0f;
+	sb.openNodes.emplace_back(0.0f, SquareIdx(parentSquare));
+
+	// no goal can improve once the cheapest open node costs more than all of them
+	float maxGoalCost = PATHCOST_INFINITY;
+
+	while (!sb.openNodes.empty()) {
+		std::pop_heap(sb.openNodes.begin(), sb.openNodes.end(), OpenCmp);
+
+		const auto [gCost, sqrIdx] = sb.openNodes.back();
+		sb.openNodes.pop_back();
+
+		if (gCost >= maxGoalCost)
+			break;
+		if ((sb.nodeFlags[sqrIdx] & SWEEP_NODE_CLOSED) != 0)
+			continue;
+
+		sb.nodeFlags[sqrIdx] |= SWEEP_NODE_CLOSED;
+
+		const int2 square = {int(sqrIdx % sweepDims.x) + sweepMin.x, int(sqrIdx / sweepDims.x) + sweepMin.y};
+
+		// all squares within the (2-square resolution) goal radius of a child count as reaching it
+		maxGoalCost = 0.0f;
+
+		for (size_t i = 0; i < numGoals; i++) {
+			SweepGoal& goal = goals[i];
+
+			if (std::abs(square.x - goal.square.x) <= 1 && std::abs(square.y - goal.square.y) <= 1)
+				goal.cost = std::min(goal.cost, gCost + Heuristic(square, goal.square));
+
+			maxGoalCost = std::max(maxGoalCost, goal.cost);
+		}
+
+		if (!InInner(square))
+			continue;
+
+		const bool exitOnly = ((sb.nodeFlags[sqrIdx] & SWEEP_NODE_EXITONLY) != 0);
+
+		std::array<std::uint8_t, PATH_DIRECTIONS> ngbFlags;
+
+		for (unsigned int dir = 0; dir < PATH_DIRECTIONS; dir++) {
+			const int2 ngbSquare = square + PF_DIRECTION_VECTORS_2D[PathDir2PathOpt(dir)];
+
+			ngbFlags[dir] = InSweep(ngbSquare)? GetSquareFlags(ngbSquare): 0;
+		}
+
+		for (unsigned int dir = 0; dir < PATH_DIRECTIONS; dir++) {
+			if ((ngbFlags[dir] & SWEEP_NODE_PASSABLE) == 0)
+				continue;
+
+			// odd PATHDIR's are diagonals, flanked by the two cardinals around them
+			const bool diagonal = ((dir & 1) != 0);
+
+			if (diagonal && ((ngbFlags[dir - 1] & ngbFlags[(dir + 1) % PATH_DIRECTIONS] & SWEEP_NODE_PASSABLE) == 0))
+				continue;
+
+			// exit-only squares can not be entered from outside
+			if (!exitOnly && (ngbFlags[dir] & SWEEP_NODE_EXITONLY) != 0)
+				continue;
+
+			const unsigned int ngbIdx = SquareIdx(square + PF_DIRECTION_VECTORS_2D[PathDir2PathOpt(dir)]);
+			const float dirMoveCost = diagonal? math::SQRT2: 1.0f;
+			const float ngbCost = gCost + (dirMoveCost / sb.speedMods[ngbIdx]) + sb.extraCosts[ngbIdx];
+
+			if (ngbCost >= sb.gCosts[ngbIdx])
+				continue;
+
+			sb.gCosts[ngbIdx] = ngbCost;
+			sb.openNodes.emplace_back(ngbCost, ngbIdx);
+			std::push_heap(sb.openNodes.begin(), sb.openNodes.end(), OpenCmp);
+		}
+	}
+
+	for (size_t i = 0; i < numGoals; i++) {
+		vertexCosts[vertexCostIdx + goals[i].pathDir] = goals[i].cost;
+	}
+}
+
 /**
  * Try to read offset and vertices data from file, return false on failure
  */
@@ -819,6 +1035,31 @@ void PathingState::MapChanged(unsigned int x1, unsigned int z1, unsigned int x2,
 }
 
 
+size_t PathingState::GetMemFootPrint() const
+{
+	size_t memFootPrint = blockStates.GetMemFootPrint();
+
+	memFootPrint += maxSpeedMods.size() * sizeof(decltype(maxSpeedMods)::value_type);
+	memFootPrint += vertexCosts.size() * sizeof(decltype(vertexCosts)::value_type);
+	memFootPrint += updatedBlocks.size() * sizeof(decltype(updatedBlocks)::value_type);
+	memFootPrint += consumedBlocks.size() * sizeof(decltype(consumedBlocks)::value_type);
+	memFootPrint += offsetBlocksSortedByCost.size() * sizeof(decltype(offsetBlocksSortedByCost)::value_type);
+
+	for (const SVertexSweepBuffer& buffer: sweepBuffers) {
+		memFootPrint += (buffer.gCosts.size() + buffer.speedMods.size() + buffer.extraCosts.size()) * sizeof(float);
+		memFootPrint += buffer.nodeFlags.size() * sizeof(std::uint8_t);
+		memFootPrint += buffer.openNodes.size() * sizeof(decltype(buffer.openNodes)::value_type);
+	}
+
+	for (const CPathCache* cache: pathCache) {
+		if (cache != nullptr)
+			memFootPrint += cache->GetMemFootPrint();
+	}
+
+	return memFootPrint;
+}
+
+
 std::uint32_t PathingState::CalcChecksum() const
 {
 	RECOIL_DETAILED_TRACY_ZONE;
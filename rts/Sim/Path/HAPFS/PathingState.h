@@ -5,6 +5,7 @@
 
 #include <atomic>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "IPathFinder.h"
@@ -53,6 +54,9 @@ public:
     int2 BlockIdxToPos(const unsigned idx) const { return int2(idx % mapDimensionsInBlocks.x, idx / mapDimensionsInBlocks.x); }
     int  BlockPosToIdx(const int2 pos) const { return (pos.y * mapDimensionsInBlocks.x + pos.x); }
 
+	/// size of the memory-region we hold allocated (excluding sizeof(*this))
+	size_t GetMemFootPrint() const;
+
 	std::uint32_t CalcChecksum() const;
 	std::uint32_t CalcHash(const char* caller) const;
 
@@ -137,6 +141,7 @@ private:
     int2 FindBlockPosOffset(const MoveDef&, unsigned int, unsigned int, int threadNum) const;
     void CalcVertexPathCosts(const MoveDef&, int2, unsigned int threadNum = 0);
     void CalcVertexPathCost(const MoveDef&, int2, unsigned int pathDir, unsigned int threadNum = 0);
+    void CalcVertexPathCostsSweep(const MoveDef&, int2, unsigned int pathDirMask, unsigned int threadNum = 0);
 
 	bool ReadFile(const std::string& peFileName, const std::string& mapFileName);
 	bool WriteFile(const std::string& peFileName, const std::string& mapFileName);
@@ -175,6 +180,28 @@ private:
 
     std::vector<IPathFinder*> pathFinders; // InitEstimator helpers
 
+	// per-thread scratch space for CalcVertexPathCostsSweep
+	struct SVertexSweepBuffer {
+		std::vector<float> gCosts;
+		std::vector<float> speedMods;
+		std::vector<float> extraCosts;
+		std::vector<std::uint8_t> nodeFlags;
+		std::vector<std::pair<float, unsigned int>> openNodes;
+
+		void Reset(size_t numNodes) {
+			gCosts.assign(numNodes, PATHCOST_INFINITY);
+			speedMods.resize(numNodes);
+			extraCosts.resize(numNodes);
+			nodeFlags.assign(numNodes, 0);
+			openNodes.clear();
+		}
+	};
+
+	std::vector<SVertexSweepBuffer> sweepBuffers;
+
+	// true if pathFinders are max-res PF's, i.e. vertex costs can be swept
+	bool useVertexSweep = false;
+
     std::vector<float> maxSpeedMods;
     std::vector<float> vertexCosts;
     std::deque<int2> updatedBlocks;
@@ -1,6 +1,7 @@
 /* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
 
 #include "IPathManager.h"
+#include "PathTrace.h"
 #include "QTPFS/PathManager.h"
 #include "HAPFS/PathManager.h"
 #include "System/Log/ILog.h"
@@ -20,6 +21,12 @@ IPathManager* IPathManager::GetInstance(int type) {
 		}
 
 		LOG(fmtStr, __func__, typeStr);
+
+		// replaying a trace while recording one would just copy it
+		pathTraceReplayer.Init(type);
+
+		if (!pathTraceReplayer.IsEnabled())
+			pathTraceRecorder.Init(type);
 	}
 
 	return pathManager;
@@ -28,6 +35,9 @@ IPathManager* IPathManager::GetInstance(int type) {
 void IPathManager::FreeInstance(IPathManager* pm) {
 	assert(pm == pathManager);
 
+	pathTraceRecorder.Kill();
+	pathTraceReplayer.Kill();
+
 	if (pm != &nullPathManager)
 		delete pm;
 
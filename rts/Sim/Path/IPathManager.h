@@ -180,6 +180,11 @@ public:
 
 	virtual int2 GetNumQueuedUpdates() const { return (int2(0, 0)); }
 
+	/// approximate memory used by the path manager, in megabytes
+	virtual std::uint64_t GetMemFootPrint() const { return 0; }
+	/// total number of nodes expanded by all searches executed so far
+	virtual std::uint64_t GetNumNodesSearched() const { return 0; }
+
 	virtual void SavePathCacheForPathId(int pathIdToSave) {};
 };
 
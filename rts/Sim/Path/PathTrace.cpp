@@ -0,0 +1,341 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <algorithm>
+#include <cstring>
+
+#include "PathTrace.h"
+#include "IPathManager.h"
+#include "Game/GlobalUnsynced.h"
+#include "Map/ReadMap.h"
+#include "Sim/Misc/GlobalConstants.h"
+#include "Sim/Misc/GlobalSynced.h"
+#include "Sim/MoveTypes/MoveDefHandler.h"
+#include "System/Config/ConfigHandler.h"
+#include "System/FileSystem/DataDirsAccess.h"
+#include "System/FileSystem/FileQueryFlags.h"
+#include "System/Log/ILog.h"
+#include "System/Misc/SpringTime.h"
+
+#include "System/Misc/TracyDefs.h"
+
+CONFIG(std::string, PathTraceRecordFile).defaultValue("").description("If set, all path-manager requests made during the game are recorded into this file (relative to the write-dir).");
+CONFIG(std::string, PathTraceReplayFile).defaultValue("").description("If set, path-manager requests are replayed from this trace file and their timings are logged; the game quits when the trace ends. Meant for spring-headless on an otherwise idle game.");
+
+PathTrace::Recorder pathTraceRecorder;
+PathTrace::Replayer pathTraceReplayer;
+
+
+static PathTrace::Header MakeHeader(std::int32_t pathFinderType)
+{
+	PathTrace::Header header;
+
+	std::memcpy(header.magic, PathTrace::MAGIC, sizeof(header.magic));
+	header.version = PathTrace::VERSION;
+	header.pathFinderType = pathFinderType;
+	header.mapx = mapDims.mapx;
+	header.mapy = mapDims.mapy;
+
+	return header;
+}
+
+static PathTrace::Event MakeEvent(PathTrace::EventType type)
+{
+	PathTrace::Event e;
+
+	std::memset(&e, 0, sizeof(e));
+	e.type = type;
+	e.frame = gs->frameNum;
+
+	return e;
+}
+
+// returns the value below which <pct> percent of the (sorted) samples fall
+static std::int64_t GetPercentile(const std::vector<std::int64_t>& samples, float pct)
+{
+	if (samples.empty())
+		return 0;
+
+	return samples[std::min(samples.size() - 1, static_cast<size_t>(samples.size() * pct))];
+}
+
+
+
+void PathTrace::Recorder::Init(std::int32_t pathFinderType)
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	const std::string fileName = configHandler->GetString("PathTraceRecordFile");
+
+	if (fileName.empty() || pathFinderType == NOPFS_TYPE)
+		return;
+
+	const std::string filePath = dataDirsAccess.LocateFile(fileName, FileQueryFlags::WRITE);
+
+	if ((file = std::fopen(filePath.c_str(), "wb")) == nullptr) {
+		LOG_L(L_ERROR, "[PathTrace::Recorder::%s] could not open \"%s\" for writing", __func__, filePath.c_str());
+		return;
+	}
+
+	const Header header = MakeHeader(pathFinderType);
+
+	std::fwrite(&header, sizeof(header), 1, file);
+	numEvents = 0;
+
+	LOG("[PathTrace::Recorder::%s] recording path requests to \"%s\"", __func__, filePath.c_str());
+}
+
+void PathTrace::Recorder::Kill()
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	if (file == nullptr)
+		return;
+
+	std::fclose(file);
+	file = nullptr;
+
+	LOG("[PathTrace::Recorder::%s] recorded %lu events", __func__, static_cast<unsigned long>(numEvents));
+}
+
+void PathTrace::Recorder::Append(Event& e)
+{
+	const std::lock_guard<std::mutex> lock(mutex);
+
+	if (file == nullptr)
+		return;
+
+	std::fwrite(&e, sizeof(e), 1, file);
+	numEvents += 1;
+}
+
+void PathTrace::Recorder::RequestPath(unsigned int pathID, int pathType, const float3& startPos, const float3& goalPos, float radius, bool synced, bool immediate)
+{
+	Event e = MakeEvent(EVENT_REQUEST_PATH);
+
+	e.synced = synced;
+	e.immediate = immediate;
+	e.pathType = pathType;
+	e.pathID = pathID;
+	e.startPos = startPos;
+	e.goalPos = goalPos;
+	e.radius = radius;
+
+	Append(e);
+}
+
+void PathTrace::Recorder::NextWayPoint(unsigned int pathID, const float3& callerPos, float radius, bool synced)
+{
+	Event e = MakeEvent(EVENT_NEXT_WAYPOINT);
+
+	e.synced = synced;
+	e.pathID = pathID;
+	e.startPos = callerPos;
+	e.radius = radius;
+
+	Append(e);
+}
+
+void PathTrace::Recorder::DeletePath(unsigned int pathID)
+{
+	Event e = MakeEvent(EVENT_DELETE_PATH);
+
+	e.pathID = pathID;
+
+	Append(e);
+}
+
+void PathTrace::Recorder::TerrainChange(unsigned int x1, unsigned int z1, unsigned int x2, unsigned int z2, unsigned int type)
+{
+	Event e = MakeEvent(EVENT_TERRAIN_CHANGE);
+
+	e.rect[0] = x1;
+	e.rect[1] = z1;
+	e.rect[2] = x2;
+	e.rect[3] = z2;
+	e.changeType = type;
+
+	Append(e);
+}
+
+
+
+void PathTrace::Replayer::Init(std::int32_t pathFinderType)
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	const std::string fileName = configHandler->GetString("PathTraceReplayFile");
+
+	if (fileName.empty() || pathFinderType == NOPFS_TYPE)
+		return;
+
+	const std::string filePath = dataDirsAccess.LocateFile(fileName);
+	std::FILE* file = std::fopen(filePath.c_str(), "rb");
+
+	if (file == nullptr) {
+		LOG_L(L_ERROR, "[PathTrace::Replayer::%s] could not open \"%s\"", __func__, filePath.c_str());
+		return;
+	}
+
+	const Header expected = MakeHeader(pathFinderType);
+	Header header;
+
+	if (std::fread(&header, sizeof(header), 1, file) != 1 || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+		LOG_L(L_ERROR, "[PathTrace::Replayer::%s] \"%s\" is not a version %u path trace", __func__, filePath.c_str(), VERSION);
+		std::fclose(file);
+		return;
+	}
+
+	if (header.pathFinderType != expected.pathFinderType || header.mapx != expected.mapx || header.mapy != expected.mapy) {
+		LOG_L(L_ERROR, "[PathTrace::Replayer::%s] \"%s\" was recorded with pfs=%d on a %dx%d map (current: pfs=%d, %dx%d)",
+			__func__, filePath.c_str(), header.pathFinderType, header.mapx, header.mapy, expected.pathFinderType, expected.mapx, expected.mapy);
+		std::fclose(file);
+		return;
+	}
+
+	Event e;
+
+	while (std::fread(&e, sizeof(e), 1, file) == 1) {
+		if (e.type >= EVENT_TYPE_COUNT)
+			break;
+
+		events.push_back(e);
+	}
+
+	std::fclose(file);
+
+	eventIndex = 0;
+	started = false;
+
+	LOG("[PathTrace::Replayer::%s] replaying %u events from \"%s\"", __func__, static_cast<unsigned int>(events.size()), filePath.c_str());
+}
+
+void PathTrace::Replayer::Kill()
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	events.clear();
+	pathIDs.clear();
+
+	for (auto& times: callTimes) {
+		times.clear();
+	}
+
+	updateTimes.clear();
+
+	peakMemFootPrint = 0;
+	numNodesSearchedStart = 0;
+}
+
+void PathTrace::Replayer::Update()
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	if (!started) {
+		// align the first recorded frame with the current one
+		frameOffset = gs->frameNum - events[0].frame;
+		numNodesSearchedStart = pathManager->GetNumNodesSearched();
+		started = true;
+	}
+
+	while (eventIndex < events.size() && (events[eventIndex].frame + frameOffset) <= gs->frameNum) {
+		ReplayEvent(events[eventIndex++]);
+	}
+
+	const spring_time t0 = spring_gettime();
+	pathManager->Update();
+	const spring_time t1 = spring_gettime();
+
+	updateTimes.push_back((t1 - t0).toNanoSecsi());
+
+	// walking all node-layers is not free, sample once per second
+	if ((updateTimes.size() % GAME_SPEED) == 1)
+		peakMemFootPrint = std::max(peakMemFootPrint, pathManager->GetMemFootPrint());
+
+	if (eventIndex < events.size())
+		return;
+
+	Report();
+	events.clear();
+
+	gu->globalQuit = true;
+}
+
+void PathTrace::Replayer::ReplayEvent(const Event& e)
+{
+	const spring_time t0 = spring_gettime();
+
+	switch (e.type) {
+		case EVENT_REQUEST_PATH: {
+			if (e.pathType < 0 || e.pathType >= static_cast<int>(moveDefHandler.GetNumMoveDefs()))
+				return;
+
+			const MoveDef* moveDef = moveDefHandler.GetMoveDefByPathType(e.pathType);
+			const unsigned int pathID = pathManager->RequestPath(nullptr, moveDef, e.startPos, e.goalPos, e.radius, e.synced, e.immediate);
+
+			if (e.pathID != 0)
+				pathIDs[e.pathID] = pathID;
+		} break;
+		case EVENT_NEXT_WAYPOINT: {
+			const auto it = pathIDs.find(e.pathID);
+
+			if (it == pathIDs.end())
+				return;
+
+			pathManager->NextWayPoint(nullptr, it->second, 0, e.startPos, e.radius, e.synced);
+		} break;
+		case EVENT_DELETE_PATH: {
+			const auto it = pathIDs.find(e.pathID);
+
+			if (it == pathIDs.end())
+				return;
+
+			pathManager->DeletePath(it->second);
+			pathIDs.erase(it);
+		} break;
+		case EVENT_TERRAIN_CHANGE: {
+			pathManager->TerrainChange(e.rect[0], e.rect[1], e.rect[2], e.rect[3], e.changeType);
+		} break;
+		default: {
+			return;
+		} break;
+	}
+
+	const spring_time t1 = spring_gettime();
+
+	callTimes[e.type].push_back((t1 - t0).toNanoSecsi());
+}
+
+void PathTrace::Replayer::Report() const
+{
+	static constexpr const char* eventNames[EVENT_TYPE_COUNT] = {"RequestPath", "NextWayPoint", "DeletePath", "TerrainChange"};
+
+	const auto LogTimes = [](const char* name, std::vector<std::int64_t> times) {
+		if (times.empty())
+			return;
+
+		std::sort(times.begin(), times.end());
+
+		std::int64_t sum = 0;
+		for (const std::int64_t t: times) {
+			sum += t;
+		}
+
+		LOG("[PathTrace::Replayer] %-14s calls=%-8u total=%9.3fms p50=%8.2fus p95=%8.2fus p99=%8.2fus max=%9.2fus",
+			name,
+			static_cast<unsigned int>(times.size()),
+			sum * 1e-6f,
+			GetPercentile(times, 0.50f) * 1e-3f,
+			GetPercentile(times, 0.95f) * 1e-3f,
+			GetPercentile(times, 0.99f) * 1e-3f,
+			times.back() * 1e-3f
+		);
+	};
+
+	LOG("[PathTrace::Replayer] finished replaying %u frames", static_cast<unsigned int>(updateTimes.size()));
+
+	for (int i = 0; i < EVENT_TYPE_COUNT; i++) {
+		LogTimes(eventNames[i], callTimes[i]);
+	}
+
+	LogTimes("Update", updateTimes);
+
+	LOG("[PathTrace::Replayer] nodes searched=%lu peak memory=%luMB",
+		static_cast<unsigned long>(pathManager->GetNumNodesSearched() - numNodesSearchedStart),
+		static_cast<unsigned long>(peakMemFootPrint)
+	);
+}
@@ -0,0 +1,121 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef PATH_TRACE_H
+#define PATH_TRACE_H
+
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+#include "System/float3.h"
+#include "System/UnorderedMap.hpp"
+
+/**
+ * Recording and replay of path-manager call streams.
+ *
+ * With PathTraceRecordFile set, every RequestPath / NextWayPoint / DeletePath
+ * / TerrainChange reaching the active path manager is appended to a binary
+ * trace. With PathTraceReplayFile set, the trace is fed back into a freshly
+ * initialized path manager frame by frame (the real callers are not needed,
+ * so this works in spring-headless on an empty game) and the cost of every
+ * call is measured and reported when the trace runs out.
+ */
+namespace PathTrace {
+	static constexpr char MAGIC[8] = {'P', 'F', 'S', 'T', 'R', 'A', 'C', 'E'};
+	static constexpr std::uint32_t VERSION = 1;
+
+	enum EventType: std::uint8_t {
+		EVENT_REQUEST_PATH   = 0,
+		EVENT_NEXT_WAYPOINT  = 1,
+		EVENT_DELETE_PATH    = 2,
+		EVENT_TERRAIN_CHANGE = 3,
+		EVENT_TYPE_COUNT     = 4,
+	};
+
+	struct Header {
+		char magic[sizeof(MAGIC)];
+		std::uint32_t version;
+		std::int32_t pathFinderType;
+		std::int32_t mapx;
+		std::int32_t mapy;
+	};
+
+	struct Event {
+		std::uint8_t type;
+		std::uint8_t synced;
+		std::uint8_t immediate;
+		std::uint8_t pad;
+
+		std::int32_t frame;
+		std::int32_t pathType;
+		std::uint32_t pathID;
+
+		std::uint32_t rect[4];
+		std::uint32_t changeType;
+
+		float3 startPos; // caller position for NextWayPoint
+		float3 goalPos;
+		float radius;
+	};
+
+	class Recorder {
+	public:
+		void Init(std::int32_t pathFinderType);
+		void Kill();
+
+		bool IsEnabled() const { return (file != nullptr); }
+
+		void RequestPath(unsigned int pathID, int pathType, const float3& startPos, const float3& goalPos, float radius, bool synced, bool immediate);
+		void NextWayPoint(unsigned int pathID, const float3& callerPos, float radius, bool synced);
+		void DeletePath(unsigned int pathID);
+		void TerrainChange(unsigned int x1, unsigned int z1, unsigned int x2, unsigned int z2, unsigned int type);
+
+	private:
+		void Append(Event& e);
+
+	private:
+		// NextWayPoint is called from multi-threaded unit updates
+		std::mutex mutex;
+		std::FILE* file = nullptr;
+
+		std::uint64_t numEvents = 0;
+	};
+
+	class Replayer {
+	public:
+		void Init(std::int32_t pathFinderType);
+		void Kill();
+
+		bool IsEnabled() const { return !events.empty(); }
+
+		/// replays the events recorded for the current frame, then runs pathManager->Update
+		void Update();
+
+	private:
+		void ReplayEvent(const Event& e);
+		void Report() const;
+
+	private:
+		std::vector<Event> events;
+		// maps recorded path-ids to the ones handed out during the replay
+		spring::unordered_map<unsigned int, unsigned int> pathIDs;
+
+		// per-call and per-Update timings in nanoseconds
+		std::vector<std::int64_t> callTimes[EVENT_TYPE_COUNT];
+		std::vector<std::int64_t> updateTimes;
+
+		size_t eventIndex = 0;
+		std::int32_t frameOffset = 0;
+
+		std::uint64_t peakMemFootPrint = 0;
+		std::uint64_t numNodesSearchedStart = 0;
+
+		bool started = false;
+	};
+}
+
+extern PathTrace::Recorder pathTraceRecorder;
+extern PathTrace::Replayer pathTraceReplayer;
+
+#endif
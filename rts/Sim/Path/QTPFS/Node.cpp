@@ -236,7 +236,25 @@ void QTPFS::QTNode::Init(
 	uint32_t depth = (parent != nullptr) ? (parent->GetDepth() + 1) : 0;
 	index = (idx & NODE_INDEX_MASK) + ((depth << DEPTH_BIT_OFFSET) & DEPTH_MASK);
 
-	neighbours.clear();
+	// any block owned in a previous life was returned by NodeLayer::FreePoolNode
+	assert(neighbourBlockIndex == -1u);
+	numNeighbours = 0;
+}
+
+void QTPFS::QTNode::ClearNeighbours(NodeLayer& nodeLayer) {
+	if (neighbourBlockIndex != -1u)
+		nodeLayer.FreeNeighbourBlock(neighbourBlockIndex, neighbourBlockClass);
+
+	neighbourBlockIndex = -1u;
+	neighbourBlockClass = 0;
+	numNeighbours = 0;
+}
+
+std::span<const QTPFS::INode::NeighbourPoints> QTPFS::QTNode::GetNeighbours(const NodeLayer& nl) const {
+	if (numNeighbours == 0)
+		return {};
+
+	return {nl.GetNeighbourBlock(neighbourBlockIndex), numNeighbours};
 }
 
 
@@ -329,7 +347,7 @@ bool QTPFS::QTNode::Split(NodeLayer& nl, unsigned int depth, bool forced) {
 
 	childBaseIndex = childIndices[0];
 
-	neighbours.clear();
+	ClearNeighbours(nl);
 	// netpoints.clear();
 
 	if (AllSquaresImpassable()) {
@@ -357,7 +375,7 @@ bool QTPFS::QTNode::Merge(NodeLayer& nl) {
 		return false;
 	}
 
-	neighbours.clear();
+	ClearNeighbours(nl);
 	// netpoints.clear();
 
 	// get rid of our children completely
@@ -748,16 +766,17 @@ bool QTPFS::QTNode::UpdateNeighborCache(NodeLayer& nodeLayer, UpdateThreadData&
 		nodeArea.ClampIn(threadData.areaRelinkedInner);
 
 		if (RectIntersects(threadData.areaRelinkedInner)) {
-			neighbours.clear();
-		} else {
-			for (int ni = neighbours.size(); ni-- > 0;) {
+			numNeighbours = 0;
+		} else if (numNeighbours > 0) {
+			NeighbourPoints* neighbours = nodeLayer.GetNeighbourBlock(neighbourBlockIndex);
+
+			for (int ni = numNeighbours; ni-- > 0;) {
 				auto curNode = nodeLayer.GetPoolNode(neighbours[ni].nodeId);
 				if (curNode->NodeDeactivated()
 					|| !curNode->IsLeaf()
 					|| curNode->RectIntersects(threadData.areaRelinkedInner)
 				) {
-					neighbours[ni] = neighbours.back();
-					neighbours.pop_back();
+					neighbours[ni] = neighbours[--numNeighbours];
 				}
 			}
 		}
@@ -994,17 +1013,38 @@ bool QTPFS::QTNode::UpdateNeighborCache(NodeLayer& nodeLayer, UpdateThreadData&
 
 		assert(newNeighbors < maxNumberOfNeighbours);
 
-		maxNgbs = neighbours.size() + newNeighbors;
-		neighbours.reserve(maxNgbs);
+		maxNgbs = numNeighbours + newNeighbors;
+
+		if (maxNgbs == 0) {
+			ClearNeighbours(nodeLayer);
+			return true;
+		}
+
+		// move into a block of the size class we need now, this also returns oversized blocks
+		// to the pool when a node lost most of its neighbours (e.g. after its neighbours merged)
+		if (const unsigned int blockClass = NodeLayer::GetNeighbourBlockClass(maxNgbs); neighbourBlockIndex == -1u || blockClass != neighbourBlockClass) {
+			const unsigned int newBlockIndex = nodeLayer.AllocNeighbourBlock(blockClass);
+
+			// NOTE: the allocation can grow the pool, so the old block must be looked up afterwards
+			if (neighbourBlockIndex != -1u) {
+				const NeighbourPoints* oldBlock = nodeLayer.GetNeighbourBlock(neighbourBlockIndex);
+				std::copy(oldBlock, oldBlock + numNeighbours, nodeLayer.GetNeighbourBlock(newBlockIndex));
+				nodeLayer.FreeNeighbourBlock(neighbourBlockIndex, neighbourBlockClass);
+			}
+
+			neighbourBlockIndex = newBlockIndex;
+			neighbourBlockClass = blockClass;
+		}
+
+		NeighbourPoints* neighbours = nodeLayer.GetNeighbourBlock(neighbourBlockIndex);
 
 		for (int i = 0; i < newNeighbors; i++) {
 			INode* ngb = neighborCache[i];
-			NeighbourPoints newNeighbour;
+			NeighbourPoints& newNeighbour = neighbours[numNeighbours++];
 			newNeighbour.nodeId = ngb->GetIndex();
 			for (unsigned int i = 0; i < QTPFS_MAX_NETPOINTS_PER_NODE_EDGE; i++) {
 				newNeighbour.netpoints[i] = (INode::GetNeighborEdgeTransitionPoint(ngb, {}, QTPFS_NETPOINT_EDGE_SPACING_SCALE * (i + 1)));
 			}
-			neighbours.emplace_back(newNeighbour);
 		}
 	}
 
@@ -6,6 +6,7 @@
 #include <array>
 #include <cinttypes>
 #include <limits>
+#include <span>
 #include <variant>
 #include <vector>
 #include <nowide/fstream.hpp>
@@ -92,6 +93,7 @@ namespace QTPFS {
 
 		unsigned int GetMaxNumNeighbors() const;
 		bool UpdateNeighborCache(NodeLayer& nodeLayer, UpdateThreadData& threadData);
+		void ClearNeighbours(NodeLayer& nodeLayer);
 
 		int xmin() const { return _xmin; }
 		int zmin() const { return _zmin; }
@@ -131,9 +133,11 @@ namespace QTPFS {
 		static unsigned int MinSizeX() { return MIN_SIZE_X; }
 		static unsigned int MinSizeZ() { return MIN_SIZE_Z; }
 
-		const std::vector<NeighbourPoints>& GetNeighbours() const {
-			return neighbours;
-		}
+		// neighbour lists live in the owning layer's pool (see NodeLayer::neighbourPool)
+		std::span<const NeighbourPoints> GetNeighbours(const NodeLayer& nl) const;
+		unsigned int GetNumNeighbours() const { return numNeighbours; }
+		unsigned int GetNeighbourBlockIndex() const { return neighbourBlockIndex; }
+		unsigned int GetNeighbourBlockClass() const { return neighbourBlockClass; }
 
 		void DeactivateNode() { _xmin = std::numeric_limits<decltype(_xmin)>::max(); }
 		bool NodeDeactivated() const { return (_xmin == std::numeric_limits<decltype(_xmin)>::max()); }
@@ -189,7 +193,13 @@ namespace QTPFS {
 		float moveCostAvg = -1.0f;
 
 		unsigned int childBaseIndex = -1u;
-		std::vector<NeighbourPoints> neighbours;
+
+		// Offset of this node's block in NodeLayer::neighbourPool; blocks hold (1 << class) entries. Storing
+		// a reference into a shared pool instead of a per-node std::vector saves 16 bytes per node as well as
+		// one heap allocation per leaf.
+		unsigned int neighbourBlockIndex = -1u;
+		unsigned short numNeighbours = 0;
+		unsigned char neighbourBlockClass = 0;
 	};
 
 	struct NodeSearched {};
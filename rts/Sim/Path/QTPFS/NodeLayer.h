@@ -5,6 +5,7 @@
 
 // #undef NDEBUG
 
+#include <array>
 #include <limits>
 #include <vector>
 #include <deque>
@@ -103,9 +104,44 @@ namespace QTPFS {
 			//LOG("%s: [%p] free'ed id=%d", __func__, &poolNodes, nodeIndex);
 			nodeIndcs.push_back(nodeIndex);
 			auto* curNode = GetPoolNode(nodeIndex);
+			curNode->ClearNeighbours(*this);
 			curNode->DeactivateNode();
 		}
 
+		// neighbour blocks are sized in powers of two and recycled per size class, which
+		// keeps the pool compact without ever having to move the blocks of other nodes
+		static unsigned int GetNeighbourBlockClass(unsigned int numNeighbours) {
+			unsigned int blockClass = 0;
+			while ((1u << blockClass) < numNeighbours)
+				++blockClass;
+
+			assert(blockClass < NUM_NEIGHBOUR_BLOCK_CLASSES);
+			return blockClass;
+		}
+
+		unsigned int AllocNeighbourBlock(unsigned int blockClass) {
+			auto& freeBlocks = freeNeighbourBlocks[blockClass];
+			unsigned int blockIndex = -1u;
+
+			if (!freeBlocks.empty()) {
+				blockIndex = freeBlocks.back();
+				freeBlocks.pop_back();
+				return blockIndex;
+			}
+
+			blockIndex = neighbourPool.size();
+			neighbourPool.resize(blockIndex + (1u << blockClass));
+			return blockIndex;
+		}
+
+		void FreeNeighbourBlock(unsigned int blockIndex, unsigned int blockClass) {
+			assert(blockIndex + (1u << blockClass) <= neighbourPool.size());
+			freeNeighbourBlocks[blockClass].push_back(blockIndex);
+		}
+
+		      INode::NeighbourPoints* GetNeighbourBlock(unsigned int blockIndex)       { return &neighbourPool[blockIndex]; }
+		const INode::NeighbourPoints* GetNeighbourBlock(unsigned int blockIndex) const { return &neighbourPool[blockIndex]; }
+
 		void DecreaseOpenNodeCounter() { assert(numOpenNodes > 0); numOpenNodes -= (numOpenNodes > 0); }
 		void DecreaseClosedNodeCounter() { assert(numClosedNodes > 0); numClosedNodes -= (numClosedNodes > 0); }
 
@@ -133,11 +169,12 @@ namespace QTPFS {
 
 			for (size_t i = 0, n = NUM_POOL_CHUNKS; i < n; i++) {
 				memFootPrint += (poolNodes[i].size() * sizeof(QTNode));
+			}
 
-				for (int32_t nodeIndex = poolNodes[i].size() - 1; nodeIndex >= 0; --nodeIndex) {
-					const auto& neighbours = poolNodes[i][nodeIndex].GetNeighbours();
-					memFootPrint += neighbours.size() * sizeof(std::remove_reference_t<decltype(neighbours)>::value_type);
-				}
+			memFootPrint += (neighbourPool.capacity() * sizeof(decltype(neighbourPool)::value_type));
+
+			for (const auto& freeBlocks: freeNeighbourBlocks) {
+				memFootPrint += (freeBlocks.capacity() * sizeof(unsigned int));
 			}
 
 			memFootPrint += (nodeIndcs.size() * sizeof(decltype(nodeIndcs)::value_type));
@@ -166,9 +203,14 @@ namespace QTPFS {
 		bool UseShortestPath() { return useShortestPath; }
 
 	private:
+		static constexpr unsigned int NUM_NEIGHBOUR_BLOCK_CLASSES = 10;
+
 		std::vector<QTNode> poolNodes[16];
 		std::vector<unsigned int> nodeIndcs;
 
+		std::vector<INode::NeighbourPoints> neighbourPool;
+		std::array<std::vector<unsigned int>, NUM_NEIGHBOUR_BLOCK_CLASSES> freeNeighbourBlocks;
+
 		std::vector<INode*> selectedNodes;
 		std::vector<INode*> openNodes;
 
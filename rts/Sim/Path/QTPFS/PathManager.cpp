@@ -28,6 +28,7 @@
 #include "Sim/MoveTypes/MoveDefHandler.h"
 #include "Sim/MoveTypes/MoveMath/MoveMath.h"
 #include "Sim/Objects/SolidObject.h"
+#include "Sim/Path/PathTrace.h"
 #include "System/Config/ConfigHandler.h"
 #include "System/FileSystem/ArchiveScanner.h"
 #include "System/FileSystem/FileSystem.h"
@@ -706,6 +707,9 @@ void QTPFS::PathManager::TerrainChange(unsigned int x1, unsigned int z1,  unsign
 	if (!IsFinalized())
 		return;
 
+	if (pathTraceRecorder.IsEnabled())
+		pathTraceRecorder.TerrainChange(x1, z1, x2, z2, type);
+
 	MapChanged(x1, z1, x2, z2);
 }
 
@@ -983,6 +987,8 @@ void QTPFS::PathManager::ExecuteQueuedSearches() {
 
 		PathSearch* search = &pathView.get<PathSearch>(pathSearchEntity);
 		QTPFS::entity pathEntity = (QTPFS::entity)search->GetID();
+		numNodesSearched += search->GetNumNodesSearched();
+
 		if (registry.valid(pathEntity)) {
 			// Only owned paths should be actioned in this function.
 			IPath* path = registry.try_get<IPath>(pathEntity);
@@ -1415,6 +1421,9 @@ void QTPFS::PathManager::DeletePath(unsigned int pathID, bool force) {
 
 	if (!registry.valid(pathEntity)) return;
 
+	if (pathTraceRecorder.IsEnabled())
+		pathTraceRecorder.DeletePath(pathID);
+
 	bool pathMarkedForSharing = registry.all_of<SharedPathChain>(pathEntity);
 	bool pathIsBeingProcessed = registry.any_of<PathIsDirty, PathSearchRef>(pathEntity);
 
@@ -1530,6 +1539,9 @@ unsigned int QTPFS::PathManager::RequestPath(
 	if (immediateResult && returnPathId != 0)
 		returnPathId = ExecuteImmediateSearch(returnPathId);
 
+	if (pathTraceRecorder.IsEnabled())
+		pathTraceRecorder.RequestPath(returnPathId, moveDef->pathType, sourcePoint, targetPoint, radius, synced, immediateResult);
+
 	return returnPathId;
 }
 
@@ -1545,6 +1557,7 @@ unsigned int QTPFS::PathManager::ExecuteImmediateSearch(unsigned int pathId){
 	int pathType = pathSearch.GetPathType();
 	NodeLayer& nodeLayer = nodeLayers[pathType];
 	ExecuteSearch(&pathSearch, nodeLayer, pathType);
+	numNodesSearched += pathSearch.GetNumNodesSearched();
 
 	if (registry.valid(pathEntity)) {
 		IPath* path = GetPath(pathEntity);
@@ -1596,7 +1609,7 @@ float3 QTPFS::PathManager::NextWayPoint(
 	unsigned int pathID,
 	unsigned int, // numRetries
 	float3 point,
-	float, // radius,
+	float radius,
 	bool synced
 ) {
 	ZoneScoped;
@@ -1605,6 +1618,9 @@ float3 QTPFS::PathManager::NextWayPoint(
 	if (!IsFinalized())
 		return noPathPoint;
 
+	if (pathTraceRecorder.IsEnabled())
+		pathTraceRecorder.NextWayPoint(pathID, point, radius, synced);
+
 	QTPFS::entity pathEntity = QTPFS::entity(pathID);
 	IPath* livePath = GetPath(pathEntity);
 	if (livePath == nullptr)
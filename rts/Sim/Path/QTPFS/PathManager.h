@@ -87,6 +87,9 @@ namespace QTPFS {
 
 		int2 GetNumQueuedUpdates() const override;
 
+		std::uint64_t GetMemFootPrint() const override;
+		std::uint64_t GetNumNodesSearched() const override { return numNodesSearched; }
+
 
 		const NodeLayer& GetNodeLayer(unsigned int pathType) const { return nodeLayers[pathType]; }
 		const NodeLayersChangeTrack& GetMapDamageTrack() const { return nodeLayersMapDamageTrack; };
@@ -99,8 +102,6 @@ namespace QTPFS {
 		void ThreadUpdate();
 		void Load();
 
-		std::uint64_t GetMemFootPrint() const;
-
 		typedef void (PathManager::*MemberFunc)(
 			unsigned int threadNum,
 			unsigned int numThreads,
@@ -191,6 +192,8 @@ namespace QTPFS {
 		unsigned int searchStateOffset;
 		unsigned int numPathRequests;
 
+		std::uint64_t numNodesSearched = 0;
+
 		std::int32_t refreshDirtyPathRateFrame = QTPFS_LAST_FRAME;
 		std::int32_t updateDirtyPathRate = 0;
 		std::int32_t updateDirtyPathRemainder = 0;
@@ -684,6 +684,84 @@ void QTPFS::PathSearch::SetForwardSearchLimit() {
 	fwdNodeSearchLimit = std::max(minNodesSearched, int(limit * CircularEaseOut(interp)));
 }
 
+void QTPFS::PathSearch::RecordMeetingNode(SearchNode& fwdNode, SearchNode& bwdNode) {
+	RECOIL_DETAILED_TRACY_ZONE;
+	assert(fwdNode.GetIndex() == bwdNode.GetIndex());
+
+	// Both directions entered the node through their own transition point, so the
+	// full route also has to cross the node between those two points.
+	const INode* node = nodeLayer->GetPoolNode(fwdNode.GetIndex());
+	const float nodeCost = node->AllSquaresImpassable() ? QTPFS_CLOSED_NODE_COST : node->GetMoveCost();
+	const float crossDist = fwdNode.GetNeighborEdgeTransitionPoint().Distance(bwdNode.GetNeighborEdgeTransitionPoint());
+	const float meetCost = fwdNode.GetPathCost(NODE_PATH_COST_G) + bwdNode.GetPathCost(NODE_PATH_COST_G) + nodeCost * crossDist;
+
+	if (meetCost >= bestMeetCost)
+		return;
+
+	bestMeetFwdNode = &fwdNode;
+	bestMeetBwdNode = &bwdNode;
+	bestMeetCost = meetCost;
+}
+
+bool QTPFS::PathSearch::IsBestMeetingNodeProven() const {
+	RECOIL_DETAILED_TRACY_ZONE;
+	const auto& fwdOpenNodes = *directionalSearchData[SearchThreadData::SEARCH_FORWARD].openNodes;
+	const auto& bwdOpenNodes = *directionalSearchData[SearchThreadData::SEARCH_BACKWARD].openNodes;
+
+	// Any cheaper route would have to pass through a node that is still open in both
+	// directions, and the f-cost of every open node is a lower bound on such a route;
+	// so an exhausted or too-expensive queue on either side rules all of them out.
+	const auto IsExhausted = [&](const auto& openNodes) {
+		return (openNodes.empty() || openNodes.top().heapPriority >= bestMeetCost);
+	};
+
+	return (IsExhausted(fwdOpenNodes) || IsExhausted(bwdOpenNodes));
+}
+
+void QTPFS::PathSearch::ConnectAtBestMeetingNode() {
+	RECOIL_DETAILED_TRACY_ZONE;
+	auto& fwd = directionalSearchData[SearchThreadData::SEARCH_FORWARD];
+	auto& bwd = directionalSearchData[SearchThreadData::SEARCH_BACKWARD];
+
+	SearchNode* fwdNode = bestMeetFwdNode;
+	SearchNode* bwdNode = bestMeetBwdNode;
+
+	if (!(fwdNode->xmax > 0 || fwdNode->zmax > 0))
+		InitSearchNodeData(fwdNode, nodeLayer->GetPoolNode(fwdNode->GetIndex()));
+	if (!(bwdNode->xmax > 0 || bwdNode->zmax > 0))
+		InitSearchNodeData(bwdNode, nodeLayer->GetPoolNode(bwdNode->GetIndex()));
+
+	fwdPathConnected = true;
+	bwdPathConnected = true;
+	haveFullPath = true;
+
+	// same linkage as when the searches connect on first contact in ExecutePathSearch
+	if (bwdNode->GetPrevNode() == nullptr) {
+		// met in the goal node, the forward search covers the whole route
+		useFwdPathOnly = true;
+		fwd.tgtSearchNode = fwdNode;
+	} else if (fwdNode->GetPrevNode() == nullptr) {
+		useFwdPathOnly = false;
+		bwd.tgtSearchNode = bwdNode->GetPrevNode();
+		fwd.tgtSearchNode = fwd.minSearchNode = fwdNode;
+
+		const float2& searchTransitionPoint = bwdNode->GetNeighborEdgeTransitionPoint();
+		bwd.tgtPoint = float3(searchTransitionPoint.x, 0.f, searchTransitionPoint.y);
+	} else {
+		useFwdPathOnly = false;
+		fwd.tgtSearchNode = fwdNode->GetPrevNode();
+		bwd.tgtSearchNode = bwdNode;
+
+		const float2& searchTransitionPoint = fwdNode->GetNeighborEdgeTransitionPoint();
+		bwd.tgtPoint = float3(searchTransitionPoint.x, 0.f, searchTransitionPoint.y);
+
+		AssertPointIsOnNodeEdge(bwd.tgtPoint, fwd.tgtSearchNode);
+		AssertPointIsOnNodeEdge(bwd.tgtPoint, bwd.tgtSearchNode);
+	}
+
+	searchThreadData->ResetQueue();
+}
+
 // #pragma GCC push_options
 // #pragma GCC optimize ("O0")
 
@@ -697,6 +775,16 @@ bool QTPFS::PathSearch::ExecutePathSearch() {
 	UpdateHcostMult();
 	InitStartingSearchNodes();
 
+	// partial-share and repair searches rely on connecting at the first contact; proving
+	// a contact optimal also needs a heuristic that never overestimates, which an inflated
+	// hCostMult no longer guarantees
+	optimalMeet = modInfo.qtBidirectionalOptimalMeet && !doPartialSearch && !doPathRepair && (hCostMult <= 1.0f);
+	pruneUniformCost = modInfo.qtPruneUniformCostNeighbours && !doPathRepair;
+
+	bestMeetFwdNode = nullptr;
+	bestMeetBwdNode = nullptr;
+	bestMeetCost = QTPFS_POSITIVE_INFINITY;
+
 	auto& fwd = directionalSearchData[SearchThreadData::SEARCH_FORWARD];
 	auto& fwdSearchNodes = searchThreadData->allSearchedNodes[SearchThreadData::SEARCH_FORWARD];
 	
@@ -903,6 +991,11 @@ bool QTPFS::PathSearch::ExecutePathSearch() {
 			if (bwdSearchNodes.isSet(curSearchNode->GetIndex())) {
 				SearchNode& bwdNode = bwdSearchNodes[curSearchNode->GetIndex()];
 				fwdPathConnected = IsNodeActive(bwdNode);
+				if (fwdPathConnected && optimalMeet) {
+					// keep searching until no cheaper contact can exist
+					RecordMeetingNode(*curSearchNode, bwdNode);
+					fwdPathConnected = false;
+				}
 				if (fwdPathConnected){
 					fwdStepIndex = curSearchNode->GetStepIndex();
 					copyNodeBoundary(bwdNode);
@@ -1007,6 +1100,10 @@ bool QTPFS::PathSearch::ExecutePathSearch() {
 				if (!searchEarlyDrop) {
 					bwdPathConnected = IsNodeActive(fwdNode);
 				}
+				if (bwdPathConnected && optimalMeet) {
+					RecordMeetingNode(fwdNode, *curSearchNode);
+					bwdPathConnected = false;
+				}
 				if (bwdPathConnected) {
 					bwdStepIndex = curSearchNode->GetStepIndex();
 					copyNodeBoundary(fwdNode);
@@ -1079,6 +1176,11 @@ bool QTPFS::PathSearch::ExecutePathSearch() {
 				SetForwardSearchLimit();
 		}
 
+		// either direction may still have connected on its own (e.g. forward search reaching
+		// the goal), which must not be overridden by the best recorded contact
+		if (optimalMeet && !haveFullPath && bestMeetFwdNode != nullptr && IsBestMeetingNodeProven())
+			ConnectAtBestMeetingNode();
+
 		// stop if forward search is done, even if reverse search can continue. If forward search
 		// is done, then no path can be found and we have the nearest node if one is present.
 		// Reverse search will have to make do with what is has established for the sake of faster
@@ -1413,7 +1515,14 @@ void QTPFS::PathSearch::IterateNodeNeighbors(const INode* curNode, unsigned int
 	// Allow units to escape if starting in a closed node - a cost of infinity would prevent them escaping.
 	const float curNodeSanitizedCost = curNode->AllSquaresImpassable() ? QTPFS_CLOSED_NODE_COST : curNode->GetMoveCost();
 
-	const std::vector<INode::NeighbourPoints>& nxtNodes = curNode->GetNeighbours();
+	// Jump-point style pruning: when the parent node has the same move cost as the current node, the
+	// neighbours the parent already reached directly are not worth re-evaluating through this node.
+	const SearchNode* parentSearchNode = curSearchNode->GetPrevNode();
+	const bool pruneParentNeighbours = pruneUniformCost
+		&& (parentSearchNode != nullptr)
+		&& (nodeLayer->GetPoolNode(parentSearchNode->GetIndex())->GetMoveCost() == curNode->GetMoveCost());
+
+	const std::span<const INode::NeighbourPoints> nxtNodes = curNode->GetNeighbours(*nodeLayer);
 	for (unsigned int i = 0; i < nxtNodes.size(); i++) {
 		// NOTE:
 		//   this uses the actual distance that edges of the final path will cover,
@@ -1445,6 +1554,9 @@ void QTPFS::PathSearch::IterateNodeNeighbors(const INode* curNode, unsigned int
 		if (curSearchNode->GetPrevNode() == nextSearchNode)
 			continue;
 
+		if (pruneParentNeighbours && nextSearchNode->GetPrevNode() == parentSearchNode && nextSearchNode != searchData.tgtSearchNode)
+			continue;
+
 		// Forbid the reverse search from trampling on it's preloaded nodes for path repair, because even though the
 		// search resticted is to an AABB, the remaining existing path can flow in and out of this region. If we
 		// connect the reverse in this particular scenario, it will create an infinite loop.
@@ -124,6 +124,7 @@ namespace QTPFS {
 		const PathHashType GetPartialSearchHash() const { return pathPartialSearchHash; };
 
 		bool PathWasFound() const { return haveFullPath | havePartPath; }
+		size_t GetNumNodesSearched() const { return fwdNodesSearched + bwdNodesSearched; }
 
 		void SetPathType(int newPathType) { pathType = newPathType; }
 		int GetPathType() const { return pathType; }
@@ -185,6 +186,10 @@ namespace QTPFS {
 
 		void SetForwardSearchLimit();
 
+		void RecordMeetingNode(SearchNode& fwdNode, SearchNode& bwdNode);
+		bool IsBestMeetingNodeProven() const;
+		void ConnectAtBestMeetingNode();
+
 		void GetRectangleCollisionVolume(const SearchNode& snode, CollisionVolume& v, float3& rm) const;
 
 		const PathHashType GenerateHash(const INode* srcNode, const INode* tgtNode) const;
@@ -240,6 +245,12 @@ namespace QTPFS {
 
 		int fwdNodeSearchLimit = 0;
 
+		// cheapest contact between the two search directions seen so far, only
+		// tracked when qtBidirectionalOptimalMeet is enabled
+		SearchNode* bestMeetFwdNode = nullptr;
+		SearchNode* bestMeetBwdNode = nullptr;
+		float bestMeetCost = QTPFS_POSITIVE_INFINITY;
+
 		size_t fwdNodesSearched = 0;
 		size_t bwdNodesSearched = 0;
 
@@ -265,6 +276,9 @@ public:
 		bool bwdPathConnected = false;
 		bool useFwdPathOnly = false;
 
+		bool optimalMeet = false;
+		bool pruneUniformCost = false;
+
 		// int postLoadRepairPathIndexOverride = 0;
 
 		static float MAP_RELATIVE_MAX_NODES_SEARCHED;
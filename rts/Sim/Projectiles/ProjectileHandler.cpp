@@ -5,6 +5,7 @@
 #include "Projectile.h"
 #include "ProjectileHandler.h"
 #include "ProjectileMemPool.h"
+#include "Game/GameHelper.h"
 #include "Game/GlobalUnsynced.h"
 #include "Game/TraceRay.h"
 #include "Map/Ground.h"
@@ -646,7 +647,11 @@ void CProjectileHandler::CheckCollisions()
 	CheckUnitFeatureCollisions(true ); // changes simulation state
 	CheckUnitFeatureCollisions(false); // does not change simulation state
 
+	// ground impacts do not depend on each other's damage, so resolve
+	// their explosions as one batch (cluster munitions, flak, etc)
+	helper->BeginExplosionBatch();
 	CheckGroundCollisions(true ); // changes simulation state
+	helper->EndExplosionBatch();
 	CheckGroundCollisions(false); // does not change simulation state
 }
 
@@ -97,6 +97,24 @@ void Command::CopyParams(const Command& c) {
 	}
 }
 
+void Command::MoveParams(Command& c) {
+	if (this == &c)
+		return;
+
+	// clear existing params
+	if (IsPooledCommand())
+		cmdParamsPool.ReleasePage(pageIndex);
+
+	// take over c's page (if any), c is left without params
+	pageIndex = c.pageIndex;
+	numParams = c.numParams;
+
+	memcpy(&params[0], &c.params[0], sizeof(params));
+
+	c.pageIndex = -1u;
+	c.numParams = 0;
+}
+
 void Command::Serialize(creg::ISerializer* s) {
 	if (s->IsWriting()) {
 		for (unsigned int i = 0; i < numParams; i++) {
@@ -6,6 +6,7 @@
 #include <string>
 #include <climits> // INT_MAX
 #include <cstring> // memset
+#include <utility> // move
 
 #include "System/creg/creg_cond.h"
 #include "System/float3.h"
@@ -170,6 +171,20 @@ public:
 		return *this;
 	}
 
+	// moving hands over the params page instead of copying it through the
+	// pool, which makes shuffling pooled commands around inside a queue cheap
+	Command(Command&& c) noexcept {
+		*this = std::move(c);
+	}
+
+	Command& operator = (Command&& c) noexcept {
+		memcpy(&id[0], &c.id[0], sizeof(id));
+
+		SetFlags(c.timeOut, c.tag, c.options);
+		MoveParams(c);
+		return *this;
+	}
+
 	Command(const float3& pos) {
 		memset(&params[0], 0, sizeof(params));
 
@@ -420,6 +435,7 @@ public:
 	}
 
 	void CopyParams(const Command& c);
+	void MoveParams(Command& c);
 
 	void Serialize(creg::ISerializer* s);
 
@@ -58,6 +58,14 @@ CR_REG_METADATA(CCommandQueue, (
 	CR_MEMBER(tagCounter)
 ))
 
+std::pmr::memory_resource* CCommandQueue::GetMemoryResource()
+{
+	// queues are only modified by the sim, no need for locking; the
+	// pool is never destroyed so it outlives any queue during exit
+	static std::pmr::unsynchronized_pool_resource* resource = new std::pmr::unsynchronized_pool_resource();
+	return resource;
+}
+
 CR_BIND_DERIVED(CCommandAI, CObject, )
 CR_REG_METADATA(CCommandAI, (
 	CR_MEMBER(stockpileWeapon),
@@ -828,6 +836,23 @@ void CCommandAI::GiveCommand(const Command& c, int playerNum, bool fromSynced, b
 	GiveCommandReal(c, fromSynced); // send to the sub-classes
 }
 
+void CCommandAI::GiveCommandToUnits(const std::vector<CUnit*>& units, const Command& c, int playerNum, bool fromSynced, bool fromLua)
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+	std::vector<uint8_t> allowed;
+
+	// one call-in for the whole group; per-unit AllowCommand still runs
+	// below for clients that only implement that (cheap if there are none)
+	eventHandler.AllowUnitsCommand(units, c, playerNum, fromSynced, fromLua, allowed);
+
+	for (size_t i = 0; i < units.size(); i++) {
+		if (!allowed[i])
+			continue;
+
+		units[i]->commandAI->GiveCommand(c, playerNum, fromSynced, fromLua);
+	}
+}
+
 
 void CCommandAI::GiveCommandReal(const Command& c, bool fromSynced)
 {
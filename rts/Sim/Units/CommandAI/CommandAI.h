@@ -44,6 +44,9 @@ public:
 	void GiveCommand(const Command& c,                bool fromSynced = true              ); // sim
 	void GiveCommand(const Command& c, int playerNum, bool fromSynced       , bool fromLua); // net,Lua
 
+	/// gives the same command to a group, AllowUnitsCommand is asked once for all of them
+	static void GiveCommandToUnits(const std::vector<CUnit*>& units, const Command& c, int playerNum, bool fromSynced, bool fromLua);
+
 	void ClearTargetLock(const Command& fc);
 	void WeaponFired(CWeapon* weapon, const bool searchForNewTarget, bool raiseEvent = true);
 
@@ -4,6 +4,7 @@
 #define _COMMAND_QUEUE_H
 
 #include <deque>
+#include <memory_resource>
 #include "Command.h"
 
 /// A wrapper class for std::deque<Command> to keep track of commands
@@ -28,7 +29,10 @@ class CCommandQueue {
 		/// limit to a float's integer range
 		static const int maxTagValue = (1 << 24); // 16777216
 
-		typedef std::deque<Command> basis;
+		// blocks come from a pool shared by all queues, so long build
+		// orders and shift-queued paths do not hit the heap every few
+		// commands (a deque block only holds a handful of Command's)
+		typedef std::pmr::deque<Command> basis;
 
 		typedef basis::size_type              size_type;
 		typedef basis::iterator               iterator;
@@ -42,13 +46,15 @@ class CCommandQueue {
 
 		inline void push_back(const Command& cmd);
 		inline void push_front(const Command& cmd);
+		inline void push_back(Command&& cmd) { emplace_back(std::move(cmd)); }
+		inline void push_front(Command&& cmd) { emplace_front(std::move(cmd)); }
 
 		void emplace_back(Command&& cmd) {
-			queue.emplace_back(cmd);
+			queue.emplace_back(std::move(cmd));
 			queue.back().SetTag(GetNextTag());
 		}
 		void emplace_front(Command&& cmd) {
-			queue.emplace_front(cmd);
+			queue.emplace_front(std::move(cmd));
 			queue.front().SetTag(GetNextTag());
 		}
 
@@ -98,16 +104,18 @@ class CCommandQueue {
 		inline const Command& operator[](size_type i) const { return queue[i]; }
 
 	private:
-		CCommandQueue() : queueType(CommandQueueType), tagCounter(0) {};
+		CCommandQueue() : queue(GetMemoryResource()), queueType(CommandQueueType), tagCounter(0) {};
 		CCommandQueue(const CCommandQueue&);
 		CCommandQueue& operator=(const CCommandQueue&);
 
 	private:
+		static std::pmr::memory_resource* GetMemoryResource();
+
 		inline int GetNextTag();
 		inline void SetQueueType(QueueType type) { queueType = type; }
 
 	private:
-		std::deque<Command> queue;
+		basis queue;
 		QueueType queueType;
 		int tagCounter;
 };
@@ -141,7 +149,7 @@ inline CCommandQueue::iterator CCommandQueue::insert(iterator pos, const Command
 {
 	Command tmpCmd = cmd;
 	tmpCmd.SetTag(GetNextTag());
-	return queue.insert(pos, tmpCmd);
+	return queue.insert(pos, std::move(tmpCmd));
 }
 
 
@@ -4,6 +4,7 @@
 #define EVENT_CLIENT_H
 
 #include <algorithm>
+#include <cstdint>
 #include <typeinfo>
 #include <string>
 #include <vector>
@@ -207,6 +208,8 @@ class CEventClient
 
 		virtual bool CommandFallback(const CUnit* unit, const Command& cmd) { return false; }
 		virtual bool AllowCommand(const CUnit* unit, const Command& cmd, int playerNum, bool fromSynced, bool fromLua) { return true; }
+		/// may only clear entries of <allowed>, which parallels <units>
+		virtual void AllowUnitsCommand(const std::vector<CUnit*>& units, const Command& cmd, int playerNum, bool fromSynced, bool fromLua, std::vector<uint8_t>& allowed) {}
 
 		virtual std::pair <bool, bool> AllowUnitCreation(const UnitDef* unitDef, const CUnit* builder, const BuildInfo* buildInfo) { return {true, true}; }
 		virtual bool AllowUnitTransfer(const CUnit* unit, int newTeam, bool capture) { return true; }
@@ -140,6 +140,21 @@ bool CEventHandler::IsController(const std::string& eName) const
 }
 
 
+bool CEventHandler::HasSyncedClient(const std::string& eName) const
+{
+	const auto comp = [](const EventPair& a, const EventPair& b) { return (a.first < b.first); };
+	const auto iter = std::lower_bound(eventMap.begin(), eventMap.end(), EventPair{eName, {}}, comp);
+
+	if (iter == eventMap.end() || iter->first != eName)
+		return false;
+
+	const EventClientList* list = iter->second.GetList();
+	const auto pred = [](const CEventClient* ec) { return ec->GetSynced(); };
+
+	return (list != nullptr && std::find_if(list->begin(), list->end(), pred) != list->end());
+}
+
+
 /******************************************************************************/
 
 bool CEventHandler::InsertEvent(CEventClient* ec, const std::string& ciName)
@@ -255,6 +270,22 @@ bool CEventHandler::AllowCommand(const CUnit* unit, const Command& cmd, int play
 	return ControlIterateDefTrue(listAllowCommand, &CEventClient::AllowCommand, unit, cmd, playerNum, fromSynced, fromLua);
 }
 
+void CEventHandler::AllowUnitsCommand(const std::vector<CUnit*>& units, const Command& cmd, int playerNum, bool fromSynced, bool fromLua, std::vector<uint8_t>& allowed)
+{
+	ZoneScoped;
+
+	allowed.clear();
+	allowed.resize(units.size(), 1);
+
+	for (size_t i = 0; i < listAllowUnitsCommand.size(); ) {
+		const auto ec = listAllowUnitsCommand[i];
+		ec->AllowUnitsCommand(units, cmd, playerNum, fromSynced, fromLua, allowed);
+
+		// the call-in may remove itself from the list
+		i += (i < listAllowUnitsCommand.size() && ec == listAllowUnitsCommand[i]);
+	}
+}
+
 
 std::pair <bool, bool> CEventHandler::AllowUnitCreation(const UnitDef* unitDef, const CUnit* builder, const BuildInfo* buildInfo)
 {
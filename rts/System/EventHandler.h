@@ -41,6 +41,7 @@ class CEventHandler
 		bool IsManaged(const std::string& ciName) const;
 		bool IsUnsynced(const std::string& ciName) const;
 		bool IsController(const std::string& ciName) const;
+		bool HasSyncedClient(const std::string& ciName) const;
 
 
 	public:
@@ -144,6 +145,7 @@ class CEventHandler
 
 		bool CommandFallback(const CUnit* unit, const Command& cmd);
 		bool AllowCommand(const CUnit* unit, const Command& cmd, int playerNum, bool fromSynced, bool fromLua);
+		void AllowUnitsCommand(const std::vector<CUnit*>& units, const Command& cmd, int playerNum, bool fromSynced, bool fromLua, std::vector<uint8_t>& allowed);
 
 		std::pair <bool, bool> AllowUnitCreation(const UnitDef* unitDef, const CUnit* builder, const BuildInfo* buildInfo);
 		bool AllowUnitTransfer(const CUnit* unit, int newTeam, bool capture);
@@ -5,6 +5,9 @@
 #include <memory>
 #include <random>
 #include <chrono>
+#include <cstring>
+#include <span>
+#include <type_traits>
 
 #include <nowide/cstdio.hpp>
 
@@ -26,9 +29,11 @@
 #include "Lua/LuaParser.h"
 #include "System/ContainerUtil.h"
 #include "System/StringUtil.h"
+#include "System/Config/ConfigHandler.h"
 #include "System/Exceptions.h"
 #include "System/Threading/ThreadPool.h"
 #include "System/FileSystem/RapidHandler.h"
+#include "System/FileSystem/FileView.h"
 #include "System/FileSystem/Archives/PoolArchive.h"
 #include "System/Log/ILog.h"
 #include "System/Threading/SpringThreading.h"
@@ -61,6 +66,10 @@ LOG_REGISTER_SECTION_GLOBAL(LOG_SECTION_ARCHIVESCANNER)
 
 constexpr static int INTERNAL_VER = 21;
 
+CONFIG(bool, ArchiveCacheExportLua)
+	.defaultValue(true)
+	.description("Also write the archive cache as ArchiveCache<version>.lua next to the binary one, for external tools that parse it. Deprecated: the engine only reads the binary cache, and this will default to false in a future release.");
+
 
 /*
  * Engine known (and used?) tags in [map|mod]info.lua
@@ -423,6 +432,7 @@ void CArchiveScanner::Clear()
 	brokenArchivesIndex.clear();
 	brokenArchivesIndex.reserve(16);
 	cacheFile.clear();
+	luaCacheFile.clear();
 	numFilesHashed.store(0);
 }
 
@@ -500,9 +510,38 @@ void CArchiveScanner::ScanDirs(const std::vector<std::string>& scanDirs)
 		}
 	}*/
 
-	// Create archiveInfos etc. if not in cache already
+	// Create archiveInfos etc. if not in cache already; the cache-check is
+	// cheap but mutates the archive tables and has to run serially
+	std::vector<std::pair<std::string, uint32_t>> newArchives;
+	newArchives.reserve(foundArchives.size());
+
 	for (const std::string& archive: foundArchives) {
-		ScanArchive(archive, false);
+		uint32_t modifiedTime = 0;
+
+		if (!CheckCachedData(archive, modifiedTime, false))
+			newArchives.emplace_back(archive, modifiedTime);
+	}
+
+	// opening archives and executing their {map,mod}info.lua is not, do that
+	// in parallel and add the results in discovery order so the outcome does
+	// not depend on thread timing; batched to keep the watchdog fed
+	std::vector<ScannedArchive> scannedArchives;
+
+	const size_t batchSize = std::max(ThreadPool::GetNumThreads(), 1) * 4;
+
+	for (size_t i = 0; i < newArchives.size(); i += batchSize) {
+		scannedArchives.clear();
+		scannedArchives.resize(std::min(batchSize, newArchives.size() - i));
+
+		for_mt(0, scannedArchives.size(), [&](int j) {
+			const auto& [archive, modifiedTime] = newArchives[i + j];
+			scannedArchives[j] = ReadArchive(archive, modifiedTime);
+		});
+
+		for (ScannedArchive& sa: scannedArchives) {
+			AddScannedArchive(std::move(sa));
+		}
+
 	#if !defined(DEDICATED) && !defined(UNITSYNC)
 		Watchdog::ClearTimer();
 	#endif
@@ -598,7 +637,7 @@ bool CArchiveScanner::CheckCompression(const IArchive* ar, const std::string& fu
 	return true;
 }
 
-std::string CArchiveScanner::SearchMapFile(const IArchive* ar, std::string& error)
+std::string CArchiveScanner::SearchMapFile(const IArchive* ar, std::string& error) const
 {
 	assert(ar != nullptr);
 
@@ -619,9 +658,16 @@ void CArchiveScanner::ReadCache()
 {
 	Clear();
 
-    cacheFile = FileSystem::EnsurePathSepAtEnd(FileSystem::GetCacheDir()) + IntToString(INTERNAL_VER, "ArchiveCache%i.lua");
+	cacheFile = FileSystem::EnsurePathSepAtEnd(FileSystem::GetCacheDir()) + IntToString(INTERNAL_VER, "ArchiveCache%i.bin");
+	luaCacheFile = FileSystem::EnsurePathSepAtEnd(FileSystem::GetCacheDir()) + IntToString(INTERNAL_VER, "ArchiveCache%i.lua");
 
-	if (!FileSystem::FileExists(cacheFile)) {
+	// the Lua cache is only imported when there is no (valid) binary one yet,
+	// in which case the binary cache has to be written out after scanning
+	const bool haveBinaryCache = ReadBinaryCacheData(cacheFile);
+
+	if (!haveBinaryCache && ReadLuaCacheData(luaCacheFile)) {
+		isDirty = true;
+	} else if (!haveBinaryCache) {
 		// Try to save initial scanning of assets, but will have to redo hashing
 		// as the previous version had bugs in that area
 		// probe two previous versions
@@ -632,7 +678,7 @@ void CArchiveScanner::ReadCache()
 		};
 
 		for (const auto& prevCacheFile : prevCacheFiles) {
-			if (!ReadCacheData(prevCacheFile, true))
+			if (!ReadLuaCacheData(prevCacheFile, true))
 				continue;
 
 			// nullify hashes, filesInfo
@@ -650,7 +696,6 @@ void CArchiveScanner::ReadCache()
 		}
 	}
 
-	ReadCacheData(GetFilepath());
 	ScanAllDirs();
 }
 
@@ -712,26 +757,52 @@ void CArchiveScanner::ScanArchive(const std::string& fullName, bool doChecksum)
 
 	const ScanScope scanScope(&isInScan);
 
+	ScannedArchive sa = ReadArchive(fullName, modifiedTime);
+
+	if (doChecksum && !sa.isBroken && sa.exception == nullptr)
+		sa.archiveInfo.hashed = GetArchiveChecksum(fullName, sa.archiveInfo);
+
+	AddScannedArchive(std::move(sa));
+}
+
+
+CArchiveScanner::ScannedArchive CArchiveScanner::ReadArchive(const std::string& fullName, uint32_t modifiedTime) const
+{
 	const std::string& fname = FileSystem::GetFilename(fullName);
 	const std::string& fpath = FileSystem::GetDirectory(fullName);
-	const std::string& lcfn  = StringToLower(fname);
 
-	std::unique_ptr<IArchive> ar(archiveLoader.OpenArchive(fullName));
-
-	if (ar == nullptr || !ar->IsOpen()) {
-		LOG_L(L_WARNING, "[AS::%s] unable to open archive \"%s\"", __func__, fullName.c_str());
+	ScannedArchive sa;
+	sa.fullName = fullName;
+	sa.lcfn = StringToLower(fname);
 
+	const auto MarkBroken = [&](const std::string& problem) {
 		// record it as broken, so we don't need to look inside everytime
-		BrokenArchive& ba = GetAddBrokenArchive(lcfn);
-		ba.name = lcfn;
+		BrokenArchive& ba = sa.brokenArchive;
+		ba.name = sa.lcfn;
 		ba.path = fpath;
 		ba.modified = modifiedTime;
 		ba.updated = true;
-		ba.problem = "Unable to open archive";
+		ba.problem = problem;
+
+		sa.isBroken = true;
+	};
+
+	std::unique_ptr<IArchive> ar;
+
+	try {
+		ar.reset(archiveLoader.OpenArchive(fullName));
+	} catch (...) {
+		// rethrown by AddScannedArchive, exceptions must not escape a worker
+		sa.exception = std::current_exception();
+		return sa;
+	}
+
+	if (ar == nullptr || !ar->IsOpen()) {
+		LOG_L(L_WARNING, "[AS::%s] unable to open archive \"%s\"", __func__, fullName.c_str());
 
 		// does not count as a scan
-		// numScannedArchives += 1;
-		return;
+		MarkBroken("Unable to open archive");
+		return sa;
 	}
 
 	std::string error;
@@ -743,7 +814,7 @@ void CArchiveScanner::ScanArchive(const std::string& fullName, bool doChecksum)
 	const bool hasMapInfo = ar->FileExists("mapinfo.lua");
 
 
-	ArchiveInfo ai;
+	ArchiveInfo& ai = sa.archiveInfo;
 	ArchiveData& ad = ai.archiveData;
 
 	// execute the respective .lua, otherwise assume this archive is a map
@@ -762,20 +833,15 @@ void CArchiveScanner::ScanArchive(const std::string& fullName, bool doChecksum)
 		arMapFile = SearchMapFile(ar.get(), error);
 	}
 
+	// does count as a scan, whether broken or not
+	sa.isCounted = true;
+
 	if (!CheckCompression(ar.get(), fullName, error)) {
 		LOG_L(L_WARNING, "[AS::%s] failed to scan \"%s\" (%s)", __func__, fullName.c_str(), error.c_str());
 
 		// mark archive as broken, so we don't need to look inside everytime
-		BrokenArchive& ba = GetAddBrokenArchive(lcfn);
-		ba.name = lcfn;
-		ba.path = fpath;
-		ba.modified = modifiedTime;
-		ba.updated = true;
-		ba.problem = error;
-
-		// does count as a scan
-		numScannedArchives += 1;
-		return;
+		MarkBroken(error);
+		return sa;
 	}
 
 	if (hasMapInfo || !arMapFile.empty()) {
@@ -792,17 +858,17 @@ void CArchiveScanner::ScanArchive(const std::string& fullName, bool doChecksum)
 		AddDependency(ad.GetDependencies(), GetMapHelperContentName());
 		ad.SetInfoItemValueInteger("modType", modtype::map);
 
-		LOG_S(LOG_SECTION_ARCHIVESCANNER, "Found new map: %s", ad.GetNameVersioned().c_str());
+		sa.foundMessage = "Found new map: " + ad.GetNameVersioned();
 	} else if (hasModInfo) {
 		// game or base-type (cursors, bitmaps, ...) archive
 		// babysitting like this is really no longer required
 		if (ad.IsGame() || ad.IsMenu())
 			AddDependency(ad.GetDependencies(), GetSpringBaseContentName());
 
-		LOG_S(LOG_SECTION_ARCHIVESCANNER, "Found new game: %s", ad.GetNameVersioned().c_str());
+		sa.foundMessage = "Found new game: " + ad.GetNameVersioned();
 	} else {
 		// neither a map nor a mod: error
-		LOG_S(LOG_SECTION_ARCHIVESCANNER, "missing modinfo.lua/mapinfo.lua");
+		sa.foundMessage = "missing modinfo.lua/mapinfo.lua";
 	}
 
 	ai.path = fpath;
@@ -816,12 +882,43 @@ void CArchiveScanner::ScanArchive(const std::string& fullName, bool doChecksum)
 
 	ai.origName = fname;
 	ai.updated = true;
-	ai.hashed = doChecksum && GetArchiveChecksum(fullName, ai);
+	return sa;
+}
+
+void CArchiveScanner::AddScannedArchive(ScannedArchive&& sa)
+{
+	if (sa.exception != nullptr)
+		std::rethrow_exception(sa.exception);
 
-	archiveInfosIndex.emplace(lcfn, archiveInfos.size());
-	archiveInfos.emplace_back(std::move(ai));
+	numScannedArchives += static_cast<uint32_t>(sa.isCounted);
+
+	if (sa.isBroken) {
+		GetAddBrokenArchive(sa.lcfn) = std::move(sa.brokenArchive);
+		return;
+	}
+
+	// an archive of the same name was found earlier in the same ScanDirs pass
+	// (CheckCachedData could not see it yet); the first one wins, as it would
+	// in a serial scan
+	if (const auto aiIter = archiveInfosIndex.find(sa.lcfn); aiIter != archiveInfosIndex.end()) {
+		const ArchiveInfo& ai = archiveInfos[aiIter->second];
+
+		LOG_L(L_ERROR, "[AS::%s] found a \"%s\" already in \"%s\", ignoring.", __func__, sa.fullName.c_str(), (ai.path + ai.origName).c_str());
+
+		if (baseContentArchives.find(sa.lcfn) == baseContentArchives.end())
+			return;
+
+		throw user_error(
+			std::string("duplicate base content detected:\n\t") + ai.path +
+			std::string("\n\t") + sa.archiveInfo.path +
+			std::string("\nPlease fix your configuration/installation as this can cause desyncs!")
+		);
+	}
 
-	numScannedArchives += 1;
+	LOG_S(LOG_SECTION_ARCHIVESCANNER, "%s", sa.foundMessage.c_str());
+
+	archiveInfosIndex.emplace(sa.lcfn, archiveInfos.size());
+	archiveInfos.emplace_back(std::move(sa.archiveInfo));
 }
 
 
@@ -917,7 +1014,7 @@ bool CArchiveScanner::CheckCachedData(const std::string& fullName, uint32_t& mod
 }
 
 
-bool CArchiveScanner::ScanArchiveLua(IArchive* ar, const std::string& fileName, ArchiveInfo& ai, std::string& err)
+bool CArchiveScanner::ScanArchiveLua(IArchive* ar, const std::string& fileName, ArchiveInfo& ai, std::string& err) const
 {
 	std::vector<std::uint8_t> buf;
 
@@ -1125,7 +1222,7 @@ bool CArchiveScanner::GetArchiveChecksum(const std::string& archiveName, Archive
 }
 
 
-bool CArchiveScanner::ReadCacheData(const std::string& filename, bool loadOldVersion)
+bool CArchiveScanner::ReadLuaCacheData(const std::string& filename, bool loadOldVersion)
 {
 	std::lock_guard<decltype(scannerMutex)> lck(scannerMutex);
 	if (!FileSystem::FileExists(filename)) {
@@ -1238,6 +1335,317 @@ void FilterDep(std::vector<std::string>& deps, const std::string& exclude)
 	deps.erase(it, deps.end());
 }
 
+namespace {
+	// ArchiveCache%i.bin layout: header, then length-prefixed archives, broken
+	// archives and pool files; any mismatch makes ReadCache fall back to Lua
+	constexpr char BINARY_CACHE_MAGIC[8] = {'S', 'P', 'R', 'A', 'C', 'H', 'E', 'B'};
+	constexpr uint32_t BINARY_CACHE_VERSION = 1;
+
+	class CCacheWriter {
+	public:
+		template<typename T> void Write(const T& v) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			const auto* p = reinterpret_cast<const uint8_t*>(&v);
+			data.insert(data.end(), p, p + sizeof(T));
+		}
+		void WriteString(const std::string& s) {
+			Write(static_cast<uint32_t>(s.size()));
+			data.insert(data.end(), s.begin(), s.end());
+		}
+
+		const std::vector<uint8_t>& GetData() const { return data; }
+
+	private:
+		std::vector<uint8_t> data;
+	};
+
+	class CCacheReader {
+	public:
+		CCacheReader(std::span<const uint8_t> d): data(d) {}
+
+		template<typename T> bool Read(T& v) {
+			static_assert(std::is_trivially_copyable_v<T>);
+			if (sizeof(T) > (data.size() - pos))
+				return false;
+
+			std::memcpy(&v, data.data() + pos, sizeof(T));
+			pos += sizeof(T);
+			return true;
+		}
+		bool ReadString(std::string& s) {
+			uint32_t size = 0;
+			if (!Read(size) || size > (data.size() - pos))
+				return false;
+
+			s.assign(reinterpret_cast<const char*>(data.data() + pos), size);
+			pos += size;
+			return true;
+		}
+
+		bool AtEnd() const { return (pos == data.size()); }
+
+	private:
+		std::span<const uint8_t> data;
+		size_t pos = 0;
+	};
+}
+
+bool CArchiveScanner::ReadBinaryCacheData(const std::string& filename)
+{
+	std::lock_guard<decltype(scannerMutex)> lck(scannerMutex);
+
+	CFileView fileView;
+
+	if (!fileView.MapFile(filename)) {
+		LOG_L(L_INFO, "[AS::%s] ArchiveCache %s doesn't exist", __func__, filename.c_str());
+		return false;
+	}
+
+	CCacheReader reader(fileView.GetSpan());
+
+	const auto ReadFileInfoMap = [&reader](spring::unordered_map<std::string, FileInfo>& filesInfoMap) {
+		uint32_t numFiles = 0;
+
+		if (!reader.Read(numFiles))
+			return false;
+
+		filesInfoMap.reserve(filesInfoMap.size() + numFiles);
+
+		for (uint32_t j = 0; j < numFiles; j++) {
+			std::string fn;
+			FileInfo fi;
+
+			if (!reader.ReadString(fn) || !reader.Read(fi.size) || !reader.Read(fi.modTime) || !reader.Read(fi.checksum))
+				return false;
+
+			filesInfoMap.emplace(std::move(fn), fi);
+		}
+
+		return true;
+	};
+	const auto ReadArchiveData = [&reader](ArchiveData& ad) {
+		uint32_t numItems = 0;
+		uint32_t numDeps = 0;
+
+		if (!reader.Read(numItems))
+			return false;
+
+		for (uint32_t j = 0; j < numItems; j++) {
+			std::string key;
+			uint8_t valueType = 0;
+
+			if (!reader.ReadString(key) || !reader.Read(valueType))
+				return false;
+
+			switch (valueType) {
+				case INFO_VALUE_TYPE_STRING : { std::string v; if (!reader.ReadString(v)) return false; ad.SetInfoItemValueString (key, v); } break;
+				case INFO_VALUE_TYPE_INTEGER: { int32_t     v; if (!reader.Read      (v)) return false; ad.SetInfoItemValueInteger(key, v); } break;
+				case INFO_VALUE_TYPE_FLOAT  : { float       v; if (!reader.Read      (v)) return false; ad.SetInfoItemValueFloat  (key, v); } break;
+				case INFO_VALUE_TYPE_BOOL   : { uint8_t     v; if (!reader.Read      (v)) return false; ad.SetInfoItemValueBool   (key, v != 0); } break;
+				default                     : { return false; } break;
+			}
+		}
+
+		if (!reader.Read(numDeps))
+			return false;
+
+		for (uint32_t j = 0; j < numDeps; j++) {
+			if (!reader.ReadString(ad.GetDependencies().emplace_back()))
+				return false;
+		}
+
+		return true;
+	};
+
+	char magic[sizeof(BINARY_CACHE_MAGIC)];
+	uint32_t formatVersion = 0;
+	int32_t internalVersion = 0;
+
+	if (!reader.Read(magic) || std::memcmp(magic, BINARY_CACHE_MAGIC, sizeof(magic)) != 0)
+		return false;
+	if (!reader.Read(formatVersion) || formatVersion != BINARY_CACHE_VERSION)
+		return false;
+	if (!reader.Read(internalVersion) || internalVersion != INTERNAL_VER)
+		return false;
+
+	// parse everything before touching the scanner tables, a truncated
+	// or otherwise corrupt file must not leave them half-populated
+	std::vector<ArchiveInfo> cachedArchives;
+	std::vector<BrokenArchive> cachedBrokenArchives;
+	spring::unordered_map<std::string, FileInfo> cachedPoolFiles;
+
+	uint32_t numArchives = 0;
+	uint32_t numBrokenArchives = 0;
+
+	bool ok = true;
+
+	try {
+		ok = ok && reader.Read(numArchives);
+
+		for (uint32_t i = 0; ok && i < numArchives; i++) {
+			ArchiveInfo& ai = cachedArchives.emplace_back();
+
+			ok = ok && reader.ReadString(ai.origName) && reader.ReadString(ai.path);
+			ok = ok && reader.ReadString(ai.archiveDataPath);
+			ok = ok && reader.Read(ai.modified) && reader.Read(ai.modifiedArchiveData);
+			ok = ok && reader.Read(ai.checksum);
+			ok = ok && ReadFileInfoMap(ai.filesInfo);
+			ok = ok && ReadArchiveData(ai.archiveData);
+		}
+
+		ok = ok && reader.Read(numBrokenArchives);
+
+		for (uint32_t i = 0; ok && i < numBrokenArchives; i++) {
+			BrokenArchive& ba = cachedBrokenArchives.emplace_back();
+
+			ok = ok && reader.ReadString(ba.name) && reader.ReadString(ba.path);
+			ok = ok && reader.Read(ba.modified) && reader.ReadString(ba.problem);
+		}
+
+		ok = ok && ReadFileInfoMap(cachedPoolFiles);
+		ok = ok && reader.AtEnd();
+	} catch (const content_error& e) {
+		// reserved info-item keys
+		LOG_L(L_ERROR, "[AS::%s] %s", __func__, e.what());
+		ok = false;
+	}
+
+	if (!ok) {
+		LOG_L(L_ERROR, "[AS::%s] ArchiveCache %s is corrupt, ignoring it", __func__, filename.c_str());
+		return false;
+	}
+
+	for (ArchiveInfo& cai: cachedArchives) {
+		ArchiveInfo& ai = GetAddArchiveInfo(StringToLower(cai.origName));
+
+		ai = std::move(cai);
+		ai.updated = false;
+		ai.hashed = (ai.checksum != sha512::NULL_RAW_DIGEST);
+
+		if (ai.archiveData.IsMap()) {
+			AddDependency(ai.archiveData.GetDependencies(), GetMapHelperContentName());
+		} else if (ai.archiveData.IsGame()) {
+			AddDependency(ai.archiveData.GetDependencies(), GetSpringBaseContentName());
+		}
+	}
+
+	for (BrokenArchive& cba: cachedBrokenArchives) {
+		BrokenArchive& ba = GetAddBrokenArchive(cba.name);
+
+		ba = std::move(cba);
+		ba.updated = false;
+	}
+
+	for (auto& [fn, fi]: cachedPoolFiles) {
+		poolFilesInfo[fn] = fi;
+	}
+
+	isDirty = false;
+
+	return true;
+}
+
+bool CArchiveScanner::WriteBinaryCacheData(const std::string& filename) const
+{
+	CCacheWriter writer;
+
+	const auto WriteFileInfoMap = [&writer](const spring::unordered_map<std::string, FileInfo>& filesInfoMap) {
+		writer.Write(static_cast<uint32_t>(filesInfoMap.size()));
+
+		for (const auto& [fn, fi]: filesInfoMap) {
+			writer.WriteString(fn);
+			writer.Write(fi.size);
+			writer.Write(fi.modTime);
+			writer.Write(fi.checksum);
+		}
+	};
+	const auto WriteArchiveData = [&writer](const ArchiveData& ad) {
+		// same rules as the Lua cache: no name means no data at all, and
+		// the implicit base-content dependencies are re-added on reading
+		if (ad.GetName().empty()) {
+			writer.Write(uint32_t(0));
+			writer.Write(uint32_t(0));
+			return;
+		}
+
+		writer.Write(static_cast<uint32_t>(ad.GetInfo().size()));
+
+		for (const auto& [key, item]: ad.GetInfo()) {
+			writer.WriteString(key);
+			writer.Write(static_cast<uint8_t>(item.valueType));
+
+			switch (item.valueType) {
+				case INFO_VALUE_TYPE_STRING : { writer.WriteString(item.valueTypeString); } break;
+				case INFO_VALUE_TYPE_INTEGER: { writer.Write(static_cast<int32_t>(item.value.typeInteger)); } break;
+				case INFO_VALUE_TYPE_FLOAT  : { writer.Write(item.value.typeFloat); } break;
+				case INFO_VALUE_TYPE_BOOL   : { writer.Write(static_cast<uint8_t>(item.value.typeBool)); } break;
+			}
+		}
+
+		std::vector<std::string> deps = ad.GetDependencies();
+		if (ad.IsMap()) {
+			FilterDep(deps, GetMapHelperContentName());
+		} else if (ad.IsGame()) {
+			FilterDep(deps, GetSpringBaseContentName());
+		}
+
+		writer.Write(static_cast<uint32_t>(deps.size()));
+
+		for (const std::string& dep: deps) {
+			writer.WriteString(dep);
+		}
+	};
+
+	writer.Write(BINARY_CACHE_MAGIC);
+	writer.Write(BINARY_CACHE_VERSION);
+	writer.Write(static_cast<int32_t>(INTERNAL_VER));
+
+	writer.Write(static_cast<uint32_t>(archiveInfos.size()));
+
+	for (const ArchiveInfo& ai: archiveInfos) {
+		writer.WriteString(ai.origName);
+		writer.WriteString(ai.path);
+		writer.WriteString(ai.archiveDataPath);
+		writer.Write(ai.modified);
+		writer.Write(ai.modifiedArchiveData);
+		writer.Write(ai.checksum);
+
+		WriteFileInfoMap(ai.filesInfo);
+		WriteArchiveData(ai.archiveData);
+	}
+
+	writer.Write(static_cast<uint32_t>(brokenArchives.size()));
+
+	for (const BrokenArchive& ba: brokenArchives) {
+		writer.WriteString(ba.name);
+		writer.WriteString(ba.path);
+		writer.Write(ba.modified);
+		writer.WriteString(ba.problem);
+	}
+
+	WriteFileInfoMap(poolFilesInfo);
+
+	FILE* out = nowide::fopen(filename.c_str(), "wb");
+	if (out == nullptr) {
+		LOG_L(L_ERROR, "[AS::%s] failed to write to \"%s\"!", __func__, filename.c_str());
+		return false;
+	}
+
+	const std::vector<uint8_t>& data = writer.GetData();
+
+	const bool written = (fwrite(data.data(), 1, data.size(), out) == data.size());
+	const bool closed = (fclose(out) != EOF);
+
+	if (!written || !closed) {
+		LOG_L(L_ERROR, "[AS::%s] failed to write to \"%s\"!", __func__, filename.c_str());
+		// never leave a truncated cache behind
+		FileSystem::Remove(filename);
+		return false;
+	}
+
+	return true;
+}
+
 void CArchiveScanner::WriteCacheData(const std::string& filename)
 {
 	std::lock_guard<decltype(scannerMutex)> lck(scannerMutex);
@@ -1320,10 +1728,21 @@ void CArchiveScanner::WriteCacheData(const std::string& filename)
 		}
 	}
 
+	if (!WriteBinaryCacheData(filename))
+		return;
+
+	if (configHandler->GetBool("ArchiveCacheExportLua"))
+		WriteLuaCacheData(luaCacheFile);
+
+	isDirty = false;
+}
+
+bool CArchiveScanner::WriteLuaCacheData(const std::string& filename) const
+{
 	FILE* out = nowide::fopen(filename.c_str(), "wt");
 	if (out == nullptr) {
 		LOG_L(L_ERROR, "[AS::%s] failed to write to \"%s\"!", __func__, filename.c_str());
-		return;
+		return false;
 	}
 
 	auto WriteFileInfoMapBody = [out](const spring::unordered_map<std::string, FileInfo>& filesInfoMap, size_t numTabs) {
@@ -1421,10 +1840,12 @@ void CArchiveScanner::WriteCacheData(const std::string& filename)
 	fprintf(out, "}\n\n"); // close 'archiveCache'
 	fprintf(out, "return archiveCache\n");
 
-	if (fclose(out) == EOF)
+	if (fclose(out) == EOF) {
 		LOG_L(L_ERROR, "[AS::%s] failed to write to \"%s\"!", __func__, filename.c_str());
+		return false;
+	}
 
-	isDirty = false;
+	return true;
 }
 
 
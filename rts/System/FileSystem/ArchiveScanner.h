@@ -8,6 +8,7 @@
 #include <deque>
 #include <vector>
 #include <atomic>
+#include <exception>
 
 #include "System/Info.h"
 #include "System/Sync/SHA512.hpp"
@@ -195,6 +196,20 @@ private:
 		uint32_t modified = 0;
 		bool updated = false;
 	};
+	/// outcome of opening and parsing one archive, see ReadArchive
+	struct ScannedArchive {
+		std::string fullName;
+		std::string lcfn;
+		std::string foundMessage;
+
+		ArchiveInfo archiveInfo;
+		BrokenArchive brokenArchive;
+
+		std::exception_ptr exception;
+
+		bool isBroken = false;
+		bool isCounted = false; // towards numScannedArchives
+	};
 
 private:
 	void ReadCache();
@@ -205,17 +220,30 @@ private:
 	void ScanDirs(const std::vector<std::string>& dirs);
 	void ScanDir(const std::string& curPath, std::deque<std::string>& foundArchives);
 
+	/**
+	 * Opens and parses an archive without touching any scanner state,
+	 * so it is safe to call for different archives concurrently.
+	 */
+	ScannedArchive ReadArchive(const std::string& fullName, uint32_t modified) const;
+	/// records the result of ReadArchive, must be called serially
+	void AddScannedArchive(ScannedArchive&& sa);
+
 	/// scan mapinfo / modinfo lua files
-	bool ScanArchiveLua(IArchive* ar, const std::string& fileName, ArchiveInfo& ai, std::string& err);
+	bool ScanArchiveLua(IArchive* ar, const std::string& fileName, ArchiveInfo& ai, std::string& err) const;
 
 	/**
 	 * scan archive for map file
 	 * @return file name if found, empty string if not
 	 */
-	std::string SearchMapFile(const IArchive* ar, std::string& error);
+	std::string SearchMapFile(const IArchive* ar, std::string& error) const;
 
 
-	bool ReadCacheData(const std::string& filename, bool loadOldVersion = false);
+	/// binary cache (ArchiveCache<version>.bin), read through a file mapping
+	bool ReadBinaryCacheData(const std::string& filename);
+	bool WriteBinaryCacheData(const std::string& filename) const;
+	/// Lua cache, only read if no (valid) binary cache exists
+	bool ReadLuaCacheData(const std::string& filename, bool loadOldVersion = false);
+	bool WriteLuaCacheData(const std::string& filename) const;
 	void WriteCacheData(const std::string& filename);
 
 	IFileFilter* CreateIgnoreFilter(IArchive* ar);
@@ -260,6 +288,7 @@ private:
 	std::vector<BrokenArchive> brokenArchives;
 
 	std::string cacheFile;
+	std::string luaCacheFile;
 
 	bool isDirty = false;
 	bool isInScan = false;
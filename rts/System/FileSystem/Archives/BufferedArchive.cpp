@@ -14,11 +14,14 @@ CBufferedArchive::~CBufferedArchive()
 	uint32_t fileCount = 0;
 
 	for (const auto& [numAccessed, gotBuffered, fileData] : fileCache) {
+		if (fileData == nullptr)
+			continue;
+
 		if (gotBuffered) {
-			cachedSize += fileData.size();
+			cachedSize += fileData->size();
 			fileCount++;
 		} else {
-			uncachedSize += fileData.size();
+			uncachedSize += fileData->size();
 		}
 	}
 
@@ -29,6 +32,25 @@ CBufferedArchive::~CBufferedArchive()
 	);
 }
 
+bool CBufferedArchive::UseCache() const
+{
+	return (globalConfig.vfsCacheArchiveFiles && !noCache);
+}
+
+void CBufferedArchive::ReserveCache()
+{
+	// NumFiles is virtual, can't do this in ctor
+	std::scoped_lock lck(mutex);
+	if (fileCache.empty())
+		fileCache.resize(NumFiles());
+}
+
+void CBufferedArchive::LogReadError(const char* func, uint32_t fid, int ret, size_t size) const
+{
+	LOG_L(L_ERROR, "[BufferedArchive::%s(fid=%u)][noCache=%d,vfsCache=%d] name=%s ret=%d size=" _STPF_, func, fid, static_cast<int>(noCache), static_cast<int>(globalConfig.vfsCacheArchiveFiles), archiveFile.c_str(), ret, size);
+}
+
+
 bool CBufferedArchive::GetFile(uint32_t fid, std::vector<std::uint8_t>& buffer)
 {
 	assert(IsFileId(fid));
@@ -37,19 +59,14 @@ bool CBufferedArchive::GetFile(uint32_t fid, std::vector<std::uint8_t>& buffer)
 
 	auto scopedSemAcq = AcquireSemaphoreScoped();
 
-	if (!globalConfig.vfsCacheArchiveFiles || noCache) {
+	if (!UseCache()) {
 		if ((ret = GetFileImpl(fid, buffer)) != 1)
-			LOG_L(L_ERROR, "[BufferedArchive::%s(fid=%u)][noCache=%d,vfsCache=%d] name=%s ret=%d size=" _STPF_, __func__, fid, static_cast<int>(noCache), static_cast<int>(globalConfig.vfsCacheArchiveFiles), archiveFile.c_str(), ret, buffer.size());
+			LogReadError(__func__, fid, ret, buffer.size());
 
 		return (ret == 1);
 	}
 
-	// NumFiles is virtual, can't do this in ctor
-	{
-		std::scoped_lock lck(mutex);
-		if (fileCache.empty())
-			fileCache.resize(NumFiles());
-	}
+	ReserveCache();
 
 	// numAccessed/gotBuffered are not atomic, and simultaneous access to the same fid will cause issues
 	// however, the access pattern is such that each thread accesses a different fid, so this should be fine
@@ -58,17 +75,61 @@ bool CBufferedArchive::GetFile(uint32_t fid, std::vector<std::uint8_t>& buffer)
 	numAccessed++;
 
 	if (gotBuffered) {
-		buffer.assign(fileData.begin(), fileData.end());
+		buffer.assign(fileData->begin(), fileData->end());
 		return true;
 	}
 
 	if ((ret = GetFileImpl(fid, buffer)) != 1)
-		LOG_L(L_ERROR, "[BufferedArchive::%s(fid=%u)][noCache=%d,vfsCache=%d] name=%s ret=%d size=" _STPF_, __func__, fid, static_cast<int>(noCache), static_cast<int>(globalConfig.vfsCacheArchiveFiles), archiveFile.c_str(), ret, buffer.size());
+		LogReadError(__func__, fid, ret, buffer.size());
 
 	if (numAccessed == 2 && (ret == 1)) {
-		fileData.assign(buffer.begin(), buffer.end());
+		fileData = std::make_shared<const std::vector<uint8_t>>(buffer.begin(), buffer.end());
 		gotBuffered = true;
 	}
-	
+
+	return (ret == 1);
+}
+
+bool CBufferedArchive::GetFileView(uint32_t fid, CFileView& view)
+{
+	assert(IsFileId(fid));
+
+	std::vector<std::uint8_t> buffer;
+	int ret = 0;
+
+	auto scopedSemAcq = AcquireSemaphoreScoped();
+
+	if (!UseCache()) {
+		if ((ret = GetFileImpl(fid, buffer)) != 1)
+			LogReadError(__func__, fid, ret, buffer.size());
+
+		view.SetOwned(std::move(buffer));
+		return (ret == 1);
+	}
+
+	ReserveCache();
+
+	auto& [numAccessed, gotBuffered, fileData] = fileCache[fid];
+
+	numAccessed++;
+
+	// unlike GetFile, hand out the cached data itself rather than a copy
+	if (gotBuffered) {
+		view.SetShared(fileData);
+		return true;
+	}
+
+	if ((ret = GetFileImpl(fid, buffer)) != 1)
+		LogReadError(__func__, fid, ret, buffer.size());
+
+	if (numAccessed == 2 && (ret == 1)) {
+		fileData = std::make_shared<const std::vector<uint8_t>>(std::move(buffer));
+		gotBuffered = true;
+
+		view.SetShared(fileData);
+		return true;
+	}
+
+	view.SetOwned(std::move(buffer));
 	return (ret == 1);
 }
@@ -3,6 +3,7 @@
 #ifndef _BUFFERED_ARCHIVE_H
 #define _BUFFERED_ARCHIVE_H
 
+#include <memory>
 #include <tuple>
 
 #include "IArchive.h"
@@ -24,12 +25,18 @@ public:
 	int GetType() const override { return ARCHIVE_TYPE_BUF; }
 
 	bool GetFile(uint32_t fid, std::vector<std::uint8_t>& buffer) override;
+	bool GetFileView(uint32_t fid, CFileView& view) override;
 
 protected:
 	virtual int GetFileImpl(uint32_t fid, std::vector<std::uint8_t>& buffer) = 0;
 
-	// indexed by file-id
-	std::vector<std::tuple<uint32_t, bool, std::vector<uint8_t>>> fileCache = {};
+	// indexed by file-id; cached data is shared with any views handed out
+	std::vector<std::tuple<uint32_t, bool, std::shared_ptr<const std::vector<uint8_t>>>> fileCache = {};
+private:
+	bool UseCache() const;
+	void ReserveCache();
+	void LogReadError(const char* func, uint32_t fid, int ret, size_t size) const;
+
 private:
 	spring::spinlock mutex;
 	bool noCache = false;
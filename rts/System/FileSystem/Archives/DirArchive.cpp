@@ -72,6 +72,21 @@ bool CDirArchive::GetFile(uint32_t fid, std::vector<std::uint8_t>& buffer)
 	return true;
 }
 
+bool CDirArchive::GetFileView(uint32_t fid, CFileView& view)
+{
+	assert(IsFileId(fid));
+
+	if (FileSize(fid) >= MIN_MAPPED_FILE_SIZE) {
+		auto scopedSemAcq = AcquireSemaphoreScoped();
+
+		if (view.MapFile(files[fid].rawFileName))
+			return true;
+	}
+
+	// small or unmappable file, read it into a private buffer instead
+	return (IArchive::GetFileView(fid, view));
+}
+
 const std::string& CDirArchive::FileName(uint32_t fid) const
 {
 	return files[fid].fileName;
@@ -37,10 +37,15 @@ public:
 
 	uint32_t NumFiles() const override { return (files.size()); }
 	bool GetFile(uint32_t fid, std::vector<std::uint8_t>& buffer) override;
+	bool GetFileView(uint32_t fid, CFileView& view) override;
 	const std::string& FileName(uint32_t fid) const override;
 	int32_t FileSize(uint32_t fid) const override;
 	SFileInfo FileInfo(uint32_t fid) const override;
 private:
+	/// files smaller than this are read rather than mapped, the
+	/// syscall and page-fault overhead is not worth it for them
+	static constexpr int32_t MIN_MAPPED_FILE_SIZE = 64 * 1024;
+
 	/// "ExampleArchive.sdd/"
 	const std::string dirName;
 
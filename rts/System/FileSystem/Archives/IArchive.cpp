@@ -35,6 +35,27 @@ bool IArchive::GetFile(const std::string& name, std::vector<std::uint8_t>& buffe
 	return true;
 }
 
+bool IArchive::GetFileView(uint32_t fid, CFileView& view)
+{
+	std::vector<std::uint8_t> buffer;
+
+	if (!GetFile(fid, buffer))
+		return false;
+
+	view.SetOwned(std::move(buffer));
+	return true;
+}
+
+bool IArchive::GetFileView(const std::string& name, CFileView& view)
+{
+	const uint32_t fid = FindFile(name);
+
+	if (!IsFileId(fid))
+		return false;
+
+	return (GetFileView(fid, view));
+}
+
 bool IArchive::CalcHash(uint32_t fid, sha512::raw_digest& hash, std::vector<std::uint8_t>& fb)
 {
 	// NOTE: should be possible to avoid a re-read for buffered archives
@@ -10,6 +10,7 @@
 #include <semaphore>
 
 #include "ArchiveTypes.h"
+#include "System/FileSystem/FileView.h"
 #include "System/Sync/SHA512.hpp"
 #include "System/ScopedResource.h"
 #include "System/UnorderedMap.hpp"
@@ -90,6 +91,18 @@ public:
 	 */
 	bool GetFile(const std::string& name, std::vector<std::uint8_t>& buffer);
 
+	/**
+	 * Fetches a read-only view of the content of a file by its ID.
+	 * Archives that can hand out their data without a private copy
+	 * (memory-mapped loose files, already cached entries) override
+	 * this; the default reads the file via GetFile.
+	 * @param fid file ID in [0, NumFiles())
+	 * @return true if the file was found and its contents are viewable
+	 * @see GetFile(uint32_t fid, std::vector<std::uint8_t>& buffer)
+	 */
+	virtual bool GetFileView(uint32_t fid, CFileView& view);
+	bool GetFileView(const std::string& name, CFileView& view);
+
 	uint32_t ExtractedSize() const {
 		uint32_t size = 0;
 
@@ -95,13 +95,17 @@ bool CFileHandler::TryReadFromVFS(const string& fileName, int section)
 	if (vfsHandler == nullptr)
 		return (loadCode = -2, false);
 
-	if ((loadCode = vfsHandler->LoadFile(StringToLower(fileName), fileBuffer, (CVFSHandler::Section) section)) == 1) {
-		// capacity can exceed size if FH was used to open more than one file
-		// assert(fileBuffer.size() == fileBuffer.capacity());
+	if ((loadCode = vfsHandler->LoadFileView(StringToLower(fileName), fileView, (CVFSHandler::Section) section)) == 1) {
+		fileSize = fileView.size();
+
+		// privately owned data gains nothing from staying in the view
+		if (fileView.IsOwned())
+			fileView.Release(fileBuffer);
 
-		fileSize = fileBuffer.size();
 		return true;
 	}
+
+	fileView.Reset();
 #endif
 	return false;
 }
@@ -133,6 +137,7 @@ void CFileHandler::Close()
 
 	ifs.close();
 	fileBuffer.clear();
+	fileView.Reset();
 }
 
 
@@ -176,15 +181,17 @@ int CFileHandler::Read(void* buf, int length)
 		return ifs.gcount();
 	}
 
-	if (fileBuffer.empty())
+	if (!IsBuffered())
 		return 0;
 
 	if ((length + filePos) > fileSize)
 		length = fileSize - filePos;
 
 	if (length > 0) {
-		assert(fileBuffer.size() >= (filePos + length));
-		memcpy(buf, &fileBuffer[filePos], length);
+		const std::span<const std::uint8_t> data = GetSpan();
+
+		assert(data.size() >= (filePos + length));
+		memcpy(buf, &data[filePos], length);
 		filePos += length;
 	}
 
@@ -221,7 +228,7 @@ void CFileHandler::Seek(int length, std::ios_base::seekdir where)
 		ifs.seekg(length, where);
 		return;
 	}
-	if (fileBuffer.empty())
+	if (!IsBuffered())
 		return;
 
 	switch (where) {
@@ -237,7 +244,7 @@ bool CFileHandler::Eof() const
 	if (ifs.is_open())
 		return ifs.eof();
 
-	if (!fileBuffer.empty())
+	if (IsBuffered())
 		return (filePos >= fileSize);
 
 	return true;
@@ -4,10 +4,12 @@
 #define _FILE_HANDLER_H
 
 #include <vector>
+#include <span>
 #include <string>
 #include <cinttypes>
 #include <nowide/fstream.hpp>
 
+#include "FileView.h"
 #include "VFSModes.h"
 
 /**
@@ -38,7 +40,7 @@ public:
 	// true if any of TryReadFrom{RawFS,PWD,VFS} succeed
 	bool FileExists() const { return (fileSize >= 0); }
 	// true if (and only if) TryReadFromVFS succeeds
-	bool IsBuffered() const { return (!fileBuffer.empty()); }
+	bool IsBuffered() const { return (!fileBuffer.empty() || !fileView.empty()); }
 
 	bool Eof() const;
 	int GetPos();
@@ -50,7 +52,24 @@ public:
 	static std::string GetFileAbsolutePath(const std::string& filePath, const std::string& modes);
 	static std::string GetArchiveContainingFile(const std::string& filePath, const std::string& modes);
 
-	std::vector<std::uint8_t>& GetBuffer() { return fileBuffer; }
+	/**
+	 * Contents of a buffered (VFS) file as a modifiable vector; if the data is
+	 * still held by a mapped or shared view it is copied out first. Prefer
+	 * GetSpan for read-only access.
+	 */
+	std::vector<std::uint8_t>& GetBuffer() {
+		if (!fileView.empty())
+			fileView.Release(fileBuffer);
+
+		return fileBuffer;
+	}
+	/// read-only contents of a buffered (VFS) file, valid while this handler is open
+	std::span<const std::uint8_t> GetSpan() const {
+		if (!fileView.empty())
+			return fileView.GetSpan();
+
+		return fileBuffer;
+	}
 
 	static bool InReadDir(const std::string& path);
 	static bool InWriteDir(const std::string& path);
@@ -78,6 +97,8 @@ protected:
 	std::string fileName;
 	nowide::ifstream ifs;
 	std::vector<std::uint8_t> fileBuffer;
+	// VFS contents that did not need a private copy (mapped or cached)
+	CFileView fileView;
 
 	int filePos = 0;
 	int fileSize = -1;
@@ -0,0 +1,157 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include "FileView.h"
+
+#include <utility>
+
+#ifdef _WIN32
+	#include <windows.h>
+	#include <nowide/convert.hpp>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+
+CFileView& CFileView::operator = (CFileView&& v) noexcept
+{
+	if (this == &v)
+		return *this;
+
+	Reset();
+
+	// moving the vector keeps its storage, so viewData stays valid
+	ownedData = std::move(v.ownedData);
+	sharedData = std::move(v.sharedData);
+
+	viewData = std::exchange(v.viewData, nullptr);
+	viewSize = std::exchange(v.viewSize, 0);
+	mapHandle = std::exchange(v.mapHandle, nullptr);
+	backing = std::exchange(v.backing, BACKING_NONE);
+	return *this;
+}
+
+
+bool CFileView::MapFile(const std::string& filePath)
+{
+	Reset();
+
+#ifdef _WIN32
+	HANDLE fileHandle = CreateFileW(nowide::widen(filePath).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+	if (fileHandle == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER fileSize;
+
+	// zero-sized files can not be mapped
+	if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0) {
+		CloseHandle(fileHandle);
+		return false;
+	}
+
+	HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	// the mapping keeps its own reference to the file
+	CloseHandle(fileHandle);
+
+	if (mappingHandle == nullptr)
+		return false;
+
+	const void* mapData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+	if (mapData == nullptr) {
+		CloseHandle(mappingHandle);
+		return false;
+	}
+
+	mapHandle = mappingHandle;
+	viewSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+	const int fd = open(filePath.c_str(), O_RDONLY);
+
+	if (fd < 0)
+		return false;
+
+	struct stat info;
+
+	// zero-sized files can not be mapped
+	if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+		close(fd);
+		return false;
+	}
+
+	void* mapData = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	// the mapping keeps its own reference to the file
+	close(fd);
+
+	if (mapData == MAP_FAILED)
+		return false;
+
+	// consumers almost always read front to back
+	madvise(mapData, info.st_size, MADV_SEQUENTIAL);
+
+	viewSize = static_cast<size_t>(info.st_size);
+#endif
+
+	viewData = static_cast<const std::uint8_t*>(mapData);
+	backing = BACKING_MAPPED;
+	return true;
+}
+
+void CFileView::SetOwned(std::vector<std::uint8_t>&& buffer)
+{
+	Reset();
+
+	ownedData = std::move(buffer);
+	viewData = ownedData.data();
+	viewSize = ownedData.size();
+	backing = BACKING_OWNED;
+}
+
+void CFileView::SetShared(std::shared_ptr<const std::vector<std::uint8_t>> buffer)
+{
+	Reset();
+
+	if (buffer == nullptr)
+		return;
+
+	sharedData = std::move(buffer);
+	viewData = sharedData->data();
+	viewSize = sharedData->size();
+	backing = BACKING_SHARED;
+}
+
+void CFileView::Reset()
+{
+	if (backing == BACKING_MAPPED) {
+	#ifdef _WIN32
+		UnmapViewOfFile(viewData);
+		CloseHandle(static_cast<HANDLE>(mapHandle));
+	#else
+		munmap(const_cast<std::uint8_t*>(viewData), viewSize);
+	#endif
+	}
+
+	ownedData = {};
+	sharedData.reset();
+
+	viewData = nullptr;
+	viewSize = 0;
+	mapHandle = nullptr;
+	backing = BACKING_NONE;
+}
+
+void CFileView::Release(std::vector<std::uint8_t>& buffer)
+{
+	if (backing == BACKING_OWNED) {
+		buffer = std::move(ownedData);
+	} else {
+		buffer.assign(viewData, viewData + viewSize);
+	}
+
+	Reset();
+}
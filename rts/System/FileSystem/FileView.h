@@ -0,0 +1,81 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef _FILE_VIEW_H
+#define _FILE_VIEW_H
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+/**
+ * Read-only view of the contents of a (VFS) file.
+ *
+ * The bytes are backed by one of
+ *  - a private buffer owned by the view (e.g. a freshly decompressed entry)
+ *  - a buffer shared with an archive's file-cache, which is kept alive by
+ *    the view even if the archive goes away
+ *  - a read-only memory-mapping of a file on disk (loose files in *.sdd)
+ * so consumers that only need to read can do so without another full-size
+ * copy. Views are move-only; the underlying data stays valid until the view
+ * is Reset, Released or destroyed.
+ */
+class CFileView
+{
+public:
+	CFileView() = default;
+	CFileView(const CFileView&) = delete;
+	CFileView(CFileView&& v) noexcept { *this = std::move(v); }
+	~CFileView() { Reset(); }
+
+	CFileView& operator = (const CFileView&) = delete;
+	CFileView& operator = (CFileView&& v) noexcept;
+
+	/**
+	 * Maps the file at (absolute or working-dir relative) filePath read-only.
+	 * @return false if the file could not be opened or mapped, the view is
+	 *   left empty in this case and callers should fall back to reading
+	 */
+	bool MapFile(const std::string& filePath);
+
+	void SetOwned(std::vector<std::uint8_t>&& buffer);
+	void SetShared(std::shared_ptr<const std::vector<std::uint8_t>> buffer);
+	void Reset();
+
+	/**
+	 * Hands the viewed bytes over to buffer (moved if the view owns them,
+	 * copied otherwise) and leaves the view empty.
+	 */
+	void Release(std::vector<std::uint8_t>& buffer);
+
+	std::span<const std::uint8_t> GetSpan() const { return {viewData, viewSize}; }
+
+	const std::uint8_t* data() const { return viewData; }
+	size_t size() const { return viewSize; }
+
+	bool empty() const { return (viewSize == 0); }
+	bool IsOwned() const { return (backing == BACKING_OWNED); }
+	bool IsMapped() const { return (backing == BACKING_MAPPED); }
+
+private:
+	enum Backing {
+		BACKING_NONE   = 0,
+		BACKING_OWNED  = 1,
+		BACKING_SHARED = 2,
+		BACKING_MAPPED = 3,
+	};
+
+	std::vector<std::uint8_t> ownedData;
+	std::shared_ptr<const std::vector<std::uint8_t>> sharedData;
+
+	const std::uint8_t* viewData = nullptr;
+	size_t viewSize = 0;
+
+	// platform handle of the mapping object, only used on Windows
+	void* mapHandle = nullptr;
+
+	Backing backing = BACKING_NONE;
+};
+
+#endif // _FILE_VIEW_H
@@ -64,9 +64,13 @@ bool CGZFileHandler::ReadToBuffer(const std::string& path)
 
 bool CGZFileHandler::UncompressBuffer()
 {
-	std::vector<std::uint8_t> compressed;
-	std::swap(compressed, fileBuffer);
+	std::vector<std::uint8_t> compressedBuffer;
+	std::swap(compressedBuffer, fileBuffer);
 
+	// VFS data may still be held by a (mapped) view, inflate straight from it
+	CFileView compressedView = std::move(fileView);
+
+	const std::span<const std::uint8_t> compressed = compressedView.empty()? std::span<const std::uint8_t>(compressedBuffer): compressedView.GetSpan();
 
 	z_stream zstream;
 	zstream.opaque = Z_NULL;
@@ -77,7 +81,7 @@ bool CGZFileHandler::UncompressBuffer()
 	//+16 marks it's a gzip header
 	inflateInit2(&zstream, 15 + 16);
 
-	zstream.next_in   = &compressed[0];
+	zstream.next_in   = const_cast<std::uint8_t*>(compressed.data());
 	zstream.avail_in  = compressed.size();
 
 	std::uint8_t unzipBuffer[BUFFER_SIZE];
@@ -11,6 +11,7 @@
 #include "System/UnorderedMap.hpp"
 
 class IArchive;
+class CFileView;
 
 /**
  * Main API for accessing the Virtual File System (VFS).
@@ -104,6 +105,15 @@ public:
 	 */
 	int LoadFile(const std::string& filePath, std::vector<std::uint8_t>& buffer, Section section);
 
+	/**
+	 * Like LoadFile, but provides a read-only view of the contents which
+	 * avoids a private copy when the archive can map or share its data.
+	 * @param filePath raw file path, for example "maps/myMap.smf",
+	 *   case-insensitive
+	 * @return 1 if the file exists in the VFS and was successfully read
+	 */
+	int LoadFileView(const std::string& filePath, CFileView& view, Section section);
+
 
 	/**
 	 * Returns all the files in the given (virtual) directory without the
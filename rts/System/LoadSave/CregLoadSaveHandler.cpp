@@ -53,6 +53,10 @@
 #define MAX_STRING_SIZE (1 << 19) // 512kB excluding null-term
 
 
+size_t CCregLoadSaveHandler::lastSaveSize = 0;
+std::future<void> CCregLoadSaveHandler::lastSaveWrite;
+
+
 CCregLoadSaveHandler::CCregLoadSaveHandler()
 {}
 
@@ -251,7 +255,7 @@ static void LoadLuaState(CSplitLuaHandle* handle, creg::CInputStreamSerializer&
 }
 
 
-void CCregLoadSaveHandler::SaveGame(const std::string& path)
+bool CCregLoadSaveHandler::SaveGame(const std::string& path)
 {
 #ifdef USING_CREG
 	LOG("[LSH::%s] saving game to \"%s\"", __func__, path.c_str());
@@ -263,6 +267,13 @@ void CCregLoadSaveHandler::SaveGame(const std::string& path)
 	try {
 		std::stringstream oss;
 
+		{
+			// pre-size the buffer so the stream does not repeatedly grow (and copy) itself
+			std::string buffer;
+			buffer.reserve(lastSaveSize + (lastSaveSize >> 3));
+			oss.str(std::move(buffer));
+		}
+
 		// write our own header. SavePackage() will add its own
 		WriteString(oss, SpringVersion::GetSync());
 		WriteString(oss, gameSetup->setupText);
@@ -304,26 +315,43 @@ void CCregLoadSaveHandler::SaveGame(const std::string& path)
 		}
 
 		{
-			gzFile file = gzopen(dataDirsAccess.LocateFile(path, FileQueryFlags::WRITE).c_str(), "wb5");
+			// take ownership of the stream's buffer instead of copying it; from
+			// here on the sim thread is done and compression plus disk I/O run
+			// in the background
+			std::string data = std::move(oss).str();
+			std::string filePath = dataDirsAccess.LocateFile(path, FileQueryFlags::WRITE);
+
+			lastSaveSize = data.size();
+
+			// saves issued in quick succession may target the same file
+			if (lastSaveWrite.valid())
+				lastSaveWrite.wait();
+
+			// open here so failures reach the caller instead of the background job
+			gzFile file = gzopen(filePath.c_str(), "wb5");
 
 			if (file == nullptr) {
-				LOG_L(L_ERROR, "[LSH::%s] could not open save-file", __func__);
-				return;
+				LOG_L(L_ERROR, "[LSH::%s] could not open save-file \"%s\"", __func__, filePath.c_str());
+				return false;
 			}
 
-			std::string data = oss.str();
-			std::function<void(gzFile, std::string&&)> func = [](gzFile file, std::string&& data) {
+			std::promise<void> writeDone;
+			lastSaveWrite = writeDone.get_future();
+
+			auto func = [file, data = std::move(data), writeDone = std::move(writeDone)]() mutable {
 				gzwrite(file, data.c_str(), data.size());
 				gzflush(file, Z_FINISH);
 				gzclose(file);
+
+				writeDone.set_value();
 			};
 
-			// gzFile is just a plain typedef (struct gzFile_s {}* gzFile), can be copied
 			// need to keep a reference to the future around or its destructor will block
-			ThreadPool::AddExtJob(std::move(std::async(std::launch::async, std::move(func), file, std::move(data))));
+			ThreadPool::AddExtJob(std::move(std::async(std::launch::async, std::move(func))));
 		}
 
 		//FIXME add lua state
+		return true;
 	} catch (const content_error& ex) {
 		LOG_L(L_ERROR, "[LSH::%s] content error \"%s\"", __func__, ex.what());
 	} catch (const std::exception& ex) {
@@ -338,6 +366,8 @@ void CCregLoadSaveHandler::SaveGame(const std::string& path)
 #else //USING_CREG
 	LOG_L(L_ERROR, "[LSH::%s] creg is disabled", __func__);
 #endif //USING_CREG
+
+	return false;
 }
 
 /// loads the data (map&mod-name,setup-script) needed by PreGame
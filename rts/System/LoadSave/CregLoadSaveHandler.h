@@ -3,6 +3,7 @@
 #ifndef CREG_LOAD_SAVE_HANDLER_H
 #define CREG_LOAD_SAVE_HANDLER_H
 
+#include <future>
 #include <string>
 #include <sstream>
 #include "LoadSaveHandler.h"
@@ -16,10 +17,16 @@ public:
 	bool LoadGameStartInfo(const std::string& path) override;
 	void LoadGame() override;
 	void LoadAIData() override;
-	void SaveGame(const std::string& path) override;
+	bool SaveGame(const std::string& path) override;
 
 protected:
 	std::stringstream iss;
+
+	// handlers are created per save, so this state is shared between them;
+	// the size of the previous save pre-sizes the serialization buffer and
+	// a new save waits for the previous background write to close its file
+	static size_t lastSaveSize;
+	static std::future<void> lastSaveWrite;
 };
 
 #endif // CREG_LOAD_SAVE_HANDLER_H
@@ -208,16 +208,12 @@ void CDemoRecorder::SetPlayerStats(int playerNum, const PlayerStatistics& stats)
 }
 
 /** @brief Set (overwrite) the TeamStatistics history for team teamNum */
-void CDemoRecorder::SetTeamStats(int teamNum, const std::vector<TeamStatistics>& stats)
+void CDemoRecorder::SetTeamStats(int teamNum, const CTeamStatisticsHistory& stats)
 {
 	assert((unsigned)teamNum < teamStats.size()); //FIXME
 
-	teamStats[teamNum].clear();
-	teamStats[teamNum].reserve(stats.size());
-
-	for (const auto& stat: stats) {
-		teamStats[teamNum].push_back(stat);
-	}
+	// the encoded history is compact, entries are only expanded while writing
+	teamStats[teamNum] = stats;
 }
 
 
@@ -294,17 +290,20 @@ void CDemoRecorder::WriteTeamStats()
 	const size_t pos = demoStreams[isServerDemo].size();
 
 	// Write array of dwords indicating number of TeamStatistics per team.
-	for (std::vector<TeamStatistics>& history: teamStats) {
-		unsigned int c = swabDWord(history.size());
+	for (const auto& history: teamStats) {
+		unsigned int c = swabDWord(history.has_value()? history->size(): 0);
 		demoStreams[isServerDemo].append(reinterpret_cast<const char*>(&c), sizeof(unsigned int));
 	}
 
-	// Write big array of TeamStatistics.
-	for (std::vector<TeamStatistics>& history: teamStats) {
-		for (TeamStatistics& stats: history) {
+	// Write big array of TeamStatistics, decoding one entry at a time.
+	for (const auto& history: teamStats) {
+		if (!history.has_value())
+			continue;
+
+		history->ForEach(0, history->size(), [&](size_t, TeamStatistics stats) {
 			stats.swab();
 			demoStreams[isServerDemo].append(reinterpret_cast<const char*>(&stats), sizeof(TeamStatistics));
-		}
+		});
 	}
 
 	fileHeader.teamStatSize = int(demoStreams[isServerDemo].size() - pos);
@@ -3,6 +3,7 @@
 #ifndef DEMO_RECORDER
 #define DEMO_RECORDER
 
+#include <optional>
 #include <vector>
 #include <sstream>
 #include <zlib.h>
@@ -59,7 +60,7 @@ public:
 	void AddNewPlayer(const std::string& name, int playerNum);
 	void InitializeStats(int numPlayers, int numTeams);
 	void SetPlayerStats(int playerNum, const PlayerStatistics& stats);
-	void SetTeamStats(int teamNum, const std::vector<TeamStatistics>& stats);
+	void SetTeamStats(int teamNum, const CTeamStatisticsHistory& stats);
 	void SetWinningAllyTeams(const std::vector<unsigned char>& winningAllyTeams);
 
 private:
@@ -74,7 +75,8 @@ private:
 	gzFile file = nullptr;
 
 	std::vector<PlayerStatistics> playerStats;
-	std::vector< std::vector<TeamStatistics> > teamStats;
+	// teams without stats set get an empty history
+	std::vector< std::optional<CTeamStatisticsHistory> > teamStats;
 	std::vector<unsigned char> winningAllyTeams;
 
 	bool isServerDemo = false;
@@ -39,10 +39,14 @@ bool ILoadSaveHandler::CreateSave(
 	ILoadSaveHandler* ls = CreateHandler(saveFile);
 
 	ls->SaveInfo(gameSetup->mapName, gameSetup->mapName);
-	ls->SaveGame(saveFile);
-	LOG("[ILoadSaveHandler::%s] saved game to file \"%s\"", __func__, saveFile.c_str());
+
+	const bool saved = ls->SaveGame(saveFile);
+
+	if (saved)
+		LOG("[ILoadSaveHandler::%s] saved game to file \"%s\"", __func__, saveFile.c_str());
+
 	delete ls;
-	return true;
+	return saved;
 }
 
 std::string ILoadSaveHandler::FindSaveFile(const std::string& file)
@@ -30,7 +30,8 @@ protected:
 public:
 	virtual ~ILoadSaveHandler() = default;
 
-	virtual void SaveGame(const std::string& file) = 0;
+	/// returns false if the save could not be written or (for creg saves) its file not be opened
+	virtual bool SaveGame(const std::string& file) = 0;
 	/// load scriptText and (for creg saves) {map,mod}Name needed to fire up the engine
 	virtual bool LoadGameStartInfo(const std::string& file) = 0;
 	virtual void LoadGame() = 0;
@@ -52,7 +53,7 @@ protected:
 
 class DummyLoadSaveHandler: public ILoadSaveHandler {
 public:
-	void SaveGame(const std::string& file) override {}
+	bool SaveGame(const std::string& file) override { return false; }
 	bool LoadGameStartInfo(const std::string& file) override { return false; }
 	void LoadGame() override {}
 	void LoadAIData() override {}
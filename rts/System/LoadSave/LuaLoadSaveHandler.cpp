@@ -55,7 +55,7 @@ CLuaLoadSaveHandler::~CLuaLoadSaveHandler()
 }
 
 
-void CLuaLoadSaveHandler::SaveGame(const std::string& file)
+bool CLuaLoadSaveHandler::SaveGame(const std::string& file)
 {
 	const std::string realname = dataDirsAccess.LocateFile(file, FileQueryFlags::WRITE);
 
@@ -81,7 +81,7 @@ void CLuaLoadSaveHandler::SaveGame(const std::string& file)
 		if (Z_OK != zipClose(savefile, "Spring save file, visit https://springrts.com/ for details.")) {
 			LOG_L(L_ERROR, "Unable to close save file \"%s\"", filename.c_str());
 		}
-		return; // Success
+		return true; // Success
 	}
 	catch (const content_error& ex) {
 		LOG_L(L_ERROR, "Save failed(content error): %s", ex.what());
@@ -102,6 +102,8 @@ void CLuaLoadSaveHandler::SaveGame(const std::string& file)
 		savefile = nullptr;
 		FileSystem::Remove(realname);
 	}
+
+	return false;
 }
 
 
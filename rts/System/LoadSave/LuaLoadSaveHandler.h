@@ -19,7 +19,7 @@ public:
 	CLuaLoadSaveHandler();
 	~CLuaLoadSaveHandler();
 
-	void SaveGame(const std::string& file) override;
+	bool SaveGame(const std::string& file) override;
 	bool LoadGameStartInfo(const std::string& file) override;
 	void LoadGame() override;
 	void LoadAIData() override;
@@ -35,6 +35,7 @@
 #include "Game/Game.h"
 #include "Game/GlobalUnsynced.h"
 #include "Game/PreGame.h"
+#include "Game/SimBenchmark.h"
 #include "Game/UI/KeyBindings.h"
 #include "Game/UI/KeyCodes.h"
 #include "Game/UI/ScanCodes.h"
@@ -157,6 +158,8 @@ DEFINE_string_EX(calc_checksum,      "calc-checksum",      "",    "Calculate nam
  * parallel because they both try to open the same port. This makes automated replay parsing difficult when
  * the same port number is heavily reused across many replays. Forcing onlyLocal solves this. */
 DEFINE_bool_EX  (onlyLocal,              "only-local",     false, "Force OnlyLocal mode (no network listening sockets). Use for parallelized watching of multiplayer replays");
+DEFINE_string_EX(sim_benchmark,          "sim-benchmark",          "", "Replay the given demo as fast as possible and write per-frame sim-times and sync checksums to this CSV file");
+DEFINE_string_EX(sim_benchmark_baseline, "sim-benchmark-baseline", "", "Compare the --sim-benchmark results against this earlier output, exit with non-zero code on desync or slowdown");
 
 
 
@@ -578,6 +581,9 @@ void SpringApp::ParseCmdLine(int argc, char* argv[])
 	CTextureAtlas::SetDebug(FLAGS_textureatlas);
 
 	CGameSetup::forceOnlyLocal = FLAGS_onlyLocal;
+	CGameSetup::unpacedDemoPlayback = !FLAGS_sim_benchmark.empty();
+
+	simBenchmark.SetFiles(FLAGS_sim_benchmark, FLAGS_sim_benchmark_baseline);
 
 	// if this fails, configHandler remains null
 	// logOutput's init depends on configHandler
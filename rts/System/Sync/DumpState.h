@@ -6,6 +6,8 @@
 #include <optional>
 
 extern void DumpState(int startFrameNum, int endFrameNum, int newFramePeriod, std::optional<bool> outputFloats, std::optional<int> historyFrame = std::nullopt, bool serverRequest = false);
+extern void DumpStateBinary(int startFrameNum, int endFrameNum, int newFramePeriod);
+extern void CloseDumpStateBinary();
 extern void DumpRNG(int startFrameNum, int endFrameNum);
 
 #endif /* DUMPSTATE_H */
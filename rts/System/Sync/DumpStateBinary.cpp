@@ -0,0 +1,538 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "DumpState.h"
+#include "DumpStateFormat.h"
+
+#include "Game/Game.h"
+#include "Game/GameSetup.h"
+#include "Game/GlobalUnsynced.h"
+#include "Game/GameVersion.h"
+#include "Net/GameServer.h"
+#include "Sim/Features/Feature.h"
+#include "Sim/Features/FeatureDef.h"
+#include "Sim/Features/FeatureHandler.h"
+#include "Sim/Misc/GlobalSynced.h"
+#include "Sim/Misc/TeamHandler.h"
+#include "Sim/Misc/LosHandler.h"
+#include "Sim/Misc/SmoothHeightMesh.h"
+#include "Sim/MoveTypes/MoveType.h"
+#include "Sim/MoveTypes/GroundMoveType.h"
+#include "Sim/Projectiles/Projectile.h"
+#include "Sim/Projectiles/ProjectileHandler.h"
+#include "Sim/Units/CommandAI/CommandAI.h"
+#include "Sim/Units/Scripts/CobEngine.h"
+#include "Sim/Units/Unit.h"
+#include "Sim/Units/UnitDef.h"
+#include "Sim/Units/UnitHandler.h"
+#include "Sim/Units/UnitTypes/Builder.h"
+#include "Sim/Weapons/Weapon.h"
+#include "Map/ReadMap.h"
+#include "System/StringUtil.h"
+#include "System/Log/ILog.h"
+#include "System/SpringHash.h"
+#include "System/Platform/Threading.h"
+#include "System/Threading/SpringThreading.h"
+
+#include "System/Misc/TracyDefs.h"
+
+using namespace DumpStateFormat;
+
+namespace {
+	/**
+	 * Collects the records of one frame in memory and hands the filled
+	 * buffer to a background thread, so the sim thread never blocks on
+	 * disk I/O while dumping.
+	 */
+	class CDumpFileWriter {
+	public:
+		~CDumpFileWriter() { Close(); }
+
+		bool Open(const std::string& fileName) {
+			assert(file == nullptr);
+
+			if ((file = std::fopen(fileName.c_str(), "wb")) == nullptr)
+				return false;
+
+			stopThread = false;
+			thread = spring::thread(&CDumpFileWriter::WriteLoop, this);
+			return true;
+		}
+
+		void Close() {
+			if (file == nullptr)
+				return;
+
+			Flush();
+
+			{
+				std::lock_guard<spring::mutex> lock(mutex);
+				stopThread = true;
+			}
+
+			cond.notify_one();
+			thread.join();
+
+			std::fclose(file);
+			file = nullptr;
+		}
+
+		bool IsOpen() const { return (file != nullptr); }
+
+		void Append(const void* data, size_t size) {
+			const auto* bytes = reinterpret_cast<const std::uint8_t*>(data);
+			buffer.insert(buffer.end(), bytes, bytes + size);
+		}
+
+		void Flush() {
+			if (buffer.empty())
+				return;
+
+			{
+				std::lock_guard<spring::mutex> lock(mutex);
+				queue.emplace_back(std::move(buffer));
+
+				// reuse an already written buffer if one is available
+				if (!spareBuffers.empty()) {
+					buffer = std::move(spareBuffers.back());
+					spareBuffers.pop_back();
+				}
+			}
+
+			buffer.clear();
+			cond.notify_one();
+		}
+
+	private:
+		void WriteLoop() {
+			Threading::SetThreadName("dumpstate");
+
+			std::unique_lock<spring::mutex> lock(mutex);
+
+			while (true) {
+				cond.wait(lock, [&]() { return (stopThread || !queue.empty()); });
+
+				if (queue.empty())
+					break;
+
+				std::vector<std::uint8_t> data = std::move(queue.front());
+				queue.pop_front();
+
+				lock.unlock();
+				std::fwrite(data.data(), 1, data.size(), file);
+				lock.lock();
+
+				spareBuffers.emplace_back(std::move(data));
+			}
+
+			std::fflush(file);
+		}
+
+	private:
+		std::FILE* file = nullptr;
+
+		std::vector<std::uint8_t> buffer;
+		std::deque<std::vector<std::uint8_t>> queue;
+		std::vector<std::vector<std::uint8_t>> spareBuffers;
+
+		spring::mutex mutex;
+		spring::condition_variable cond;
+		spring::thread thread;
+
+		bool stopThread = false;
+	};
+
+
+	/**
+	 * Writes one record; fields have to be passed in schema order.
+	 */
+	class CRecordWriter {
+	public:
+		CRecordWriter(CDumpFileWriter& w, RecordType type, std::int32_t objectID): writer(w), def(RECORD_DEFS[type]) {
+			const std::uint8_t recordType = type;
+
+			writer.Append(&recordType, sizeof(recordType));
+			writer.Append(&objectID, sizeof(objectID));
+		}
+		~CRecordWriter() { assert(fieldIndex == def.numFields); }
+
+		CRecordWriter& operator << (std::int32_t v) { return (Write(FIELD_INT32, &v, sizeof(v))); }
+		CRecordWriter& operator << (std::uint32_t v) { return (Write(FIELD_UINT32, &v, sizeof(v))); }
+		CRecordWriter& operator << (float v) { return (Write(FIELD_FLOAT, &v, sizeof(v))); }
+		CRecordWriter& operator << (const float3& v) {
+			const float xyz[3] = {v.x, v.y, v.z};
+			return (Write(FIELD_FLOAT3, xyz, sizeof(xyz)));
+		}
+
+	private:
+		CRecordWriter& Write(FieldType type, const void* data, size_t size) {
+			assert(fieldIndex < def.numFields);
+			assert(def.fields[fieldIndex].type == type);
+
+			writer.Append(data, size);
+			fieldIndex += 1;
+			return *this;
+		}
+
+	private:
+		CDumpFileWriter& writer;
+		const RecordDef& def;
+
+		size_t fieldIndex = 0;
+	};
+
+
+	void AppendString(CDumpFileWriter& writer, const std::string& s) {
+		const std::uint16_t size = static_cast<std::uint16_t>(std::min(s.size(), size_t(0xFFFF)));
+
+		writer.Append(&size, sizeof(size));
+		writer.Append(s.data(), size);
+	}
+
+	void AppendHeader(CDumpFileWriter& writer, int minFrame, int maxFrame, int framePeriod) {
+		FileHeader header;
+
+		std::memset(&header, 0, sizeof(header));
+		std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+		std::memcpy(header.gameID, game->gameID, sizeof(header.gameID));
+
+		header.version = VERSION;
+		header.minFrame = minFrame;
+		header.maxFrame = maxFrame;
+		header.framePeriod = framePeriod;
+		header.initSeed = gsRNG.GetInitSeed();
+		header.numRecordTypes = RECORD_TYPE_COUNT;
+
+		writer.Append(&header, sizeof(header));
+
+		AppendString(writer, gameSetup->mapName);
+		AppendString(writer, gameSetup->modName);
+		AppendString(writer, SpringVersion::GetSync());
+
+		for (const RecordDef& recordDef: RECORD_DEFS) {
+			const std::uint16_t numFields = static_cast<std::uint16_t>(recordDef.numFields);
+
+			AppendString(writer, recordDef.name);
+			writer.Append(&numFields, sizeof(numFields));
+
+			for (size_t i = 0; i < recordDef.numFields; i++) {
+				const std::uint8_t fieldType = recordDef.fields[i].type;
+
+				writer.Append(&fieldType, sizeof(fieldType));
+				AppendString(writer, recordDef.fields[i].name);
+			}
+		}
+	}
+
+
+	template<typename T>
+	std::uint32_t HashArray(const T* data, size_t count) {
+		return spring::LiteHash(static_cast<const void*>(data), static_cast<unsigned>(count * sizeof(T)));
+	}
+
+	std::uint32_t HashPieces(const CUnit* u) {
+		std::uint32_t cs = 0;
+
+		for (const LocalModelPiece& lmp: u->localModel.pieces) {
+			cs = spring::LiteHash(lmp.GetPosition(), cs);
+			cs = spring::LiteHash(lmp.GetRotation(), cs);
+			cs = spring::LiteHash(lmp.GetScriptVisible(), cs);
+		}
+
+		return cs;
+	}
+
+	std::uint32_t HashWeapons(const CUnit* u) {
+		std::uint32_t cs = 0;
+
+		for (const CWeapon* w: u->weapons) {
+			cs = spring::LiteHash(w->weaponNum, cs);
+			cs = spring::LiteHash(w->weaponDir, cs);
+			cs = spring::LiteHash(w->aimFromPos, cs);
+			cs = spring::LiteHash(w->relAimFromPos, cs);
+			cs = spring::LiteHash(w->weaponMuzzlePos, cs);
+			cs = spring::LiteHash(w->relWeaponMuzzlePos, cs);
+		}
+
+		return cs;
+	}
+
+	std::uint32_t HashCommands(const CCommandQueue& cq) {
+		std::uint32_t cs = 0;
+
+		for (const Command& c: cq) {
+			cs = spring::LiteHash(c.GetID(), cs);
+			cs = spring::LiteHash(c.GetTag(), cs);
+			cs = spring::LiteHash(c.GetOpts(), cs);
+
+			for (unsigned int n = 0; n < c.GetNumParams(); n++) {
+				cs = spring::LiteHash(c.GetParam(n), cs);
+			}
+		}
+
+		return cs;
+	}
+
+	std::uint32_t HashBuilder(const CUnit* u) {
+		const CBuilder* b = dynamic_cast<const CBuilder*>(u);
+
+		if (b == nullptr)
+			return 0;
+
+		const auto GetID = [](const CSolidObject* so) { return ((so != nullptr)? so->id: -1); };
+
+		std::uint32_t cs = 0;
+
+		cs = spring::LiteHash(GetID(b->curResurrect), cs);
+		cs = spring::LiteHash(b->lastResurrected, cs);
+		cs = spring::LiteHash(GetID(b->curBuild), cs);
+		cs = spring::LiteHash(GetID(b->curCapture), cs);
+		cs = spring::LiteHash(GetID(b->curReclaim), cs);
+		cs = spring::LiteHash(b->reclaimingUnit, cs);
+		cs = spring::LiteHash(GetID(b->helpTerraform), cs);
+		cs = spring::LiteHash(b->terraforming, cs);
+		cs = spring::LiteHash(b->terraformHelp, cs);
+		cs = spring::LiteHash(b->myTerraformLeft, cs);
+		cs = spring::LiteHash(b->terraformType, cs);
+		cs = spring::LiteHash(b->tx1, cs);
+		cs = spring::LiteHash(b->tx2, cs);
+		cs = spring::LiteHash(b->tz1, cs);
+		cs = spring::LiteHash(b->tz2, cs);
+		cs = spring::LiteHash(b->terraformCenter, cs);
+		cs = spring::LiteHash(b->terraformRadius, cs);
+
+		return cs;
+	}
+
+
+	void DumpUnit(CDumpFileWriter& writer, const CUnit* u) {
+		const AMoveType* amt = u->moveType;
+		const CGroundMoveType* gmt = dynamic_cast<const CGroundMoveType*>(amt);
+		const CCommandAI* cai = u->commandAI;
+
+		const std::uint32_t flags = (u->isDead << 0) | (u->activated << 1) | (u->inBuildStance << 2);
+
+		CRecordWriter(writer, RECORD_UNIT, u->id)
+			<< std::int32_t(u->unitDef->id)
+			<< u->pos
+			<< u->speed
+			<< u->rightdir
+			<< u->updir
+			<< u->frontdir
+			<< u->relMidPos
+			<< u->relAimPos
+			<< u->midPos
+			<< std::int32_t(u->heading)
+			<< std::int32_t(u->mapSquare)
+			<< u->health
+			<< u->experience
+			<< flags
+			<< std::uint32_t(u->physicalState)
+			<< std::int32_t(u->fireState)
+			<< std::int32_t(u->moveState)
+			<< HashPieces(u)
+			<< HashWeapons(u)
+			<< std::int32_t((cai->orderTarget != nullptr)? cai->orderTarget->id: -1)
+			<< std::int32_t(cai->commandQue.size())
+			<< HashCommands(cai->commandQue)
+			<< float3(amt->goalPos)
+			<< amt->GetMaxSpeed()
+			<< amt->GetMaxWantedSpeed()
+			<< std::int32_t(amt->progressState)
+			<< ((gmt != nullptr)? gmt->GetCurrWayPoint(): ZeroVector)
+			<< ((gmt != nullptr)? gmt->GetNextWayPoint(): ZeroVector)
+			<< HashBuilder(u);
+	}
+
+	void DumpFeature(CDumpFileWriter& writer, const CFeature* f) {
+		CRecordWriter(writer, RECORD_FEATURE, f->id)
+			<< std::int32_t(f->def->id)
+			<< f->pos
+			<< f->speed
+			<< f->rightdir
+			<< f->updir
+			<< f->frontdir
+			<< f->relMidPos
+			<< f->relAimPos
+			<< f->midPos
+			<< f->health
+			<< f->reclaimLeft;
+	}
+
+	void DumpProjectile(CDumpFileWriter& writer, const CProjectile* p) {
+		const std::uint32_t flags = (p->weapon << 0) | (p->piece << 1) | (p->checkCol << 2) | (p->deleteMe << 3);
+
+		CRecordWriter(writer, RECORD_PROJECTILE, p->id)
+			<< p->pos
+			<< p->dir
+			<< p->speed
+			<< flags;
+	}
+
+	void DumpTeam(CDumpFileWriter& writer, const CTeam* t) {
+		CRecordWriter(writer, RECORD_TEAM, t->teamNum)
+			<< t->res.metal
+			<< t->res.energy
+			<< t->resPull.metal
+			<< t->resPull.energy
+			<< t->resIncome.metal
+			<< t->resIncome.energy
+			<< t->resExpense.metal
+			<< t->resExpense.energy;
+	}
+
+	void DumpAllyTeam(CDumpFileWriter& writer, int allyTeam) {
+		const ILosType* losTypes[] = {
+			&losHandler->los,
+			&losHandler->airLos,
+			&losHandler->radar,
+			&losHandler->sonar,
+			&losHandler->seismic,
+			&losHandler->jammer,
+			&losHandler->sonarJammer,
+		};
+
+		CRecordWriter record(writer, RECORD_ALLYTEAM, allyTeam);
+
+		for (const ILosType* lt: losTypes) {
+			const auto& losMap = lt->losMaps[allyTeam].GetLosMap();
+			record << HashArray(losMap.data(), losMap.size());
+		}
+	}
+
+	void DumpMap(CDumpFileWriter& writer) {
+		const float* heightMap = readMap->GetCornerHeightMapSynced();
+		const float3* centerNormals = readMap->GetCenterNormalsSynced();
+		const float3* faceNormals = readMap->GetFaceNormalsSynced();
+		const float* smoothMesh = smoothGround.GetMeshData();
+
+		const unsigned int numSquares = mapDims.mapx * mapDims.mapy;
+
+		CRecordWriter(writer, RECORD_MAP, 0)
+			<< HashArray(heightMap, mapDims.mapxp1 * mapDims.mapyp1)
+			<< HashArray(centerNormals, numSquares)
+			<< HashArray(faceNormals, numSquares * 2)
+			<< HashArray(smoothMesh, smoothGround.GetMaxX() * smoothGround.GetMaxY())
+			<< std::int32_t(cobEngine->GetCurrTime())
+			<< std::int32_t(cobEngine->GetThreadInstances().size());
+	}
+
+	void DumpFrame(CDumpFileWriter& writer) {
+		const std::vector<CUnit*>& activeUnits = unitHandler.GetActiveUnits();
+		const auto& activeFeatureIDs = featureHandler.GetActiveFeatureIDs();
+		const auto& projectiles = projectileHandler.GetActiveProjectiles(true);
+
+		CRecordWriter(writer, RECORD_FRAME, gs->frameNum)
+			<< std::uint32_t(gsRNG.GetLastSeed())
+			<< spring::LiteHash(gsRNG.GetGenState())
+			<< std::int32_t(activeUnits.size())
+			<< std::int32_t(activeFeatureIDs.size())
+			<< std::int32_t(projectiles.size());
+
+		for (const CUnit* u: activeUnits) {
+			DumpUnit(writer, u);
+		}
+
+		for (const int featureID: activeFeatureIDs) {
+			DumpFeature(writer, featureHandler.GetFeature(featureID));
+		}
+
+		for (const CProjectile* p: projectiles) {
+			DumpProjectile(writer, p);
+		}
+
+		for (int a = 0; a < teamHandler.ActiveTeams(); ++a) {
+			DumpTeam(writer, teamHandler.Team(a));
+		}
+
+		for (int a = 0; a < teamHandler.ActiveAllyTeams(); ++a) {
+			DumpAllyTeam(writer, a);
+		}
+
+		DumpMap(writer);
+
+		writer.Flush();
+	}
+}
+
+
+// closed by CloseDumpStateBinary, or on exit at the latest
+static CDumpFileWriter gDumpWriter;
+static int gMinFrameNum = -1;
+static int gMaxFrameNum = -1;
+static int gFramePeriod =  1;
+
+
+void CloseDumpStateBinary()
+{
+	gDumpWriter.Close();
+
+	gMinFrameNum = -1;
+	gMaxFrameNum = -1;
+	gFramePeriod =  1;
+}
+
+void DumpStateBinary(int newMinFrameNum, int newMaxFrameNum, int newFramePeriod)
+{
+	RECOIL_DETAILED_TRACY_ZONE;
+
+	const int oldMinFrameNum = gMinFrameNum;
+	const int oldMaxFrameNum = gMaxFrameNum;
+
+	if (!gs->cheatEnabled)
+		return;
+	// check if the range is valid
+	if (newMaxFrameNum < newMinFrameNum)
+		return;
+
+	// adjust the bounds if the new values are valid
+	if (newMinFrameNum >= 0) gMinFrameNum = newMinFrameNum;
+	if (newMaxFrameNum >= 0) gMaxFrameNum = newMaxFrameNum;
+	if (newFramePeriod >= 1) gFramePeriod = newFramePeriod;
+
+	if ((gMinFrameNum != oldMinFrameNum) || (gMaxFrameNum != oldMaxFrameNum)) {
+		LOG("[%s] dumping binary state (from %d to %d step %d)", __func__, gMinFrameNum, gMaxFrameNum, gFramePeriod);
+		// bounds changed, open a new file
+		gDumpWriter.Close();
+
+		std::string name = (gameServer != nullptr)? "Server": "Client";
+		name += "GameState-";
+		name += IntToString(guRNG.NextInt());
+		name += "-[";
+		name += IntToString(gMinFrameNum);
+		name += "-";
+		name += IntToString(gMaxFrameNum);
+		name += "].sdsb";
+
+		if (!gDumpWriter.Open(name)) {
+			LOG_L(L_ERROR, "[%s] could not open dump-file \"%s\"", __func__, name.c_str());
+			return;
+		}
+
+		AppendHeader(gDumpWriter, gMinFrameNum, gMaxFrameNum, gFramePeriod);
+
+		LOG("[%s] using dump-file \"%s\"", __func__, name.c_str());
+	}
+
+	if (!gDumpWriter.IsOpen())
+		return;
+	// check if the CURRENT frame lies within the bounds
+	if (gs->frameNum < gMinFrameNum)
+		return;
+
+	if (gs->frameNum <= gMaxFrameNum && (gs->frameNum % gFramePeriod) == 0)
+		DumpFrame(gDumpWriter);
+
+	// the last frame need not be on the period, or may have been skipped
+	if (gs->frameNum < gMaxFrameNum)
+		return;
+
+	CloseDumpStateBinary();
+}
@@ -0,0 +1,185 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#ifndef DUMPSTATE_FORMAT_H
+#define DUMPSTATE_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * On-disk layout of binary game-state dumps (/DumpStateBinary), shared with
+ * tools/DumpStateDiff. Header-only and free of engine dependencies.
+ *
+ * A dump consists of
+ *   FileHeader
+ *   mapName, modName, syncVersion                (uint16 length + chars each)
+ *   schema: FileHeader::numRecordTypes entries of
+ *     uint16 name-length, name, uint16 numFields,
+ *     numFields * {uint8 FieldType, uint16 name-length, name}
+ *   records: uint8 RecordType, int32 objectID, field values in schema order
+ *
+ * Every frame starts with a RECORD_FRAME (objectID = frame number); all
+ * records up to the next RECORD_FRAME belong to it. Floats are stored as
+ * their raw bit-patterns so dumps can be compared exactly. Readers should
+ * rely on the schema stored in the file rather than on the tables below,
+ * which only describe what the current engine writes.
+ */
+namespace DumpStateFormat {
+	static constexpr char MAGIC[8] = {'S', 'P', 'R', 'D', 'U', 'M', 'P', 'B'};
+	static constexpr std::uint32_t VERSION = 1;
+
+	enum FieldType: std::uint8_t {
+		FIELD_INT32  = 0,
+		FIELD_UINT32 = 1, // also used for hashes and bit-flags
+		FIELD_FLOAT  = 2,
+		FIELD_FLOAT3 = 3,
+		FIELD_TYPE_COUNT = 4,
+	};
+
+	enum RecordType: std::uint8_t {
+		RECORD_FRAME      = 0,
+		RECORD_UNIT       = 1,
+		RECORD_FEATURE    = 2,
+		RECORD_PROJECTILE = 3,
+		RECORD_TEAM       = 4,
+		RECORD_ALLYTEAM   = 5,
+		RECORD_MAP        = 6,
+		RECORD_TYPE_COUNT = 7,
+	};
+
+	struct FileHeader {
+		char magic[sizeof(MAGIC)];
+		std::uint32_t version;
+
+		std::int32_t minFrame;
+		std::int32_t maxFrame;
+		std::int32_t framePeriod;
+
+		std::uint32_t initSeed;
+		std::uint8_t gameID[16];
+
+		std::uint32_t numRecordTypes;
+	};
+
+	struct FieldDef {
+		const char* name;
+		FieldType type;
+	};
+
+	struct RecordDef {
+		const char* name;
+		const FieldDef* fields;
+		std::size_t numFields;
+	};
+
+
+	static constexpr std::size_t GetFieldSize(std::uint8_t type) {
+		return ((type == FIELD_FLOAT3)? (3 * sizeof(std::uint32_t)): sizeof(std::uint32_t));
+	}
+
+
+	static constexpr FieldDef FRAME_FIELDS[] = {
+		{"lastSeed"      , FIELD_UINT32},
+		{"genStateHash"  , FIELD_UINT32},
+		{"numUnits"      , FIELD_INT32 },
+		{"numFeatures"   , FIELD_INT32 },
+		{"numProjectiles", FIELD_INT32 },
+	};
+
+	static constexpr FieldDef UNIT_FIELDS[] = {
+		{"unitDefID"     , FIELD_INT32 },
+		{"pos"           , FIELD_FLOAT3},
+		{"speed"         , FIELD_FLOAT3},
+		{"xdir"          , FIELD_FLOAT3},
+		{"ydir"          , FIELD_FLOAT3},
+		{"zdir"          , FIELD_FLOAT3},
+		{"relMidPos"     , FIELD_FLOAT3},
+		{"relAimPos"     , FIELD_FLOAT3},
+		{"midPos"        , FIELD_FLOAT3},
+		{"heading"       , FIELD_INT32 },
+		{"mapSquare"     , FIELD_INT32 },
+		{"health"        , FIELD_FLOAT },
+		{"experience"    , FIELD_FLOAT },
+		{"flags"         , FIELD_UINT32}, // isDead | activated << 1 | inBuildStance << 2
+		{"physicalState" , FIELD_UINT32},
+		{"fireState"     , FIELD_INT32 },
+		{"moveState"     , FIELD_INT32 },
+		{"piecesHash"    , FIELD_UINT32},
+		{"weaponsHash"   , FIELD_UINT32},
+		{"orderTargetID" , FIELD_INT32 },
+		{"numCommands"   , FIELD_INT32 },
+		{"commandsHash"  , FIELD_UINT32},
+		{"goalPos"       , FIELD_FLOAT3},
+		{"maxSpeed"      , FIELD_FLOAT },
+		{"maxWantedSpeed", FIELD_FLOAT },
+		{"progressState" , FIELD_INT32 },
+		{"currWayPoint"  , FIELD_FLOAT3},
+		{"nextWayPoint"  , FIELD_FLOAT3},
+		{"builderHash"   , FIELD_UINT32},
+	};
+
+	static constexpr FieldDef FEATURE_FIELDS[] = {
+		{"featureDefID"  , FIELD_INT32 },
+		{"pos"           , FIELD_FLOAT3},
+		{"speed"         , FIELD_FLOAT3},
+		{"xdir"          , FIELD_FLOAT3},
+		{"ydir"          , FIELD_FLOAT3},
+		{"zdir"          , FIELD_FLOAT3},
+		{"relMidPos"     , FIELD_FLOAT3},
+		{"relAimPos"     , FIELD_FLOAT3},
+		{"midPos"        , FIELD_FLOAT3},
+		{"health"        , FIELD_FLOAT },
+		{"reclaimLeft"   , FIELD_FLOAT },
+	};
+
+	static constexpr FieldDef PROJECTILE_FIELDS[] = {
+		{"pos"           , FIELD_FLOAT3},
+		{"dir"           , FIELD_FLOAT3},
+		{"speed"         , FIELD_FLOAT3},
+		{"flags"         , FIELD_UINT32}, // weapon | piece << 1 | checkCol << 2 | deleteMe << 3
+	};
+
+	static constexpr FieldDef TEAM_FIELDS[] = {
+		{"metal"         , FIELD_FLOAT },
+		{"energy"        , FIELD_FLOAT },
+		{"metalPull"     , FIELD_FLOAT },
+		{"energyPull"    , FIELD_FLOAT },
+		{"metalIncome"   , FIELD_FLOAT },
+		{"energyIncome"  , FIELD_FLOAT },
+		{"metalExpense"  , FIELD_FLOAT },
+		{"energyExpense" , FIELD_FLOAT },
+	};
+
+	static constexpr FieldDef ALLYTEAM_FIELDS[] = {
+		{"losHash"        , FIELD_UINT32},
+		{"airLosHash"     , FIELD_UINT32},
+		{"radarHash"      , FIELD_UINT32},
+		{"sonarHash"      , FIELD_UINT32},
+		{"seismicHash"    , FIELD_UINT32},
+		{"jammerHash"     , FIELD_UINT32},
+		{"sonarJammerHash", FIELD_UINT32},
+	};
+
+	static constexpr FieldDef MAP_FIELDS[] = {
+		{"heightMapHash"    , FIELD_UINT32},
+		{"centerNormalsHash", FIELD_UINT32},
+		{"faceNormalsHash"  , FIELD_UINT32},
+		{"smoothMeshHash"   , FIELD_UINT32},
+		{"cobTime"          , FIELD_INT32 },
+		{"numCobThreads"    , FIELD_INT32 },
+	};
+
+	#define DUMPSTATE_RECORD_DEF(name, fields) {name, fields, sizeof(fields) / sizeof(fields[0])}
+	static constexpr RecordDef RECORD_DEFS[RECORD_TYPE_COUNT] = {
+		DUMPSTATE_RECORD_DEF("frame"     , FRAME_FIELDS     ),
+		DUMPSTATE_RECORD_DEF("unit"      , UNIT_FIELDS      ),
+		DUMPSTATE_RECORD_DEF("feature"   , FEATURE_FIELDS   ),
+		DUMPSTATE_RECORD_DEF("projectile", PROJECTILE_FIELDS),
+		DUMPSTATE_RECORD_DEF("team"      , TEAM_FIELDS      ),
+		DUMPSTATE_RECORD_DEF("allyteam"  , ALLYTEAM_FIELDS  ),
+		DUMPSTATE_RECORD_DEF("map"       , MAP_FIELDS       ),
+	};
+	#undef DUMPSTATE_RECORD_DEF
+}
+
+#endif /* DUMPSTATE_FORMAT_H */
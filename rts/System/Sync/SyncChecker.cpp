@@ -10,11 +10,16 @@
 
 
 unsigned CSyncChecker::g_checksum;
-int CSyncChecker::inSyncedCode;
+std::atomic<int> CSyncChecker::inSyncedCode = {0};
+
+std::array<unsigned, CSyncChecker::SYNC_SECTION_COUNT> CSyncChecker::sectionChecksums;
+CSyncChecker::SyncSection CSyncChecker::currentSection = CSyncChecker::SYNC_SECTION_MISC;
+bool CSyncChecker::sectionsEnabled = false;
 
 void CSyncChecker::NewFrame()
 {
 	g_checksum = 0xfade1eaf;
+	sectionChecksums.fill(0xfade1eaf);
 #ifdef SYNC_HISTORY
 	LogHistory();
 #endif // SYNC_HISTORY
@@ -36,11 +41,24 @@ void CSyncChecker::Sync(const void* p, unsigned size)
 	g_checksum = spring::LiteHash(p, size, g_checksum);
 	//LOG("[Sync::Checker] chksum=%u\n", g_checksum);
 
+	if (sectionsEnabled)
+		sectionChecksums[currentSection] = spring::LiteHash(p, size, sectionChecksums[currentSection]);
+
 #ifdef SYNC_HISTORY
 	LogHistory();
 #endif // SYNC_HISTORY
 }
 
+void CSyncChecker::SyncToSection(SyncSection s, const void* p, unsigned size)
+{
+	// state that is not written through synced primitives (e.g. RNG) is
+	// folded into its section once per frame, but not into g_checksum
+	if (!sectionsEnabled)
+		return;
+
+	sectionChecksums[s] = spring::LiteHash(p, size, sectionChecksums[s]);
+}
+
 #ifdef SYNC_HISTORY
 
 unsigned CSyncChecker::nextHistoryIndex = 0;
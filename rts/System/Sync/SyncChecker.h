@@ -9,6 +9,7 @@
 
 #include <cassert>
 #include <array>
+#include <atomic>
 
 static constexpr size_t MAX_SYNC_HISTORY = 2500000; // 10MB, ~= 10 seconds of typical midgame
 static constexpr size_t MAX_SYNC_HISTORY_FRAMES = 1000;
@@ -18,10 +19,30 @@ static constexpr size_t MAX_SYNC_HISTORY_FRAMES = 1000;
  *
  * A Lightweight sync debugger that just keeps a running checksum over all
  * assignments to synced variables.
+ * If section checksums are enabled, each assignment is additionally hashed
+ * into the checksum of the sim subsystem that is currently being updated,
+ * so a desync can be attributed to the diverging subsystems.
  */
 class CSyncChecker {
 
 	public:
+		/**
+		 * Sim subsystems with their own section checksum. SimFrame switches
+		 * between them repeatedly, so the numbering implies no ordering.
+		 */
+		enum SyncSection {
+			SYNC_SECTION_MISC        = 0,
+			SYNC_SECTION_LUA         = 1,
+			SYNC_SECTION_UNITS       = 2,
+			SYNC_SECTION_PATH        = 3,
+			SYNC_SECTION_PROJECTILES = 4,
+			SYNC_SECTION_FEATURES    = 5,
+			SYNC_SECTION_LOS         = 6,
+			SYNC_SECTION_TEAMS       = 7,
+			SYNC_SECTION_RNG         = 8,
+			SYNC_SECTION_COUNT       = 9,
+		};
+
 		/**
 		 * Whether one thread (doesn't have to be the current thread!!!) is currently processing a SimFrame.
 		 */
@@ -36,6 +57,20 @@ class CSyncChecker {
 		static void NewFrame();
 		static void debugSyncCheckThreading();
 		static void Sync(const void* p, unsigned size);
+
+		/**
+		 * Per-subsystem checksums, only maintained while enabled.
+		 */
+		static bool SectionsEnabled() { return sectionsEnabled; }
+		static void SetSectionsEnabled(bool b) { sectionsEnabled = b; }
+		static void SetSection(SyncSection s) { currentSection = s; }
+		static void SyncToSection(SyncSection s, const void* p, unsigned size);
+		static const std::array<unsigned, SYNC_SECTION_COUNT>& GetSectionChecksums() { return sectionChecksums; }
+		static const char* GetSectionName(unsigned s) {
+			// header-only, also used by the (dedicated) server
+			constexpr const char* sectionNames[SYNC_SECTION_COUNT] = {"misc", "lua", "units", "path", "projectiles", "features", "los", "teams", "rng"};
+			return ((s < SYNC_SECTION_COUNT)? sectionNames[s]: "unknown");
+		}
 		#ifdef SYNC_HISTORY
 		static std::tuple<unsigned, unsigned, unsigned*> GetFrameHistory(unsigned rewindFrames);
 		static std::pair<unsigned, unsigned*> GetHistory() { return std::make_pair(nextHistoryIndex, logs.data()); };
@@ -49,12 +84,17 @@ class CSyncChecker {
 		 */
 		static unsigned g_checksum;
 
+		static std::array<unsigned, SYNC_SECTION_COUNT> sectionChecksums;
+		static SyncSection currentSection;
+		static bool sectionsEnabled;
+
 		/**
 		 * @brief in synced code
 		 *
 		 * Whether one thread (doesn't have to current thread!!!) is currently processing a SimFrame.
+		 * Atomic since some synced loading stages run concurrently on worker threads.
 		 */
-		static int inSyncedCode;
+		static std::atomic<int> inSyncedCode;
 
 #ifdef SYNC_HISTORY
 		/**
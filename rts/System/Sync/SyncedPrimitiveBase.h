@@ -71,6 +71,12 @@ namespace Sync {
 #  define LEAVE_SYNCED_CODE()
 #endif
 
+#ifdef SYNCCHECK
+#  define SYNC_SECTION(s) CSyncChecker::SetSection(CSyncChecker::SYNC_SECTION_##s)
+#else
+#  define SYNC_SECTION(s)
+#endif
+
 #ifdef SYNCDEBUG
 #  define ASSERT_SYNCED(x) Sync::AssertDebugger(x, "assert(" #x ")")
 #else
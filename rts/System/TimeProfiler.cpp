@@ -2,12 +2,14 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstdio>
 #include <cstring>
 
 #include "System/TimeProfiler.h"
 #include "System/GlobalRNG.h"
 #include "System/StringHash.h"
 #include "System/Log/ILog.h"
+#include "System/Platform/Threading.h"
 #include "System/Threading/SpringThreading.h"
 
 #ifdef THREADPOOL
@@ -371,6 +373,10 @@ void CTimeProfiler::AddTime(
 ) {
 	const spring_time t0 = spring_now();
 
+	// SimFrame runs on the main thread, anything else is not part of it
+	if (!threadTimer && CFramePhaseRecorder::GetInstance().IsRecording() && Threading::IsMainThread())
+		CFramePhaseRecorder::GetInstance().AddTime(nameHash, deltaTime);
+
 	if (!enabled) {
 		if (!specialTimer)
 			return;
@@ -440,3 +446,161 @@ void CTimeProfiler::PrintProfilingInfo() const
 	}
 }
 
+
+
+
+CFramePhaseRecorder& CFramePhaseRecorder::GetInstance()
+{
+	static CFramePhaseRecorder fpr;
+	return fpr;
+}
+
+void CFramePhaseRecorder::Init(unsigned int numFrames_)
+{
+	phaseSamples.clear();
+	phaseNameHashes.clear();
+	phaseIndices.clear();
+	frameNums.clear();
+
+	maxFrames = numFrames_;
+	numFrames = 0;
+	recording = false;
+
+	frameNums.resize(maxFrames, -1);
+}
+
+void CFramePhaseRecorder::BeginFrame(int frameNum)
+{
+	if (maxFrames == 0)
+		return;
+
+	const size_t slot = numFrames % maxFrames;
+
+	for (auto& samples: phaseSamples) {
+		samples[slot] = 0;
+	}
+
+	frameNums[slot] = frameNum;
+	numFrames += 1;
+	recording = true;
+}
+
+void CFramePhaseRecorder::AddTime(unsigned nameHash, const spring_time deltaTime)
+{
+	assert(recording);
+
+	auto iter = phaseIndices.find(nameHash);
+
+	if (iter == phaseIndices.end()) {
+		iter = phaseIndices.emplace(nameHash, phaseSamples.size()).first;
+
+		phaseSamples.emplace_back(maxFrames, 0);
+		phaseNameHashes.push_back(nameHash);
+	}
+
+	phaseSamples[iter->second][(numFrames - 1) % maxFrames] += static_cast<std::uint32_t>(std::max<std::int64_t>(deltaTime.toMicroSecsi(), 0));
+}
+
+std::vector<CFramePhaseRecorder::PhaseStats> CFramePhaseRecorder::GetPhaseStats() const
+{
+	std::vector<PhaseStats> stats;
+	std::vector<std::uint32_t> sorted;
+
+	const size_t count = std::min(numFrames, static_cast<std::uint64_t>(maxFrames));
+
+	if (count == 0)
+		return stats;
+
+	stats.reserve(phaseSamples.size());
+
+	for (size_t i = 0; i < phaseSamples.size(); i++) {
+		sorted.assign(phaseSamples[i].begin(), phaseSamples[i].begin() + count);
+		std::sort(sorted.begin(), sorted.end());
+
+		PhaseStats ps;
+		ps.numFrames = sorted.end() - std::upper_bound(sorted.begin(), sorted.end(), 0u);
+		ps.sum = 0;
+
+		for (const std::uint32_t t: sorted) {
+			ps.sum += t;
+		}
+
+		ps.p50 = sorted[std::min(count - 1, static_cast<size_t>(count * 0.50f))];
+		ps.p95 = sorted[std::min(count - 1, static_cast<size_t>(count * 0.95f))];
+		ps.p99 = sorted[std::min(count - 1, static_cast<size_t>(count * 0.99f))];
+		ps.max = sorted.back();
+
+		{
+			std::lock_guard<HashNamMutexType> lock(hashToNameMutex);
+
+			const auto iter = hashToName.find(phaseNameHashes[i]);
+			ps.name = (iter != hashToName.end())? iter->second: "???";
+		}
+
+		stats.push_back(std::move(ps));
+	}
+
+	std::sort(stats.begin(), stats.end(), [](const PhaseStats& a, const PhaseStats& b) { return (a.name < b.name); });
+	return stats;
+}
+
+bool CFramePhaseRecorder::Export(const std::string& fileName) const
+{
+	const std::vector<PhaseStats> stats = GetPhaseStats();
+	const size_t count = std::min(numFrames, static_cast<std::uint64_t>(maxFrames));
+
+	FILE* file = fopen(fileName.c_str(), "w");
+
+	if (file == nullptr) {
+		LOG_L(L_ERROR, "[FramePhaseRecorder::%s] could not open \"%s\" for writing", __func__, fileName.c_str());
+		return false;
+	}
+
+	// oldest frame still in the ring-buffer
+	const int firstFrame = (count == 0)? -1: frameNums[(numFrames - count) % maxFrames];
+	const int lastFrame = (count == 0)? -1: frameNums[(numFrames - 1) % maxFrames];
+
+	if (fileName.size() >= 4 && fileName.compare(fileName.size() - 4, 4, ".csv") == 0) {
+		fprintf(file, "phase,frames,activeFrames,totalUs,meanUs,p50Us,p95Us,p99Us,maxUs\n");
+
+		for (const PhaseStats& ps: stats) {
+			fprintf(file, "%s,%u,%lu,%lu,%.2f,%u,%u,%u,%u\n",
+				ps.name.c_str(), static_cast<unsigned int>(count), static_cast<unsigned long>(ps.numFrames), static_cast<unsigned long>(ps.sum),
+				ps.sum / static_cast<double>(count), ps.p50, ps.p95, ps.p99, ps.max
+			);
+		}
+	} else {
+		fprintf(file, "{\n\t\"frames\": %u,\n\t\"firstFrame\": %d,\n\t\"lastFrame\": %d,\n\t\"unit\": \"us\",\n\t\"phases\": [", static_cast<unsigned int>(count), firstFrame, lastFrame);
+
+		for (size_t i = 0; i < stats.size(); i++) {
+			const PhaseStats& ps = stats[i];
+
+			fprintf(file, "%s\n\t\t{\"name\": \"%s\", \"activeFrames\": %lu, \"total\": %lu, \"mean\": %.2f, \"p50\": %u, \"p95\": %u, \"p99\": %u, \"max\": %u}",
+				(i == 0)? "": ",",
+				ps.name.c_str(), static_cast<unsigned long>(ps.numFrames), static_cast<unsigned long>(ps.sum),
+				ps.sum / static_cast<double>(count), ps.p50, ps.p95, ps.p99, ps.max
+			);
+		}
+
+		fprintf(file, "\n\t]\n}\n");
+	}
+
+	fclose(file);
+
+	LOG("[FramePhaseRecorder::%s] wrote statistics for %u frames to \"%s\"", __func__, static_cast<unsigned int>(count), fileName.c_str());
+	return true;
+}
+
+void CFramePhaseRecorder::PrintSummary() const
+{
+	const std::vector<PhaseStats> stats = GetPhaseStats();
+
+	if (stats.empty())
+		return;
+
+	LOG("%45s|%10s|%10s|%10s|%10s", "Phase (last frames, ms)", "p50", "p95", "p99", "max");
+
+	for (const PhaseStats& ps: stats) {
+		LOG("%45s %10.3f %10.3f %10.3f %10.3f", ps.name.c_str(), ps.p50 * 1e-3f, ps.p95 * 1e-3f, ps.p99 * 1e-3f, ps.max * 1e-3f);
+	}
+}
@@ -4,6 +4,7 @@
 #define TIME_PROFILER_H
 
 #include <atomic>
+#include <cstdint>
 #include <string>
 #include <deque>
 #include <vector>
@@ -224,6 +225,66 @@ private:
 };
 
 
+/**
+ * @brief Per-frame recorder for the timers of the simulation
+ *
+ * Unlike CTimeProfiler (which keeps a short rolling window for the on-screen
+ * profiler) this collects the time spent in every SCOPED_TIMER section of each
+ * sim-frame, independent of whether the profiler itself is enabled, so that
+ * percentile histograms per phase can be exported from headless games.
+ */
+class CFramePhaseRecorder
+{
+public:
+	static CFramePhaseRecorder& GetInstance();
+
+	/// numFrames is the number of most recent frames kept, 0 disables recording
+	void Init(unsigned int numFrames);
+	void Kill() { Init(0); }
+
+	bool IsEnabled() const { return (maxFrames > 0); }
+	bool IsRecording() const { return recording; }
+
+	void BeginFrame(int frameNum);
+	void EndFrame() { recording = false; }
+
+	void AddTime(unsigned nameHash, const spring_time deltaTime);
+
+	/// writes CSV if fileName ends with ".csv" and JSON otherwise
+	bool Export(const std::string& fileName) const;
+	void PrintSummary() const;
+
+private:
+	struct PhaseStats {
+		std::string name;
+
+		std::uint64_t numFrames; // frames in which the phase ran at all
+		std::uint64_t sum;
+		std::uint32_t p50;
+		std::uint32_t p95;
+		std::uint32_t p99;
+		std::uint32_t max;
+	};
+
+	std::vector<PhaseStats> GetPhaseStats() const;
+
+private:
+	// per-phase durations in microseconds, one slot per recorded frame
+	// (ring-buffer of maxFrames entries indexed by frameIndex % maxFrames)
+	std::vector< std::vector<std::uint32_t> > phaseSamples;
+	std::vector<unsigned> phaseNameHashes;
+	spring::unordered_map<unsigned, size_t> phaseIndices;
+
+	std::vector<int> frameNums;
+
+	unsigned int maxFrames = 0;
+	std::uint64_t numFrames = 0;
+
+	// only the main thread runs SimFrame and non-MT timers
+	bool recording = false;
+};
+
+
 class TimerNameRegistrar : public spring::noncopyable
 {
 public:
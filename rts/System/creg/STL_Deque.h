@@ -12,10 +12,10 @@
 namespace creg
 {
 	/// Deque type (uses vector implementation)
-	template<typename T>
-	struct DeduceType< std::deque <T> > {
+	template<typename T, typename A>
+	struct DeduceType< std::deque <T, A> > {
 		static std::unique_ptr<IType> Get() {
-			return std::unique_ptr<IType>(new DynamicArrayType< std::deque<T> >());
+			return std::unique_ptr<IType>(new DynamicArrayType< std::deque<T, A> >());
 		}
 	};
 }
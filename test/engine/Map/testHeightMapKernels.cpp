@@ -0,0 +1,105 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "Map/HeightMapKernels.hpp"
+
+#include <catch_amalgamated.hpp>
+
+// deliberately not multiples of any batch size
+static constexpr int MAPX = 70;
+static constexpr int MAPY = 38;
+static constexpr int HMAPX = MAPX / 2;
+static constexpr int HMAPY = MAPY / 2;
+
+
+template<typename T>
+static bool BitEquals(const std::vector<T>& a, const std::vector<T>& b)
+{
+	return (a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+static std::vector<float> RandomCornerHeightMap(uint32_t seed)
+{
+	std::mt19937 rng(seed);
+	std::uniform_real_distribution<float> heightDist(-300.0f, 1200.0f);
+	std::uniform_int_distribution<int> kindDist(0, 7);
+
+	std::vector<float> heightMap((MAPX + 1) * (MAPY + 1));
+
+	for (float& h: heightMap) {
+		// mix in flat, zero and signed-zero squares, which exercise the
+		// degenerate normalization and min/max tie-breaking paths
+		switch (kindDist(rng)) {
+			case 0: { h =  0.0f; } break;
+			case 1: { h = -0.0f; } break;
+			case 2: { h = 100.0f; } break;
+			default: { h = heightDist(rng); } break;
+		}
+	}
+
+	return heightMap;
+}
+
+
+TEST_CASE("HeightMapKernels")
+{
+	for (uint32_t seed = 1; seed <= 8; seed++) {
+		const std::vector<float> cornerHM = RandomCornerHeightMap(seed);
+
+		// odd offsets make the vector loops start unaligned and leave a scalar tail
+		for (const int offset: {0, 1, 3}) {
+			const int x1 = offset;
+			const int x2 = MAPX - 1 - offset;
+
+			std::vector<float> centerRef(MAPX * MAPY, 0.0f), centerVec(MAPX * MAPY, 0.0f);
+			std::vector<float> maxRef(MAPX * MAPY, 0.0f), maxVec(MAPX * MAPY, 0.0f);
+
+			for (int y = 0; y < MAPY; y++) {
+				HeightMapKernels::CenterHeightRow(cornerHM.data(), centerRef.data(), maxRef.data(), MAPX, y, x1, x2);
+				HeightMapKernels::CenterHeightRowSIMD(cornerHM.data(), centerVec.data(), maxVec.data(), MAPX, y, x1, x2);
+			}
+
+			CHECK(BitEquals(centerRef, centerVec));
+			CHECK(BitEquals(maxRef, maxVec));
+
+			std::vector<float> mipRef(HMAPX * HMAPY, 0.0f), mipVec(HMAPX * HMAPY, 0.0f);
+
+			for (int y = 0; y < MAPY - 1; y += 2) {
+				HeightMapKernels::MipHeightRow(centerRef.data(), mipRef.data(), MAPX, y, x1 & (~1), x2);
+				HeightMapKernels::MipHeightRowSIMD(centerRef.data(), mipVec.data(), MAPX, y, x1 & (~1), x2);
+			}
+
+			CHECK(BitEquals(mipRef, mipVec));
+
+			std::vector<float3> faceRef(MAPX * MAPY * 2), faceVec(MAPX * MAPY * 2);
+			std::vector<float3> centerNrmRef(MAPX * MAPY), centerNrmVec(MAPX * MAPY);
+			std::vector<float3> centerNrm2DRef(MAPX * MAPY), centerNrm2DVec(MAPX * MAPY);
+
+			for (int y = 0; y < MAPY; y++) {
+				HeightMapKernels::FaceNormalRow(cornerHM.data(), faceRef.data(), centerNrmRef.data(), centerNrm2DRef.data(), MAPX, y, x1, x2);
+				HeightMapKernels::FaceNormalRowSIMD(cornerHM.data(), faceVec.data(), centerNrmVec.data(), centerNrm2DVec.data(), MAPX, y, x1, x2);
+			}
+
+			CHECK(BitEquals(faceRef, faceVec));
+			CHECK(BitEquals(centerNrmRef, centerNrmVec));
+			CHECK(BitEquals(centerNrm2DRef, centerNrm2DVec));
+
+			// slopes are derived from the full set of reference face normals
+			for (int y = 0; y < MAPY; y++) {
+				HeightMapKernels::FaceNormalRow(cornerHM.data(), faceRef.data(), centerNrmRef.data(), centerNrm2DRef.data(), MAPX, y, 0, MAPX - 1);
+			}
+
+			std::vector<float> slopeRef(HMAPX * HMAPY, 0.0f), slopeVec(HMAPX * HMAPY, 0.0f);
+
+			for (int y = 0; y < HMAPY; y++) {
+				HeightMapKernels::SlopeRow(faceRef.data(), slopeRef.data(), MAPX, HMAPX, y, offset, HMAPX - 1 - offset);
+				HeightMapKernels::SlopeRowSIMD(faceRef.data(), slopeVec.data(), MAPX, HMAPX, y, offset, HMAPX - 1 - offset);
+			}
+
+			CHECK(BitEquals(slopeRef, slopeVec));
+		}
+	}
+}
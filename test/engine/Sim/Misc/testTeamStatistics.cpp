@@ -0,0 +1,87 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "Sim/Misc/TeamStatistics.h"
+
+#include <catch_amalgamated.hpp>
+
+
+static bool BitEquals(const TeamStatistics& a, const TeamStatistics& b)
+{
+	return (std::memcmp(&a, &b, sizeof(TeamStatistics)) == 0);
+}
+
+
+TEST_CASE("TeamStatisticsHistory")
+{
+	std::mt19937 rng(1);
+	std::uniform_real_distribution<float> incomeDist(0.0f, 50.0f);
+	std::uniform_int_distribution<int> kindDist(0, 7);
+
+	CTeamStatisticsHistory history;
+	std::vector<TeamStatistics> reference;
+
+	CHECK(history.size() == 1);
+	CHECK(BitEquals(history.back(), TeamStatistics()));
+
+	// enough entries to span several key entries and end in a partial block
+	for (int i = 0; i < static_cast<int>(CTeamStatisticsHistory::KEY_ENTRY_INTERVAL * 3 + 17); i++) {
+		TeamStatistics& stats = history.back();
+
+		stats.frame = i * TeamStatistics::statsPeriod * 30;
+		stats.metalProduced += incomeDist(rng);
+		stats.energyProduced += incomeDist(rng) * 100.0f;
+		stats.damageDealt += incomeDist(rng) * 1000.0f;
+		stats.unitsProduced += (kindDist(rng) == 0);
+
+		// fields that shrink, jump and carry non-finite bit patterns must survive too
+		switch (kindDist(rng)) {
+			case 0: { stats.metalExcess = -stats.metalExcess - 1.0f; } break;
+			case 1: { stats.energyExcess = std::numeric_limits<float>::infinity(); } break;
+			case 2: { stats.energyExcess = -0.0f; } break;
+			case 3: { stats.unitsDied = -stats.unitsDied - 1; } break;
+			default: {} break;
+		}
+
+		reference.push_back(stats);
+		history.Commit();
+	}
+
+	REQUIRE(history.size() == reference.size() + 1);
+	CHECK(history.GetEncodedSize() < reference.size() * sizeof(TeamStatistics));
+
+	size_t numVisited = 0;
+
+	history.ForEach(0, history.size(), [&](size_t i, const TeamStatistics& stats) {
+		CHECK(i == numVisited++);
+
+		if (i < reference.size()) {
+			CHECK(BitEquals(stats, reference[i]));
+		} else {
+			CHECK(BitEquals(stats, history.back()));
+		}
+	});
+
+	CHECK(numVisited == history.size());
+
+	// ranges starting in the middle of a block and past the end
+	for (const size_t begin: {size_t(0), size_t(1), size_t(63), size_t(64), size_t(100), reference.size() - 1, reference.size(), reference.size() + 5}) {
+		const size_t end = begin + 70;
+
+		size_t next = begin;
+
+		history.ForEach(begin, end, [&](size_t i, const TeamStatistics& stats) {
+			CHECK(i == next++);
+			CHECK(BitEquals(stats, history.Get(i)));
+
+			if (i < reference.size())
+				CHECK(BitEquals(stats, reference[i]));
+		});
+
+		CHECK(next == std::max(begin, std::min(end, history.size())));
+	}
+}
@@ -0,0 +1,325 @@
+/* This file is part of the Spring engine (GPL v2 or later), see LICENSE.html */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "System/Sync/DumpStateFormat.h"
+
+/*
+Usage:
+dumpstatediff [--all] [--max-frames N] <dumpA.sdsb> <dumpB.sdsb>
+
+Compares two binary game-state dumps (written by /DumpStateBinary) frame by
+frame and prints, for every frame in which they differ, the first diverging
+object and field. With --all every differing field is printed instead.
+Exit code is 0 if the dumps match, 1 if they differ and 2 on errors.
+*/
+
+using namespace DumpStateFormat;
+
+namespace {
+	struct FieldSchema {
+		std::string name;
+		std::uint8_t type;
+		std::size_t offset;
+	};
+
+	struct RecordSchema {
+		std::string name;
+		std::vector<FieldSchema> fields;
+		std::size_t size;
+	};
+
+	// (record type, object id) -> raw field data
+	typedef std::map<std::pair<std::uint8_t, std::int32_t>, std::vector<std::uint8_t>> FrameRecords;
+
+
+	class CDumpReader {
+	public:
+		~CDumpReader() {
+			if (file != nullptr)
+				std::fclose(file);
+		}
+
+		bool Open(const char* fileName) {
+			if ((file = std::fopen(fileName, "rb")) == nullptr) {
+				std::fprintf(stderr, "could not open \"%s\"\n", fileName);
+				return false;
+			}
+
+			if (std::fread(&header, sizeof(header), 1, file) != 1 || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+				std::fprintf(stderr, "\"%s\" is not a binary state dump\n", fileName);
+				return false;
+			}
+
+			if (header.version != VERSION) {
+				std::fprintf(stderr, "\"%s\" has version %u (expected %u)\n", fileName, header.version, VERSION);
+				return false;
+			}
+
+			bool ok = ReadString(mapName) && ReadString(modName) && ReadString(syncVersion);
+
+			for (std::uint32_t i = 0; ok && i < header.numRecordTypes; i++) {
+				RecordSchema& schema = schemas.emplace_back();
+				std::uint16_t numFields = 0;
+
+				ok = ReadString(schema.name) && Read(&numFields, sizeof(numFields));
+				schema.size = 0;
+
+				for (std::uint16_t j = 0; ok && j < numFields; j++) {
+					FieldSchema& field = schema.fields.emplace_back();
+
+					ok = Read(&field.type, sizeof(field.type)) && ReadString(field.name) && (field.type < FIELD_TYPE_COUNT);
+					field.offset = schema.size;
+					schema.size += GetFieldSize(field.type);
+				}
+			}
+
+			if (!ok)
+				std::fprintf(stderr, "\"%s\" has a truncated or corrupt header\n", fileName);
+
+			return (ok && ReadRecordHead());
+		}
+
+		// reads all records belonging to the next frame; false at end of file
+		bool ReadFrame(std::int32_t& frameNum, FrameRecords& records) {
+			records.clear();
+
+			if (!haveRecord)
+				return false;
+			if (nextType != RECORD_FRAME)
+				return false;
+
+			frameNum = nextID;
+
+			do {
+				std::vector<std::uint8_t>& data = records[{nextType, nextID}];
+				data.resize(schemas[nextType].size);
+
+				if (!Read(data.data(), data.size()))
+					return false;
+			} while (ReadRecordHead() && nextType != RECORD_FRAME);
+
+			return true;
+		}
+
+		const std::vector<RecordSchema>& GetSchemas() const { return schemas; }
+
+		const FileHeader& GetHeader() const { return header; }
+		const std::string& GetMapName() const { return mapName; }
+		const std::string& GetModName() const { return modName; }
+		const std::string& GetSyncVersion() const { return syncVersion; }
+
+	private:
+		bool Read(void* data, std::size_t size) { return (std::fread(data, 1, size, file) == size); }
+
+		bool ReadString(std::string& s) {
+			std::uint16_t size = 0;
+
+			if (!Read(&size, sizeof(size)))
+				return false;
+
+			s.resize(size);
+			return Read(s.data(), size);
+		}
+
+		bool ReadRecordHead() {
+			haveRecord = Read(&nextType, sizeof(nextType)) && Read(&nextID, sizeof(nextID)) && (nextType < schemas.size());
+			return haveRecord;
+		}
+
+	private:
+		std::FILE* file = nullptr;
+
+		FileHeader header;
+		std::string mapName;
+		std::string modName;
+		std::string syncVersion;
+
+		std::vector<RecordSchema> schemas;
+
+		std::uint8_t nextType = 0;
+		std::int32_t nextID = 0;
+		bool haveRecord = false;
+	};
+
+
+	bool SchemasMatch(const std::vector<RecordSchema>& a, const std::vector<RecordSchema>& b) {
+		if (a.size() != b.size())
+			return false;
+
+		for (std::size_t i = 0; i < a.size(); i++) {
+			if (a[i].name != b[i].name || a[i].fields.size() != b[i].fields.size())
+				return false;
+
+			for (std::size_t j = 0; j < a[i].fields.size(); j++) {
+				if (a[i].fields[j].name != b[i].fields[j].name || a[i].fields[j].type != b[i].fields[j].type)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	std::string FormatValue(const std::uint8_t* data, std::uint8_t type) {
+		char buf[128];
+
+		std::uint32_t u[3];
+		float f[3];
+
+		std::memcpy(u, data, GetFieldSize(type));
+		std::memcpy(f, data, GetFieldSize(type));
+
+		switch (type) {
+			case FIELD_INT32 : { std::snprintf(buf, sizeof(buf), "%d", static_cast<std::int32_t>(u[0])); } break;
+			case FIELD_UINT32: { std::snprintf(buf, sizeof(buf), "%u (0x%08x)", u[0], u[0]); } break;
+			case FIELD_FLOAT : { std::snprintf(buf, sizeof(buf), "%.9g (0x%08x)", f[0], u[0]); } break;
+			case FIELD_FLOAT3: { std::snprintf(buf, sizeof(buf), "<%.9g, %.9g, %.9g> (0x%08x 0x%08x 0x%08x)", f[0], f[1], f[2], u[0], u[1], u[2]); } break;
+			default          : { std::snprintf(buf, sizeof(buf), "?"); } break;
+		}
+
+		return buf;
+	}
+
+	// returns the number of differing records in this frame
+	unsigned int DiffFrame(std::int32_t frameNum, const FrameRecords& a, const FrameRecords& b, const std::vector<RecordSchema>& schemas, bool reportAll) {
+		unsigned int numDiffs = 0;
+
+		const auto Report = [&](const std::pair<std::uint8_t, std::int32_t>& key, const char* what) {
+			if (numDiffs++ == 0 || reportAll)
+				std::printf("frame %d: %s %d %s\n", frameNum, schemas[key.first].name.c_str(), key.second, what);
+		};
+
+		auto ia = a.begin();
+		auto ib = b.begin();
+
+		// both maps are ordered by (type, id), so walk them in lockstep
+		while (ia != a.end() || ib != b.end()) {
+			if (ib == b.end() || (ia != a.end() && ia->first < ib->first)) {
+				Report(ia->first, "only exists in A");
+				++ia;
+				continue;
+			}
+			if (ia == a.end() || ib->first < ia->first) {
+				Report(ib->first, "only exists in B");
+				++ib;
+				continue;
+			}
+
+			if (ia->second != ib->second && (numDiffs++ == 0 || reportAll)) {
+				const RecordSchema& schema = schemas[ia->first.first];
+
+				for (const FieldSchema& field: schema.fields) {
+					const std::uint8_t* va = ia->second.data() + field.offset;
+					const std::uint8_t* vb = ib->second.data() + field.offset;
+
+					if (std::memcmp(va, vb, GetFieldSize(field.type)) == 0)
+						continue;
+
+					std::printf("frame %d: %s %d field \"%s\" differs\n", frameNum, schema.name.c_str(), ia->first.second, field.name.c_str());
+					std::printf("\tA: %s\n", FormatValue(va, field.type).c_str());
+					std::printf("\tB: %s\n", FormatValue(vb, field.type).c_str());
+
+					if (!reportAll)
+						break;
+				}
+			}
+
+			++ia;
+			++ib;
+		}
+
+		return numDiffs;
+	}
+}
+
+
+int main(int argc, char* argv[])
+{
+	const char* fileNames[2] = {nullptr, nullptr};
+
+	int numFileNames = 0;
+	int maxDiffFrames = -1;
+
+	bool reportAll = false;
+
+	for (int i = 1; i < argc; i++) {
+		if (std::strcmp(argv[i], "--all") == 0) {
+			reportAll = true;
+			continue;
+		}
+		if (std::strcmp(argv[i], "--max-frames") == 0 && (i + 1) < argc) {
+			maxDiffFrames = std::atoi(argv[++i]);
+			continue;
+		}
+		if (numFileNames < 2) {
+			fileNames[numFileNames++] = argv[i];
+			continue;
+		}
+
+		numFileNames = 0;
+		break;
+	}
+
+	if (numFileNames != 2) {
+		std::printf("Usage: %s [--all] [--max-frames N] <dumpA.sdsb> <dumpB.sdsb>\n", argv[0]);
+		return 2;
+	}
+
+	CDumpReader readers[2];
+
+	if (!readers[0].Open(fileNames[0]) || !readers[1].Open(fileNames[1]))
+		return 2;
+
+	if (!SchemasMatch(readers[0].GetSchemas(), readers[1].GetSchemas())) {
+		std::fprintf(stderr, "dumps were written with different record schemas\n");
+		return 2;
+	}
+
+	if (readers[0].GetSyncVersion() != readers[1].GetSyncVersion())
+		std::printf("note: sync versions differ (\"%s\" vs \"%s\")\n", readers[0].GetSyncVersion().c_str(), readers[1].GetSyncVersion().c_str());
+	if (readers[0].GetMapName() != readers[1].GetMapName() || readers[0].GetModName() != readers[1].GetModName())
+		std::printf("note: map or game differ (\"%s\"/\"%s\" vs \"%s\"/\"%s\")\n", readers[0].GetMapName().c_str(), readers[0].GetModName().c_str(), readers[1].GetMapName().c_str(), readers[1].GetModName().c_str());
+	if (std::memcmp(readers[0].GetHeader().gameID, readers[1].GetHeader().gameID, sizeof(readers[0].GetHeader().gameID)) != 0)
+		std::printf("note: game IDs differ\n");
+
+	FrameRecords records[2];
+	std::int32_t frameNums[2] = {0, 0};
+	bool haveFrames[2] = {false, false};
+
+	unsigned int numFrames = 0;
+	unsigned int numDiffFrames = 0;
+
+	haveFrames[0] = readers[0].ReadFrame(frameNums[0], records[0]);
+	haveFrames[1] = readers[1].ReadFrame(frameNums[1], records[1]);
+
+	while (haveFrames[0] && haveFrames[1]) {
+		// dumps may cover different ranges, only compare frames present in both
+		if (frameNums[0] != frameNums[1]) {
+			const int i = (frameNums[0] < frameNums[1])? 0: 1;
+			haveFrames[i] = readers[i].ReadFrame(frameNums[i], records[i]);
+			continue;
+		}
+
+		numFrames += 1;
+
+		if (const unsigned int numDiffs = DiffFrame(frameNums[0], records[0], records[1], readers[0].GetSchemas(), reportAll); numDiffs > 0) {
+			std::printf("frame %d: %u differing record(s)\n", frameNums[0], numDiffs);
+
+			if (++numDiffFrames == static_cast<unsigned int>(maxDiffFrames))
+				break;
+		}
+
+		haveFrames[0] = readers[0].ReadFrame(frameNums[0], records[0]);
+		haveFrames[1] = readers[1].ReadFrame(frameNums[1], records[1]);
+	}
+
+	std::printf("compared %u frame(s), %u differ\n", numFrames, numDiffFrames);
+	return ((numDiffFrames > 0)? 1: 0);
+}